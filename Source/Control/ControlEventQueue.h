@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Control/ParameterTable.h"
+#include "Util/SpscRing.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace Control {
+
+/**
+ * Performance gesture from the editor (or any other control surface).
+ */
+struct ControlEvent {
+    enum class Type : uint8_t {
+        TriggerOn,          // value = velocity (0-1)
+        TriggerOff,
+        HoldOn,             // Sustain: releases wait until HoldOff
+        HoldOff,
+        PitchDive,          // Glide pitch offset to value octaves over duration seconds
+        SetParameter,       // Override parameter with value until ReleaseParameter
+        ReleaseParameter    // Back to the parameter's own value
+    };
+
+    Type type = Type::TriggerOn;
+    ParamIndex parameter = ParamIndex::VcoRate;
+    float value = 0.0f;
+    float duration = 0.0f;
+    int64_t timestampTicks = 0;     // Producer's clock, mapped to a sample position by the consumer
+};
+
+/**
+ * Control Event Queue
+ *
+ * Wait-free single-producer/single-consumer queue carrying ControlEvents
+ * from the message thread to the audio thread. Fixed capacity, nothing
+ * allocates after construction; a full queue drops the new event and
+ * counts it, so a burst that outruns the audio thread shows up in the
+ * statistics instead of blocking the GUI.
+ *
+ * Threading: Push() and the statistics getters from the producer (or any
+ * thread for the getters), Pop() from the audio thread only.
+ */
+class ControlEventQueue {
+public:
+    static constexpr size_t kRingSize = 256;
+    static constexpr size_t kCapacity = Util::SpscRing<ControlEvent, kRingSize>::GetCapacity();
+
+    /**
+     * Producer: queue an event. Returns false (and counts an overflow) when full.
+     */
+    bool Push(const ControlEvent& event) {
+        if (! ring_.Push(event)) {
+            numDropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        numPushed_.fetch_add(1, std::memory_order_relaxed);
+
+        const size_t occupancy = ring_.GetNumReady();
+        if (occupancy > highWaterMark_.load(std::memory_order_relaxed)) {
+            highWaterMark_.store(occupancy, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /**
+     * Consumer: take the oldest event. Returns false when empty.
+     */
+    bool Pop(ControlEvent& event) { return ring_.Pop(event); }
+
+    size_t GetNumReady() const { return ring_.GetNumReady(); }
+
+    // Statistics
+    uint64_t GetNumPushed() const { return numPushed_.load(std::memory_order_relaxed); }
+    uint64_t GetNumDropped() const { return numDropped_.load(std::memory_order_relaxed); }
+    size_t GetHighWaterMark() const { return highWaterMark_.load(std::memory_order_relaxed); }
+
+    // Producer thread
+    void ResetStatistics() {
+        numPushed_.store(0, std::memory_order_relaxed);
+        numDropped_.store(0, std::memory_order_relaxed);
+        highWaterMark_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    Util::SpscRing<ControlEvent, kRingSize> ring_;
+
+    std::atomic<uint64_t> numPushed_ { 0 };
+    std::atomic<uint64_t> numDropped_ { 0 };
+    std::atomic<size_t> highWaterMark_ { 0 };
+};
+
+} // namespace Control
+} // namespace SimpleSynth
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Control/ParameterTable.h"
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace Control {
+
+/**
+ * MIDI Controller Mapping
+ *
+ * Flat routing table from controller sources (CC 0-127, pitch bend,
+ * channel pressure) to parameters: one byte per source x parameter, all
+ * preallocated. An incoming controller visits its own row only, so each
+ * event costs the same however many mappings exist.
+ *
+ * MIDI learn: the message thread arms a parameter with StartLearn(); the
+ * audio thread binds the first learnable controller that moves.
+ *
+ * Threading: cells and the learn target are atomics, so the message
+ * thread may edit mappings while the audio thread reads them.
+ */
+class MidiMapping {
+public:
+    static constexpr size_t kNumControllers = 128;
+    static constexpr size_t kPitchBendSource = 128;
+    static constexpr size_t kChannelPressureSource = 129;
+    static constexpr size_t kNumSources = 130;
+
+    // CCs 120-127 are channel mode messages (all notes off etc.)
+    static constexpr size_t kFirstModeController = 120;
+
+    static constexpr int kNotLearning = -1;
+
+    MidiMapping() { ClearAll(); }
+
+    void Map(size_t source, ParamIndex destination) { SetCell(source, destination, 1); }
+    void Unmap(size_t source, ParamIndex destination) { SetCell(source, destination, 0); }
+
+    bool IsMapped(size_t source, ParamIndex destination) const {
+        return routes_[CellIndex(source, destination)].load(std::memory_order_relaxed) != 0;
+    }
+
+    bool HasMapping(ParamIndex destination) const {
+        for (size_t source = 0; source < kNumSources; ++source) {
+            if (IsMapped(source, destination)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ClearDestination(ParamIndex destination) {
+        for (size_t source = 0; source < kNumSources; ++source) {
+            Unmap(source, destination);
+        }
+    }
+
+    void ClearAll() {
+        for (auto& cell : routes_) {
+            cell.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    static bool IsLearnable(size_t source) {
+        return source < kNumSources && (source < kFirstModeController || source >= kNumControllers);
+    }
+
+    /**
+     * Message thread: bind the next controller that moves to destination.
+     */
+    void StartLearn(ParamIndex destination) {
+        assert(GetParameterInfo(destination).continuous && "Only continuous parameters can be mapped");
+        learnTarget_.store(static_cast<int>(destination), std::memory_order_release);
+    }
+
+    void CancelLearn() { learnTarget_.store(kNotLearning, std::memory_order_release); }
+
+    int GetLearnTarget() const { return learnTarget_.load(std::memory_order_acquire); }
+
+    /**
+     * Audio thread: complete a pending learn with source, replacing the
+     * destination's previous mappings. Returns true if it did.
+     */
+    bool Learn(size_t source) {
+        if (! IsLearnable(source) || learnTarget_.load(std::memory_order_relaxed) == kNotLearning) {
+            return false;
+        }
+
+        const int target = learnTarget_.exchange(kNotLearning, std::memory_order_acq_rel);
+        if (target == kNotLearning) {
+            return false;
+        }
+
+        const auto destination = static_cast<ParamIndex>(target);
+        ClearDestination(destination);
+        Map(source, destination);
+        return true;
+    }
+
+    /**
+     * Call callback(ParamIndex) for every parameter mapped from source.
+     */
+    template <typename Callback>
+    void ForEachDestination(size_t source, Callback&& callback) const {
+        if (source >= kNumSources) {
+            return;
+        }
+
+        const size_t row = source * kNumParameters;
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            if (routes_[row + i].load(std::memory_order_relaxed) != 0) {
+                callback(ToParamIndex(i));
+            }
+        }
+    }
+
+private:
+    static size_t CellIndex(size_t source, ParamIndex destination) {
+        assert(source < kNumSources && "Controller source out of range");
+        return source * kNumParameters + static_cast<size_t>(destination);
+    }
+
+    void SetCell(size_t source, ParamIndex destination, uint8_t value) {
+        routes_[CellIndex(source, destination)].store(value, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint8_t>, kNumSources * kNumParameters> routes_;
+    std::atomic<int> learnTarget_ { kNotLearning };
+};
+
+} // namespace Control
+} // namespace SimpleSynth
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "DSP/ParameterSmoother.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace Control {
+
+/**
+ * Central Parameter Index
+ *
+ * Every plugin parameter has a dense index, so per-parameter state
+ * (raw value pointers, gesture overrides, controller mappings) lives in
+ * flat arrays instead of being looked up by string ID on the audio
+ * thread. Order matches createParameterLayout().
+ */
+enum class ParamIndex : uint8_t {
+    VcoRate = 0,
+    VcoLevel,
+    DelayTime,
+    DelayFeedback,
+    DelayWetDry,
+    DelayHeads,
+    DelayTape,
+    Lfo1Rate,
+    Lfo1Amount,
+    Lfo1Target,
+    Lfo2Rate,
+    Lfo2Amount,
+    Lfo2Target,
+    Oversampling,
+    Quality,
+    KeyTrack,
+    Glide,
+    Morph,
+    MorphA,
+    MorphB,
+    ReverbMix,
+    ReverbDecay,
+    ReverbDamping,
+    ReverbSize,
+    SpringMix,
+    FilterMode,
+    FilterCutoff,
+    FilterResonance,
+    Count
+};
+
+constexpr size_t kNumParameters = static_cast<size_t>(ParamIndex::Count);
+
+using SmoothingMode = DSP::ParameterSmoother::Mode;
+
+struct ParameterInfo {
+    const char* id;             // APVTS parameter ID
+    bool continuous;            // Float parameter that may change mid-block
+    SmoothingMode smoothing;    // For controller-driven changes
+    float smoothingSeconds;
+};
+
+// Rates glide exponentially (even in pitch), levels and delay time
+// linearly (delay time moves like a tape transport)
+inline constexpr ParameterInfo kParameterInfo[kNumParameters] = {
+    { "vcoRate",         true,  SmoothingMode::OnePole, 0.03f },
+    { "vcoLevel",        true,  SmoothingMode::Linear,  0.02f },
+    { "delayTime",       true,  SmoothingMode::Linear,  0.10f },
+    { "delayFeedback",   true,  SmoothingMode::OnePole, 0.02f },
+    { "delayWetDry",     true,  SmoothingMode::Linear,  0.02f },
+    { "delayHeads",      false, SmoothingMode::Linear,  0.0f  },
+    { "delayTape",       false, SmoothingMode::Linear,  0.0f  },
+    { "lfo1Rate",        true,  SmoothingMode::OnePole, 0.05f },
+    { "lfo1Amount",      true,  SmoothingMode::Linear,  0.02f },
+    { "lfo1Target",      false, SmoothingMode::Linear,  0.0f  },
+    { "lfo2Rate",        true,  SmoothingMode::OnePole, 0.05f },
+    { "lfo2Amount",      true,  SmoothingMode::Linear,  0.02f },
+    { "lfo2Target",      false, SmoothingMode::Linear,  0.0f  },
+    { "oversampling",    false, SmoothingMode::Linear,  0.0f  },
+    { "quality",         false, SmoothingMode::Linear,  0.0f  },
+    { "keyTrack",        false, SmoothingMode::Linear,  0.0f  },
+    { "glide",           true,  SmoothingMode::Linear,  0.02f },
+    { "morph",           true,  SmoothingMode::Linear,  0.05f },
+    { "morphA",          false, SmoothingMode::Linear,  0.0f  },
+    { "morphB",          false, SmoothingMode::Linear,  0.0f  },
+    { "reverbMix",       true,  SmoothingMode::Linear,  0.02f },
+    { "reverbDecay",     true,  SmoothingMode::OnePole, 0.05f },
+    { "reverbDamping",   true,  SmoothingMode::Linear,  0.02f },
+    { "reverbSize",      false, SmoothingMode::Linear,  0.0f  },
+    { "springMix",       true,  SmoothingMode::Linear,  0.02f },
+    { "filterMode",      false, SmoothingMode::Linear,  0.0f  },
+    { "filterCutoff",    true,  SmoothingMode::OnePole, 0.03f },
+    { "filterResonance", true,  SmoothingMode::Linear,  0.02f }
+};
+
+inline constexpr const ParameterInfo& GetParameterInfo(ParamIndex index) {
+    return kParameterInfo[static_cast<size_t>(index)];
+}
+
+inline constexpr ParamIndex ToParamIndex(size_t index) {
+    return static_cast<ParamIndex>(index);
+}
+
+} // namespace Control
+} // namespace SimpleSynth
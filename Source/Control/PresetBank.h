@@ -0,0 +1,260 @@
+#pragma once
+
+#include "Control/ParameterTable.h"
+#include "Control/StateFormat.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace SimpleSynth {
+namespace Control {
+
+/**
+ * Preset Bank
+ *
+ * A read-only bank of presets laid out to be used in place from a
+ * memory-mapped file (all integers little-endian):
+ *
+ *     Header   magic "DSPB" | u16 version | u16 header size |
+ *              u32 preset count | u32 column count
+ *     Columns  u32 parameter id hash per record column
+ *     Index    (u32 name hash, u32 record offset) per preset, by hash
+ *     Records  char name[kNameSize] | f32 real value per column
+ *
+ * Records are fixed-size and in program order, so recalling program n
+ * is one offset computation and a copy of its floats: no parsing, no
+ * allocation. The columns are matched to this build's parameters once,
+ * in Open(); parameters the bank predates take the caller's defaults
+ * and columns this build doesn't know are ignored.
+ *
+ * Floats are read in place, so the host must be little-endian (as every
+ * platform the plugin builds for is). The view holds no copy of the
+ * data; the mapping must outlive it.
+ */
+class PresetBank {
+public:
+    static constexpr uint32_t kMagic = 0x42505344u;   // "DSPB" as bytes
+    static constexpr uint16_t kVersion = 1;
+    static constexpr uint16_t kHeaderSize = 16;
+    static constexpr size_t kNameSize = 32;
+
+    struct Preset {
+        std::string name;
+        std::array<float, kNumParameters> values {};
+    };
+
+    PresetBank() { Close(); }
+
+    /**
+     * Validate a bank and match its columns; false (and empty) if damaged.
+     */
+    bool Open(const void* data, size_t size) {
+        Close();
+
+        StateFormat::Reader reader(data, size);
+        if (reader.ReadU32() != kMagic) {
+            return false;
+        }
+        const uint16_t version = reader.ReadU16();
+        const uint16_t headerSize = reader.ReadU16();
+        const uint32_t numPresets = reader.ReadU32();
+        const uint32_t numColumns = reader.ReadU32();
+        if (! reader.IsValid() || version == 0 || version > kVersion || headerSize < kHeaderSize) {
+            return false;
+        }
+
+        // Sizes in 64 bits: a damaged count can't wrap the bounds checks
+        const uint64_t columnsOffset = headerSize;
+        const uint64_t indexOffset = columnsOffset + 4ull * numColumns;
+        const uint64_t recordsOffset = indexOffset + 8ull * numPresets;
+        const uint64_t recordSize = kNameSize + 4ull * numColumns;
+        if (recordsOffset + recordSize * numPresets > size) {
+            return false;
+        }
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        StateFormat::Reader columns(bytes + columnsOffset, 4 * numColumns);
+        columns_.fill(-1);
+        for (uint32_t c = 0; c < numColumns; ++c) {
+            const size_t index = StateFormat::FindParameter(columns.ReadU32());
+            if (index < kNumParameters && columns_[index] < 0) {
+                columns_[index] = static_cast<int32_t>(c);
+            }
+        }
+
+        // Every index entry must land on a record
+        StateFormat::Reader index(bytes + indexOffset, 8ull * numPresets);
+        uint32_t previousHash = 0;
+        for (uint32_t n = 0; n < numPresets; ++n) {
+            const uint32_t hash = index.ReadU32();
+            const uint64_t offset = index.ReadU32();
+            if (hash < previousHash || offset < recordsOffset
+                || (offset - recordsOffset) % recordSize != 0 || (offset - recordsOffset) / recordSize >= numPresets) {
+                columns_.fill(-1);
+                return false;
+            }
+            previousHash = hash;
+        }
+
+        data_ = bytes;
+        numPresets_ = numPresets;
+        indexOffset_ = static_cast<size_t>(indexOffset);
+        recordsOffset_ = static_cast<size_t>(recordsOffset);
+        recordSize_ = static_cast<size_t>(recordSize);
+        return true;
+    }
+
+    void Close() {
+        data_ = nullptr;
+        numPresets_ = 0;
+        columns_.fill(-1);
+    }
+
+    size_t GetNumPresets() const { return numPresets_; }
+
+    // Up to kNameSize bytes; names are zero-padded, not terminated
+    std::string_view GetName(size_t preset) const {
+        const auto* name = reinterpret_cast<const char*>(GetRecord(preset));
+        size_t length = 0;
+        while (length < kNameSize && name[length] != '\0') {
+            ++length;
+        }
+        return std::string_view(name, length);
+    }
+
+    /**
+     * A preset's real values, indexed by ParamIndex. O(kNumParameters);
+     * no allocation.
+     */
+    void GetValues(size_t preset, float* values, const float* defaults) const {
+        const uint8_t* record = GetRecord(preset) + kNameSize;
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            if (columns_[i] < 0) {
+                values[i] = defaults[i];
+            } else {
+                std::memcpy(&values[i], record + 4 * static_cast<size_t>(columns_[i]), sizeof(float));
+            }
+        }
+    }
+
+    /**
+     * Program number of the preset with this name, or -1. A binary search
+     * of the index. Names are cut to kNameSize bytes, as Write() stores them.
+     */
+    int FindPreset(std::string_view name) const {
+        name = Truncate(name);
+        const uint32_t hash = HashName(name);
+
+        size_t low = 0;
+        size_t high = numPresets_;
+        while (low < high) {
+            const size_t middle = (low + high) / 2;
+            if (ReadIndexHash(middle) < hash) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        // Hash collisions sit next to each other
+        for (; low < numPresets_ && ReadIndexHash(low) == hash; ++low) {
+            const size_t preset = (ReadIndexOffset(low) - recordsOffset_) / recordSize_;
+            if (GetName(preset) == name) {
+                return static_cast<int>(preset);
+            }
+        }
+        return -1;
+    }
+
+    // FNV-1a, as StateFormat::HashId()
+    static uint32_t HashName(std::string_view name) {
+        uint32_t hash = 2166136261u;
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * Serialise presets into a bank (offline; allocates). Names longer than
+     * kNameSize bytes are cut.
+     */
+    static void Write(std::vector<uint8_t>& output, const std::vector<Preset>& presets) {
+        StateFormat::Writer writer(output);
+        const auto numPresets = static_cast<uint32_t>(presets.size());
+
+        writer.WriteU32(kMagic);
+        writer.WriteU16(kVersion);
+        writer.WriteU16(kHeaderSize);
+        writer.WriteU32(numPresets);
+        writer.WriteU32(static_cast<uint32_t>(kNumParameters));
+
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            writer.WriteU32(StateFormat::HashId(kParameterInfo[i].id));
+        }
+
+        const size_t recordsOffset = kHeaderSize + 4 * kNumParameters + 8 * presets.size();
+        const size_t recordSize = kNameSize + 4 * kNumParameters;
+
+        std::vector<std::pair<uint32_t, uint32_t>> index;
+        index.reserve(presets.size());
+        for (size_t n = 0; n < presets.size(); ++n) {
+            index.emplace_back(HashName(Truncate(presets[n].name)),
+                               static_cast<uint32_t>(recordsOffset + n * recordSize));
+        }
+        std::sort(index.begin(), index.end());
+        for (const auto& entry : index) {
+            writer.WriteU32(entry.first);
+            writer.WriteU32(entry.second);
+        }
+
+        for (const auto& preset : presets) {
+            char name[kNameSize] = {};
+            const auto truncated = Truncate(preset.name);
+            std::memcpy(name, truncated.data(), truncated.size());
+            writer.WriteBytes(name, kNameSize);
+
+            for (float value : preset.values) {
+                writer.WriteFloat(value);
+            }
+        }
+    }
+
+private:
+    static std::string_view Truncate(std::string_view name) {
+        return name.substr(0, kNameSize);
+    }
+
+    const uint8_t* GetRecord(size_t preset) const {
+        return data_ + recordsOffset_ + preset * recordSize_;
+    }
+
+    uint32_t ReadIndexHash(size_t entry) const {
+        StateFormat::Reader reader(data_ + indexOffset_ + 8 * entry, 4);
+        return reader.ReadU32();
+    }
+
+    size_t ReadIndexOffset(size_t entry) const {
+        StateFormat::Reader reader(data_ + indexOffset_ + 8 * entry + 4, 4);
+        return reader.ReadU32();
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t numPresets_ = 0;
+    size_t indexOffset_ = 0;
+    size_t recordsOffset_ = 0;
+    size_t recordSize_ = 0;
+
+    // Record column of each parameter, -1 if the bank lacks it
+    std::array<int32_t, kNumParameters> columns_ {};
+};
+
+} // namespace Control
+} // namespace SimpleSynth
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Control/ParameterTable.h"
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace Control {
+
+/**
+ * Parameter Snapshot
+ *
+ * Captured real (unnormalised) values of every parameter, indexed by
+ * ParamIndex and padded to a multiple of 8 floats for vector blends.
+ * Fixed-size, so copies never allocate.
+ */
+struct Snapshot {
+    static constexpr size_t kStride = (kNumParameters + 7) & ~static_cast<size_t>(7);
+
+    alignas(32) std::array<float, kStride> values {};
+    bool captured = false;
+
+    float Get(ParamIndex index) const { return values[static_cast<size_t>(index)]; }
+    void Set(ParamIndex index, float value) { values[static_cast<size_t>(index)] = value; }
+};
+
+struct SnapshotBank {
+    static constexpr size_t kNumSlots = 8;
+
+    std::array<Snapshot, kNumSlots> slots;
+};
+
+/**
+ * Snapshot Morph
+ *
+ * Blends the continuous parameters between two snapshots. SetEndpoints()
+ * precomputes the start values and per-parameter deltas plus the list of
+ * parameters that actually differ, so Blend() is one multiply-add per
+ * padded lane (a loop the compiler vectorizes) and applying a control
+ * tick only touches parameters that move.
+ *
+ * Discrete parameters (choices, head count, quality) aren't morphed;
+ * neither is Morph itself.
+ */
+class SnapshotMorph {
+public:
+    SnapshotMorph() { Clear(); }
+
+    static bool IsMorphable(ParamIndex index) {
+        return GetParameterInfo(index).continuous && index != ParamIndex::Morph;
+    }
+
+    void SetEndpoints(const Snapshot& a, const Snapshot& b) {
+        assert(a.captured && b.captured && "Morph endpoints must be captured snapshots");
+
+        numMorphable_ = 0;
+        numMoving_ = 0;
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            const bool morphable = IsMorphable(ToParamIndex(i));
+
+            // Non-morphable lanes blend to zero and are never read
+            start_[i] = morphable ? a.values[i] : 0.0f;
+            delta_[i] = morphable ? b.values[i] - a.values[i] : 0.0f;
+
+            if (morphable) {
+                morphable_[numMorphable_++] = static_cast<uint8_t>(i);
+                if (delta_[i] != 0.0f) {
+                    moving_[numMoving_++] = static_cast<uint8_t>(i);
+                }
+            }
+        }
+        active_ = true;
+    }
+
+    void Clear() {
+        start_.fill(0.0f);
+        delta_.fill(0.0f);
+        values_.fill(0.0f);
+        numMorphable_ = 0;
+        numMoving_ = 0;
+        active_ = false;
+    }
+
+    bool IsActive() const { return active_; }
+
+    /**
+     * Values at position (0 = first snapshot, 1 = second).
+     */
+    void Blend(float position) {
+        // this loop vectorizes
+        for (size_t i = 0; i < Snapshot::kStride; ++i) {
+            values_[i] = start_[i] + position * delta_[i];
+        }
+    }
+
+    float GetValue(size_t index) const { return values_[index]; }
+
+    // Every morphed parameter (for a full recall) and those the two
+    // snapshots disagree on (all a moving morph has to update)
+    size_t GetNumMorphable() const { return numMorphable_; }
+    ParamIndex GetMorphable(size_t i) const { return ToParamIndex(morphable_[i]); }
+    size_t GetNumMoving() const { return numMoving_; }
+    ParamIndex GetMoving(size_t i) const { return ToParamIndex(moving_[i]); }
+
+private:
+    alignas(32) std::array<float, Snapshot::kStride> start_;
+    alignas(32) std::array<float, Snapshot::kStride> delta_;
+    alignas(32) std::array<float, Snapshot::kStride> values_;
+
+    std::array<uint8_t, kNumParameters> morphable_ {};
+    std::array<uint8_t, kNumParameters> moving_ {};
+    size_t numMorphable_ = 0;
+    size_t numMoving_ = 0;
+    bool active_ = false;
+};
+
+} // namespace Control
+} // namespace SimpleSynth
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "Control/ParameterTable.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace SimpleSynth {
+namespace Control {
+
+/**
+ * Binary Plugin State
+ *
+ * Layout (all integers little-endian):
+ *
+ *     Header   magic "DSST" | u16 version | u16 header size | u32 section count
+ *     Section  u32 tag | u32 payload size | payload
+ *
+ * The Parameters section is a u32 count followed by (u32 id hash, f32
+ * real value) pairs, so a load is a table scan with no string parsing.
+ * Readers skip sections they don't know, and sections may grow at the
+ * end, so older builds still read newer state. A version bump is only
+ * needed for changes older readers would misread.
+ *
+ * Legacy state (copyXmlToBinary) starts with a different magic; see
+ * IsBinaryState().
+ */
+namespace StateFormat {
+
+constexpr uint32_t kMagic = 0x54535344u;   // "DSST" as bytes
+constexpr uint16_t kVersion = 1;
+constexpr uint16_t kHeaderSize = 12;
+
+enum class Section : uint32_t {
+    Parameters = 1,     // count, (hash, value) pairs
+    MidiMappings,       // Serialised ValueTree (small, irregular sections
+    Tuning,             // reuse the ValueTree binary encoding)
+    ModMatrix,
+    Snapshots           // count, (u8 slot, parameter table) per snapshot
+};
+
+/**
+ * 32-bit FNV-1a of a parameter id. Ids are few and fixed; the static
+ * assert below rejects a collision at compile time.
+ */
+constexpr uint32_t HashId(const char* id) {
+    uint32_t hash = 2166136261u;
+    for (; *id != '\0'; ++id) {
+        hash ^= static_cast<uint8_t>(*id);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+constexpr bool ParameterHashesAreUnique() {
+    for (size_t i = 0; i < kNumParameters; ++i) {
+        for (size_t j = i + 1; j < kNumParameters; ++j) {
+            if (HashId(kParameterInfo[i].id) == HashId(kParameterInfo[j].id)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(ParameterHashesAreUnique(), "Two parameter ids hash alike; rename one");
+
+// Parameter index for a stored hash, or kNumParameters if unknown
+inline size_t FindParameter(uint32_t hash) {
+    for (size_t i = 0; i < kNumParameters; ++i) {
+        if (HashId(kParameterInfo[i].id) == hash) {
+            return i;
+        }
+    }
+    return kNumParameters;
+}
+
+inline bool IsBinaryState(const void* data, size_t size) {
+    if (data == nullptr || size < kHeaderSize) {
+        return false;
+    }
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const uint32_t magic = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+    return magic == kMagic;
+}
+
+/**
+ * Appends the format to a byte vector (message thread; it allocates).
+ */
+class Writer {
+public:
+    explicit Writer(std::vector<uint8_t>& output) : output_(output) {}
+
+    void WriteHeader(uint32_t numSections) {
+        WriteU32(kMagic);
+        WriteU16(kVersion);
+        WriteU16(kHeaderSize);
+        WriteU32(numSections);
+    }
+
+    // Returns the position to pass to EndSection() once the payload is written
+    size_t BeginSection(Section section) {
+        WriteU32(static_cast<uint32_t>(section));
+        const size_t sizePosition = output_.size();
+        WriteU32(0);
+        return sizePosition;
+    }
+
+    void EndSection(size_t sizePosition) {
+        const auto size = static_cast<uint32_t>(output_.size() - sizePosition - 4);
+        for (size_t i = 0; i < 4; ++i) {
+            output_[sizePosition + i] = static_cast<uint8_t>(size >> (8 * i));
+        }
+    }
+
+    void WriteU8(uint8_t value) { output_.push_back(value); }
+
+    void WriteU16(uint16_t value) {
+        output_.push_back(static_cast<uint8_t>(value));
+        output_.push_back(static_cast<uint8_t>(value >> 8));
+    }
+
+    void WriteU32(uint32_t value) {
+        for (size_t i = 0; i < 4; ++i) {
+            output_.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void WriteFloat(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        WriteU32(bits);
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        output_.insert(output_.end(), bytes, bytes + size);
+    }
+
+    // Parameters section payload, also used per snapshot
+    void WriteParameterTable(const float* values) {
+        WriteU32(static_cast<uint32_t>(kNumParameters));
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            WriteU32(HashId(kParameterInfo[i].id));
+            WriteFloat(values[i]);
+        }
+    }
+
+private:
+    std::vector<uint8_t>& output_;
+};
+
+/**
+ * Bounds-checked reads over a state blob. Any read past the end fails
+ * the reader; later reads return zero, so callers check IsValid() once.
+ */
+class Reader {
+public:
+    Reader(const void* data, size_t size)
+        : data_(static_cast<const uint8_t*>(data)), size_(data != nullptr ? size : 0) {}
+
+    /**
+     * Validate the header and position at the first section. Returns
+     * the section count, or -1 for a blob this build can't read.
+     */
+    int ReadHeader() {
+        if (ReadU32() != kMagic) {
+            return Fail();
+        }
+        const uint16_t version = ReadU16();
+        const uint16_t headerSize = ReadU16();
+        const uint32_t numSections = ReadU32();
+        if (! valid_ || version == 0 || version > kVersion || headerSize < kHeaderSize || headerSize > size_) {
+            return Fail();
+        }
+        position_ = headerSize;
+        return static_cast<int>(numSections);
+    }
+
+    /**
+     * The next section's tag and a reader over its payload; advances past it.
+     */
+    bool NextSection(Section& section, Reader& payload) {
+        const uint32_t tag = ReadU32();
+        const uint32_t size = ReadU32();
+        if (! valid_ || size > size_ - position_) {
+            Fail();
+            return false;
+        }
+        section = static_cast<Section>(tag);
+        payload = Reader(data_ + position_, size);
+        position_ += size;
+        return true;
+    }
+
+    uint8_t ReadU8() { return Has(1) ? data_[position_++] : 0; }
+
+    uint16_t ReadU16() {
+        if (! Has(2)) {
+            return 0;
+        }
+        const auto value = static_cast<uint16_t>(data_[position_] | (data_[position_ + 1] << 8));
+        position_ += 2;
+        return value;
+    }
+
+    uint32_t ReadU32() {
+        if (! Has(4)) {
+            return 0;
+        }
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(data_[position_ + i]) << (8 * i);
+        }
+        position_ += 4;
+        return value;
+    }
+
+    float ReadFloat() {
+        const uint32_t bits = ReadU32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * A parameter table into values (indexed by ParamIndex). Unknown
+     * hashes (newer builds) are skipped; found[i] marks what was stored.
+     */
+    bool ReadParameterTable(float* values, bool* found) {
+        const uint32_t count = ReadU32();
+        if (! valid_ || count > Remaining() / 8) {
+            Fail();
+            return false;
+        }
+        for (uint32_t n = 0; n < count; ++n) {
+            const size_t index = FindParameter(ReadU32());
+            const float value = ReadFloat();
+            if (index < kNumParameters) {
+                values[index] = value;
+                found[index] = true;
+            }
+        }
+        return valid_;
+    }
+
+    const uint8_t* GetData() const { return data_ + position_; }
+    size_t Remaining() const { return size_ - position_; }
+    bool IsValid() const { return valid_; }
+
+private:
+    bool Has(size_t bytes) {
+        if (! valid_ || bytes > size_ - position_) {
+            valid_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    int Fail() {
+        valid_ = false;
+        return -1;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t position_ = 0;
+    bool valid_ = true;
+};
+
+} // namespace StateFormat
+} // namespace Control
+} // namespace SimpleSynth
@@ -0,0 +1,96 @@
+#include "AnalysisTap.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace SimpleSynth {
+namespace DSP {
+
+AnalysisTap::AnalysisTap()
+    : enabled_(false)
+    , outputRate_(kTargetRate)
+    , dropped_(0)
+    , active_(false)
+    , decimation_(1)
+    , numStages_(0)
+    , stages_{ { HalfBandDecimator(HalfBandDecimator::Order::Gentle),
+                 HalfBandDecimator(HalfBandDecimator::Order::Gentle),
+                 HalfBandDecimator(HalfBandDecimator::Order::Gentle),
+                 HalfBandDecimator(HalfBandDecimator::Order::Steep) } }
+    , staging_{}
+    , staged_(0)
+    , fill_(0)
+    , chunk_{}
+{
+    static_assert(kStagingSize % (size_t(1) << kMaxStages) == 0, "Staging must hold whole runs");
+}
+
+void AnalysisTap::Init(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+
+    // Nearest power of two: half-band stages only halve
+    const long stages = std::lround(std::log2(sampleRate / kTargetRate));
+    numStages_ = static_cast<size_t>(std::clamp(stages, 0L, static_cast<long>(kMaxStages)));
+    decimation_ = size_t(1) << numStages_;
+    outputRate_.store(sampleRate / static_cast<float>(decimation_), std::memory_order_relaxed);
+
+    // Restart the partial chunk at the new rate
+    active_ = false;
+}
+
+void AnalysisTap::Process(const float* input, size_t numSamples) {
+    if (! enabled_.load(std::memory_order_relaxed)) {
+        active_ = false;
+        return;
+    }
+
+    // A partial chunk left from before the tap was disabled is stale
+    if (! active_) {
+        active_ = true;
+        for (auto& stage : stages_) {
+            stage.Reset();
+        }
+        staged_ = 0;
+        fill_ = 0;
+    }
+
+    const size_t firstStage = kMaxStages - numStages_;
+
+    while (numSamples > 0) {
+        const size_t count = std::min(numSamples, kStagingSize - staged_);
+        std::copy(input, input + count, staging_.begin() + static_cast<std::ptrdiff_t>(staged_));
+        staged_ += count;
+        input += count;
+        numSamples -= count;
+
+        // Whole runs through the cascade, in place; a partial run waits
+        const size_t numOutput = staged_ >> numStages_;
+        size_t length = numOutput << numStages_;
+        for (size_t s = firstStage; s < kMaxStages; ++s) {
+            length /= 2;
+            stages_[s].Process(staging_.data(), staging_.data(), length);
+        }
+        Emit(staging_.data(), numOutput);
+
+        const size_t consumed = numOutput << numStages_;
+        std::copy(staging_.begin() + static_cast<std::ptrdiff_t>(consumed),
+                  staging_.begin() + static_cast<std::ptrdiff_t>(staged_), staging_.begin());
+        staged_ -= consumed;
+    }
+}
+
+void AnalysisTap::Emit(const float* samples, size_t numSamples) {
+    for (size_t i = 0; i < numSamples; ++i) {
+        chunk_.samples[fill_] = samples[i];
+
+        if (++fill_ == kChunkSize) {
+            if (! ring_.Push(chunk_)) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+            fill_ = 0;
+        }
+    }
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
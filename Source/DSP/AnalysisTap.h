@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Common.h"
+#include "Oversampler.h"
+#include "Util/SpscRing.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Analysis Tap
+ *
+ * Feeds the editor's oscilloscope and spectrum from the audio thread.
+ * The output is decimated by a power of two to about kTargetRate (plenty
+ * for a display) through a cascade of the oversampler's half-band
+ * decimators, so content above the new Nyquist is rejected rather than
+ * folded into the spectrum. It is handed over in fixed-size chunks
+ * through a wait-free SPSC ring; the editor pops them on its timer. A
+ * full ring drops the chunk and counts it, never blocks.
+ *
+ * The editor enables the tap while it is open. Disabled, Process() is a
+ * single relaxed atomic load; enabled, it is the half-band cascade (at
+ * most two steep stages' worth of allpasses per input sample) and a
+ * 256-byte copy per chunk.
+ *
+ * Threading: Process() on the audio thread, Pop() on one consumer
+ * thread, SetEnabled() from any thread. Init() must not run during
+ * Process().
+ */
+class AnalysisTap {
+public:
+    static constexpr size_t kChunkSize = 64;
+    static constexpr size_t kRingSize = 64;         // Chunks: ~170 ms at 24 kHz
+    static constexpr float kTargetRate = 24000.0f;
+    static constexpr size_t kMaxStages = 4;         // Up to 16:1 (384 kHz)
+
+    struct Chunk {
+        std::array<float, kChunkSize> samples;
+    };
+
+    AnalysisTap();
+    ~AnalysisTap() = default;
+
+    void Init(float sampleRate);
+
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Audio thread: decimate and queue a block (no-op while disabled)
+    void Process(const float* input, size_t numSamples);
+
+    // Consumer: the oldest queued chunk. Returns false when empty.
+    bool Pop(Chunk& chunk) { return ring_.Pop(chunk); }
+
+    // Rate of the samples in the chunks. Any thread.
+    float GetOutputRate() const { return outputRate_.load(std::memory_order_relaxed); }
+
+    // Chunks dropped on a full ring. Any thread.
+    uint32_t GetNumDropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    size_t GetDecimation() const { return decimation_; }
+
+private:
+    Util::SpscRing<Chunk, kRingSize> ring_;
+    std::atomic<bool> enabled_;
+    std::atomic<float> outputRate_;
+    std::atomic<uint32_t> dropped_;
+
+    static constexpr size_t kStagingSize = 256;     // A multiple of 2^kMaxStages
+
+    void Emit(const float* samples, size_t numSamples);
+
+    // Audio thread only
+    bool active_;            // Enabled on the previous Process()
+    size_t decimation_;      // Input samples per output sample: 2^numStages_
+    size_t numStages_;       // The last numStages_ of stages_ run
+    std::array<HalfBandDecimator, kMaxStages> stages_;  // Gentle..., Steep
+    std::array<float, kStagingSize> staging_;           // Decimated in place
+    size_t staged_;          // Input samples in staging_
+    size_t fill_;            // Output samples in chunk_
+    Chunk chunk_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 
 namespace SimpleSynth {
@@ -23,12 +24,23 @@ constexpr float kDenormalThreshold = 1e-15f;
 constexpr int kMidiA4 = 69;
 constexpr float kA4Frequency = 440.0f;
 
+// 2^(k/12) for k = 0..11
+inline constexpr float kSemitoneRatios[12] = {
+    1.0f,          1.0594630944f, 1.1224620483f, 1.1892071150f,
+    1.2599210499f, 1.3348398542f, 1.4142135624f, 1.4983070769f,
+    1.5874010520f, 1.6817928305f, 1.7817974363f, 1.8877486254f
+};
+
 /**
  * Convert MIDI note number to frequency in Hz.
- * Uses equal temperament tuning: f = 440 * 2^((n-69)/12)
+ * Uses equal temperament tuning: f = 440 * 2^((n-69)/12), as a semitone
+ * table lookup and a power-of-two scale instead of pow().
+ * See Tuning for other temperaments.
  */
 inline float MidiNoteToFrequency(int midiNote) {
-    return kA4Frequency * std::pow(2.0f, (midiNote - kMidiA4) / 12.0f);
+    // Offset by ten octaves so the division and modulo see positive values
+    const int semitones = midiNote - kMidiA4 + 120;
+    return std::ldexp(kA4Frequency * kSemitoneRatios[semitones % 12], semitones / 12 - 10);
 }
 
 /**
@@ -57,6 +69,45 @@ inline float Lerp(float a, float b, float t) {
     return a + t * (b - a);
 }
 
+/**
+ * Rational tanh approximation for saturation stages.
+ * Pade-style x(27 + x^2) / (27 + 9x^2), hard-limited to +/-1 beyond |x| = 3
+ * where the curve meets the asymptote. No transcendental calls, so
+ * loops over it vectorize.
+ */
+inline float FastTanh(float x) {
+    x = Clamp(x, -3.0f, 3.0f);
+    float x2 = x * x;
+    return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+}
+
+/**
+ * Rational tan approximation for filter coefficients, x in [0, 1.4]
+ * (cutoffs up to 0.45 of the sample rate).
+ * Pade x(945 - 105x^2 + x^4) / (945 - 420x^2 + 15x^4): relative error
+ * below 3e-5 there, against a tan() call per coefficient update.
+ */
+inline float FastTan(float x) {
+    float x2 = x * x;
+    return x * (945.0f - 105.0f * x2 + x2 * x2) / (945.0f - 420.0f * x2 + 15.0f * x2 * x2);
+}
+
+/**
+ * PolyBLEP residual for a unit step at phase 0.
+ * t: normalized phase [0, 1), dt: phase increment per sample.
+ * Add (rising edge) or subtract (falling edge) to a naive waveform.
+ */
+inline float PolyBLEP(float t, float dt) {
+    if (t < dt) {
+        t /= dt;
+        return t + t - t * t - 1.0f;
+    } else if (t > 1.0f - dt) {
+        t = (t - 1.0f) / dt;
+        return t * t + t + t + 1.0f;
+    }
+    return 0.0f;
+}
+
 /**
  * Wrap a phase value to the range [0, 1).
  */
@@ -64,5 +115,35 @@ inline float WrapPhase(float phase) {
     return phase - std::floor(phase);
 }
 
+/**
+ * Seeded xorshift32 noise source. Deterministic per seed, no shared
+ * state, no locks (unlike rand(), which takes a libc lock).
+ */
+class XorShift32 {
+public:
+    explicit XorShift32(uint32_t seed = 0x2545F491u) { SetSeed(seed); }
+
+    // Zero is the one state xorshift can't leave
+    void SetSeed(uint32_t seed) { state_ = (seed != 0) ? seed : 0x2545F491u; }
+
+    uint32_t Next() {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_;
+    }
+
+    /**
+     * Uniform float in [-1, 1).
+     */
+    float NextBipolar() {
+        // Top 24 bits -> [0, 1) exactly representable in a float
+        return static_cast<float>(Next() >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    }
+
+private:
+    uint32_t state_;
+};
+
 } // namespace DSP
 } // namespace SimpleSynth
@@ -9,13 +9,21 @@ namespace DSP {
 DubDelay::DubDelay()
     : sampleRate_(44100.0f)
     , bufferSize_(0)
+    , bufferMask_(0)
+    , maxDelaySamples_(0.0f)
     , writeIndex_(0)
     , delayTimeSeconds_(0.25f)
     , feedback_(0.5f)
     , wetDry_(0.3f)
+    , numTaps_(1)
+    , feedbackScale_(1.0f)
+    , tapeEnabled_(false)
+    , interpolation_(Interpolation::None)
     , wobblePhase_(0.0f)
     , wobbleAmount_(0.0005f)
 {
+    taps_.fill(Tap{ 0.25f, 0.0f, 0.0f });
+    taps_[0] = Tap{ delayTimeSeconds_, 1.0f, feedback_ };
 }
 
 void DubDelay::Init(float sampleRate, float maxDelayTimeSeconds) {
@@ -23,9 +31,18 @@ void DubDelay::Init(float sampleRate, float maxDelayTimeSeconds) {
     assert(maxDelayTimeSeconds > 0.0f && "Max delay time must be positive");
 
     sampleRate_ = sampleRate;
-    bufferSize_ = static_cast<size_t>(sampleRate * maxDelayTimeSeconds);
+
+    // Round up to a power of two so read/write wrapping is a single mask
+    size_t requiredSize = static_cast<size_t>(sampleRate * maxDelayTimeSeconds);
+    bufferSize_ = 1;
+    while (bufferSize_ < requiredSize) {
+        bufferSize_ <<= 1;
+    }
+    bufferMask_ = bufferSize_ - 1;
+    maxDelaySamples_ = static_cast<float>(bufferSize_ - 3);
 
     delayBuffer_.resize(bufferSize_);
+    tape_.Init(sampleRate);
     Reset();
 }
 
@@ -41,36 +58,123 @@ void DubDelay::SetWetDry(float wetDry) {
     wetDry_ = Clamp(wetDry, 0.0f, 1.0f);
 }
 
+void DubDelay::SetNumTaps(size_t numTaps) {
+    numTaps_ = Clamp(numTaps, size_t(1), kMaxTaps);
+    UpdateFeedbackScale();
+}
+
+void DubDelay::SetTap(size_t index, float timeSeconds, float gain, float feedback) {
+    assert(index < kMaxTaps && "Tap index out of range");
+    if (index >= kMaxTaps) return;
+
+    taps_[index].timeSeconds = Clamp(timeSeconds, 0.001f, 2.0f);
+    taps_[index].gain = Clamp(gain, 0.0f, 1.0f);
+    taps_[index].feedback = Clamp(feedback, 0.0f, 0.95f);
+    UpdateFeedbackScale();
+}
+
+void DubDelay::UpdateFeedbackScale() {
+    // Keep the summed loop gain below the single-head limit; only active
+    // heads count, whatever inactive ones were last set to
+    float totalFeedback = 0.0f;
+    for (size_t t = 0; t < numTaps_; ++t) {
+        totalFeedback += taps_[t].feedback;
+    }
+    feedbackScale_ = (totalFeedback > 0.95f) ? 0.95f / totalFeedback : 1.0f;
+}
+
+void DubDelay::SetTapeEnabled(bool enabled) {
+    if (enabled && !tapeEnabled_) {
+        tape_.Reset();
+    }
+    tapeEnabled_ = enabled;
+}
+
+void DubDelay::SetTapeTone(float lowCutHz, float highCutHz) {
+    tape_.SetLowCut(lowCutHz);
+    tape_.SetHighCut(highCutHz);
+}
+
+void DubDelay::SetTapeDrive(float drive) {
+    tape_.SetDrive(drive);
+}
+
 void DubDelay::Reset() {
     std::fill(delayBuffer_.begin(), delayBuffer_.end(), 0.0f);
     writeIndex_ = 0;
     wobblePhase_ = 0.0f;
+    tape_.Reset();
 }
 
-float DubDelay::ProcessSample(float input) {
-    if (bufferSize_ == 0) return input;
+void DubDelay::SetInterpolation(Interpolation interpolation) {
+    interpolation_ = interpolation;
+}
+
+float DubDelay::ReadHead(size_t position, float delaySamples) const {
+    // delaySamples = whole + fraction; older samples sit further behind
+    size_t whole = static_cast<size_t>(delaySamples);
+    size_t index = position - whole;
+
+    switch (interpolation_) {
+        case Interpolation::None:
+            return delayBuffer_[index & bufferMask_];
+
+        case Interpolation::Linear: {
+            float fraction = delaySamples - static_cast<float>(whole);
+            float y0 = delayBuffer_[index & bufferMask_];
+            float y1 = delayBuffer_[(index - 1) & bufferMask_];
+            return y0 + fraction * (y1 - y0);
+        }
+
+        case Interpolation::Cubic: {
+            // 4-point Hermite around the read position
+            float fraction = delaySamples - static_cast<float>(whole);
+            float ym1 = delayBuffer_[(index + 1) & bufferMask_];
+            float y0 = delayBuffer_[index & bufferMask_];
+            float y1 = delayBuffer_[(index - 1) & bufferMask_];
+            float y2 = delayBuffer_[(index - 2) & bufferMask_];
 
+            float c1 = 0.5f * (y1 - ym1);
+            float c2 = ym1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+            float c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+            return ((c3 * fraction + c2) * fraction + c1) * fraction + y0;
+        }
+    }
+
+    return 0.0f;
+}
+
+float DubDelay::NextWobble() {
     // Add subtle analog wobble to delay time
     wobblePhase_ += 0.0003f;
-    float wobble = std::sin(wobblePhase_ * kTwoPi) * wobbleAmount_;
+    return std::sin(wobblePhase_ * kTwoPi) * wobbleAmount_;
+}
 
-    float modulatedDelayTime = delayTimeSeconds_ * (1.0f + wobble);
-    modulatedDelayTime = Clamp(modulatedDelayTime, 0.001f, 2.0f);
+float DubDelay::ProcessSample(float input) {
+    if (bufferSize_ == 0) return input;
+
+    if (numTaps_ > 1) {
+        return ProcessMultiTapSample(input);
+    }
 
-    // Calculate read position
-    size_t delaySamples = static_cast<size_t>(modulatedDelayTime * sampleRate_);
-    delaySamples = std::min(delaySamples, bufferSize_ - 1);
+    float wobble = NextWobble();
 
-    size_t readIndex = (writeIndex_ + bufferSize_ - delaySamples) % bufferSize_;
+    float modulatedDelayTime = delayTimeSeconds_ * (1.0f + wobble);
+    modulatedDelayTime = Clamp(modulatedDelayTime, 0.001f, 2.0f);
 
     // Read delayed sample
-    float delayedSample = delayBuffer_[readIndex];
+    float delaySamples = Clamp(modulatedDelayTime * sampleRate_, kMinDelaySamples, maxDelaySamples_);
+    float delayedSample = ReadHead(writeIndex_, delaySamples);
 
     // Write new sample with feedback
-    delayBuffer_[writeIndex_] = input + (delayedSample * feedback_);
+    float feedbackSample = delayedSample * feedback_;
+    if (tapeEnabled_) {
+        feedbackSample = tape_.ProcessSample(feedbackSample);
+    }
+    delayBuffer_[writeIndex_] = input + feedbackSample;
 
     // Advance write pointer
-    writeIndex_ = (writeIndex_ + 1) % bufferSize_;
+    writeIndex_ = (writeIndex_ + 1) & bufferMask_;
 
     // Mix wet/dry
     float dryLevel = 1.0f - wetDry_;
@@ -79,11 +183,108 @@ float DubDelay::ProcessSample(float input) {
     return (input * dryLevel) + (delayedSample * wetLevel);
 }
 
+float DubDelay::ProcessMultiTapSample(float input) {
+    // One wobble value moves all heads together, like a shared tape path
+    float wobbleScale = 1.0f + NextWobble();
+
+    float wet = 0.0f;
+    float feedbackSum = 0.0f;
+
+    for (size_t t = 0; t < numTaps_; ++t) {
+        const Tap& tap = taps_[t];
+
+        float delaySamples = Clamp(tap.timeSeconds * wobbleScale * sampleRate_,
+                                   kMinDelaySamples, maxDelaySamples_);
+        float headSample = ReadHead(writeIndex_, delaySamples);
+        wet += headSample * tap.gain;
+        feedbackSum += headSample * tap.feedback;
+    }
+
+    float feedbackSample = feedbackSum * feedbackScale_;
+    if (tapeEnabled_) {
+        feedbackSample = tape_.ProcessSample(feedbackSample);
+    }
+    delayBuffer_[writeIndex_] = input + feedbackSample;
+    writeIndex_ = (writeIndex_ + 1) & bufferMask_;
+
+    return (input * (1.0f - wetDry_)) + (wet * wetDry_);
+}
+
 void DubDelay::Process(float* buffer, size_t numSamples) {
     assert(buffer != nullptr && "Buffer cannot be null");
 
-    for (size_t i = 0; i < numSamples; ++i) {
-        buffer[i] = ProcessSample(buffer[i]);
+    if (bufferSize_ == 0) return;
+
+    // Hoist per-head constants out of the sample loop. Single-head mode
+    // is the same loop with one head at full gain.
+    std::array<float, kMaxTaps> headSamples{};
+    std::array<float, kMaxTaps> headGains{};
+    std::array<float, kMaxTaps> headFeedback{};
+    const size_t numHeads = numTaps_;
+
+    if (numHeads == 1) {
+        headSamples[0] = delayTimeSeconds_ * sampleRate_;
+        headGains[0] = wetDry_;
+        headFeedback[0] = feedback_;
+    } else {
+        for (size_t t = 0; t < numHeads; ++t) {
+            headSamples[t] = taps_[t].timeSeconds * sampleRate_;
+            headGains[t] = taps_[t].gain * wetDry_;
+            headFeedback[t] = taps_[t].feedback * feedbackScale_;
+        }
+    }
+
+    const float dryLevel = 1.0f - wetDry_;
+
+    // Nothing written inside a chunk can be read back inside the same
+    // chunk while the chunk is shorter than the shortest head, so the
+    // loop can be split into read -> tape chain -> write passes.
+    float shortestHead = maxDelaySamples_;
+    for (size_t t = 0; t < numHeads; ++t) {
+        shortestHead = std::min(shortestHead, headSamples[t]);
+    }
+    // (the cubic read looks one sample newer than the head, hence the margin)
+    const float safeRun = std::max(shortestHead * (1.0f - wobbleAmount_) - 2.0f, 1.0f);
+    const size_t maxChunk = std::min(static_cast<size_t>(safeRun), kDelayChunkSize);
+
+    std::array<float, kDelayChunkSize> wet;
+    std::array<float, kDelayChunkSize> feedback;
+
+    size_t offset = 0;
+    while (offset < numSamples) {
+        const size_t chunk = std::min(maxChunk, numSamples - offset);
+
+        // Read all heads from the shared line in one pass
+        for (size_t i = 0; i < chunk; ++i) {
+            float wobbleScale = 1.0f + NextWobble();
+            size_t position = writeIndex_ + i;
+            float wetSum = 0.0f;
+            float feedbackSum = 0.0f;
+
+            for (size_t t = 0; t < numHeads; ++t) {
+                float delay = Clamp(headSamples[t] * wobbleScale, kMinDelaySamples, maxDelaySamples_);
+                float headSample = ReadHead(position, delay);
+                wetSum += headSample * headGains[t];
+                feedbackSum += headSample * headFeedback[t];
+            }
+
+            wet[i] = wetSum;
+            feedback[i] = feedbackSum;
+        }
+
+        if (tapeEnabled_) {
+            tape_.Process(feedback.data(), chunk);
+        }
+
+        // Record head and output mix
+        for (size_t i = 0; i < chunk; ++i) {
+            float input = buffer[offset + i];
+            delayBuffer_[(writeIndex_ + i) & bufferMask_] = input + feedback[i];
+            buffer[offset + i] = (input * dryLevel) + wet[i];
+        }
+
+        writeIndex_ = (writeIndex_ + chunk) & bufferMask_;
+        offset += chunk;
     }
 }
 
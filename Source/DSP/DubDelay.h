@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Common.h"
+#include "TapeFeedback.h"
+#include <array>
 #include <vector>
 
 namespace SimpleSynth {
@@ -12,9 +14,29 @@ namespace DSP {
  * Classic reggae-style delay with analog character.
  * Circular buffer implementation with feedback and wet/dry mix.
  * Adds slight instability for organic feel.
+ *
+ * Multi-tap mode emulates a tape echo with several playback heads.
+ * All heads share the same delay line and are read in a single pass
+ * per block, so memory stays that of one delay and cost grows only
+ * by one buffer read per extra head.
+ *
+ * An optional tape chain (TapeFeedback) colors the feedback path.
+ * The block path processes the loop in chunks no longer than the
+ * shortest head, so the chain runs over whole chunks instead of
+ * being called once per sample.
  */
 class DubDelay {
 public:
+    // Maximum number of playback heads sharing the delay line
+    static constexpr size_t kMaxTaps = 4;
+
+    // Read-head interpolation, cheapest first
+    enum class Interpolation {
+        None,   // Truncate to whole samples (classic, zipper on time changes)
+        Linear,
+        Cubic   // 4-point Hermite
+    };
+
     DubDelay();
     ~DubDelay() = default;
 
@@ -24,19 +46,82 @@ public:
     void SetWetDry(float wetDry); // 0.0 = dry, 1.0 = wet
     void Reset();
 
+    /**
+     * Set number of active playback heads (1 to kMaxTaps).
+     * 1 = classic single-head delay driven by SetDelayTime/SetFeedback.
+     */
+    void SetNumTaps(size_t numTaps);
+
+    /**
+     * Configure a playback head for multi-tap mode.
+     * timeSeconds: Head position behind the write head
+     * gain: Head level in the wet signal (0.0 to 1.0)
+     * feedback: Head contribution to the record head (0.0 to 0.95)
+     *
+     * The summed feedback of all active heads is limited to 0.95
+     * so the loop cannot run away.
+     */
+    void SetTap(size_t index, float timeSeconds, float gain, float feedback);
+
+    /**
+     * Enable the tape coloration chain in the feedback path.
+     * Disabled = plain multiply, identical to the classic delay.
+     */
+    void SetTapeEnabled(bool enabled);
+    void SetTapeTone(float lowCutHz, float highCutHz);
+    void SetTapeDrive(float drive);
+
+    void SetInterpolation(Interpolation interpolation);
+
     float ProcessSample(float input);
     void Process(float* buffer, size_t numSamples);
 
+    // Getters for testing
+    size_t GetNumTaps() const { return numTaps_; }
+    size_t GetBufferSize() const { return bufferSize_; }
+    bool IsTapeEnabled() const { return tapeEnabled_; }
+    Interpolation GetInterpolation() const { return interpolation_; }
+
 private:
+    struct Tap {
+        float timeSeconds;
+        float gain;
+        float feedback;
+    };
+
+    // Longest run of samples processed per block-path pass
+    static constexpr size_t kDelayChunkSize = 64;
+
+    // Shortest head, leaves room for the cubic read's newer neighbour
+    static constexpr float kMinDelaySamples = 2.0f;
+
+    void UpdateFeedbackScale();
+    float ReadHead(size_t position, float delaySamples) const;
+    float ProcessMultiTapSample(float input);
+    float NextWobble();
+
     float sampleRate_;
     std::vector<float> delayBuffer_;
-    size_t bufferSize_;
+    size_t bufferSize_;     // Power of two so wrapping is a mask
+    size_t bufferMask_;
+    float maxDelaySamples_; // Longest head, leaves room for cubic neighbours
     size_t writeIndex_;
 
     float delayTimeSeconds_;
     float feedback_;
     float wetDry_;
 
+    // Playback heads (multi-tap mode)
+    std::array<Tap, kMaxTaps> taps_;
+    size_t numTaps_;
+    float feedbackScale_;   // Normalizes summed head feedback to 0.95
+
+    // Feedback coloration
+    TapeFeedback tape_;
+    bool tapeEnabled_;
+
+    Interpolation interpolation_;
+
     // Analog instability
     float wobblePhase_;
     float wobbleAmount_;
@@ -11,8 +11,11 @@ DubOscillator::DubOscillator()
     , level_(0.8f)
     , phase_(0.0f)
     , phaseIncrement_(0.0f)
+    , bandLimited_(false)
     , driftPhase_(0.0f)
     , driftAmount_(0.002f) // Subtle analog drift
+    , noise_()
+    , noiseSeed_(0x2545F491u)
 {
 }
 
@@ -22,6 +25,13 @@ void DubOscillator::Init(float sampleRate) {
     phaseIncrement_ = frequency_ / sampleRate_;
     phase_ = 0.0f;
     driftPhase_ = 0.0f;
+    noise_.SetSeed(noiseSeed_);
+}
+
+void DubOscillator::SetSampleRate(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+    phaseIncrement_ = frequency_ / sampleRate_;
 }
 
 void DubOscillator::SetFrequency(float frequency) {
@@ -33,6 +43,15 @@ void DubOscillator::SetLevel(float level) {
     level_ = Clamp(level, 0.0f, 1.0f);
 }
 
+void DubOscillator::SetBandLimited(bool bandLimited) {
+    bandLimited_ = bandLimited;
+}
+
+void DubOscillator::SetNoiseSeed(uint32_t seed) {
+    noiseSeed_ = seed;
+    noise_.SetSeed(seed);
+}
+
 void DubOscillator::Reset() {
     phase_ = 0.0f;
     driftPhase_ = 0.0f;
@@ -49,8 +68,13 @@ float DubOscillator::GenerateSquareWave() {
     // Square wave with slight softening
     float square = (modPhase < 0.5f) ? 1.0f : -1.0f;
 
+    if (bandLimited_) {
+        square += PolyBLEP(modPhase, phaseIncrement_);
+        square -= PolyBLEP(WrapPhase(modPhase + 0.5f), phaseIncrement_);
+    }
+
     // Add tiny bit of noise for analog character
-    float noise = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.01f;
+    float noise = noise_.NextBipolar() * 0.005f;
 
     return (square + noise) * level_;
 }
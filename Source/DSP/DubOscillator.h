@@ -10,6 +10,9 @@ namespace DSP {
  *
  * Classic gritty square wave with analog character.
  * Generates the main siren tone with slight harmonic instability.
+ *
+ * Band-limited mode applies PolyBLEP at both square edges; the naive
+ * square is cheaper and relies on oversampling to control aliasing.
  */
 class DubOscillator {
 public:
@@ -17,8 +20,11 @@ public:
     ~DubOscillator() = default;
 
     void Init(float sampleRate);
+    void SetSampleRate(float sampleRate); // Keeps phase, for oversampling changes
     void SetFrequency(float frequency);
     void SetLevel(float level); // 0.0 to 1.0
+    void SetBandLimited(bool bandLimited);
+    void SetNoiseSeed(uint32_t seed); // Noise restarts from the seed on Init()
     void Reset();
 
     float ProcessSample();
@@ -32,10 +38,15 @@ private:
     float level_;
     float phase_;
     float phaseIncrement_;
+    bool bandLimited_;
 
     // Analog drift simulation
     float driftPhase_;
     float driftAmount_;
+
+    // Per-instance noise, reproducible for a given seed
+    XorShift32 noise_;
+    uint32_t noiseSeed_;
 };
 
 } // namespace DSP
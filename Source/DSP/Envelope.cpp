@@ -22,15 +22,27 @@ Envelope::Envelope()
 }
 
 void Envelope::Init(float sampleRate) {
+    SetSampleRate(sampleRate);
+    Reset();
+}
+
+void Envelope::SetSampleRate(float sampleRate) {
     assert(sampleRate > 0.0f && "Sample rate must be positive");
+
+    // Convert sample counts via the previous rate so times in ms are kept
+    const float previousRate = sampleRate_;
     sampleRate_ = sampleRate;
 
-    // Recalculate all time-based parameters
-    attackSamples_ = MsToSamples(attackSamples_ * 1000.0f / sampleRate_);
-    decaySamples_ = MsToSamples(decaySamples_ * 1000.0f / sampleRate_);
-    releaseSamples_ = MsToSamples(releaseSamples_ * 1000.0f / sampleRate_);
+    attackSamples_ = MsToSamples(attackSamples_ * 1000.0f / previousRate);
+    decaySamples_ = MsToSamples(decaySamples_ * 1000.0f / previousRate);
+    releaseSamples_ = MsToSamples(releaseSamples_ * 1000.0f / previousRate);
 
-    Reset();
+    // Keep a running stage at the same relative position
+    const float ratio = sampleRate_ / previousRate;
+    sampleCounter_ = static_cast<size_t>(static_cast<float>(sampleCounter_) * ratio);
+    attackIncrement_ /= ratio;
+    decayIncrement_ /= ratio;
+    releaseIncrement_ /= ratio;
 }
 
 void Envelope::SetParameters(float attackMs, float decayMs,
@@ -39,6 +39,13 @@ public:
      */
     void Init(float sampleRate);
 
+    /**
+     * Change sample rate without resetting the current stage.
+     * Stage times in milliseconds are preserved, so a running note
+     * continues smoothly (used when the oversampling factor changes).
+     */
+    void SetSampleRate(float sampleRate);
+
     /**
      * Set ADSR parameters.
      * attackMs: Attack time in milliseconds
@@ -0,0 +1,212 @@
+#include "FdnReverb.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace SimpleSynth {
+namespace DSP {
+
+namespace {
+
+constexpr size_t kNumLines = FdnReverb::kNumLines;
+
+// Line lengths at size 1, in ms: spread over 2.6:1 with no common
+// factors between neighbours, so the modes don't pile up
+constexpr float kLineMilliseconds[kNumLines] = {
+    22.7f, 27.1f, 31.9f, 36.7f, 41.3f, 47.3f, 53.1f, 59.9f
+};
+
+// Size 0 shortens every line to this fraction (spring/plate density)
+constexpr float kMinSizeScale = 0.25f;
+
+// Input spread into the lines (gain 0.75) and output taps, with signs
+// mixed so the wet signal doesn't start as a copy of the input
+constexpr float kInputTaps[kNumLines] = { 0.75f, -0.75f, 0.75f, 0.75f, -0.75f, 0.75f, -0.75f, -0.75f };
+constexpr float kOutputSigns[kNumLines] = { 1.0f, 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f };
+constexpr float kOutputGain = 0.35355339f;    // 1/sqrt(8)
+
+// Damping low-pass cutoff: bright at 0, dark at 1
+constexpr float kBrightCutoff = 16000.0f;
+constexpr float kDarkCutoffRatio = 0.05f;
+
+/**
+ * One stage of the fast Walsh-Hadamard transform in constant geometry:
+ * neighbouring lanes form butterflies (a + b, a - b), sums to the low
+ * half and differences to the high half. Applied log2(8) = 3 times it is
+ * the 8x8 Hadamard matrix, and every stage is the same two 4-wide
+ * operations on the even and odd lanes.
+ */
+inline void HadamardStage(const std::array<float, kNumLines>& x, std::array<float, kNumLines>& y) {
+    constexpr size_t kHalf = kNumLines / 2;
+    for (size_t i = 0; i < kHalf; ++i) {
+        y[i] = x[2 * i] + x[2 * i + 1];
+        y[i + kHalf] = x[2 * i] - x[2 * i + 1];
+    }
+}
+
+} // namespace
+
+FdnReverb::FdnReverb()
+    : sampleRate_(44100.0f)
+    , size_(0.5f)
+    , decay_(2.0f)
+    , damping_(0.4f)
+    , mix_(0.0f)
+    , ringSize_(0)
+    , ringMask_(0)
+    , writeIndex_(0)
+    , lengths_{}
+    , gains_{}
+    , lowpass_{}
+    , dampingCoeff_(1.0f)
+    , active_(false)
+{
+}
+
+void FdnReverb::Init(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+
+    const auto maxLength = static_cast<size_t>(std::ceil(kMaxLineSeconds * sampleRate)) + 1;
+    ringSize_ = 1;
+    while (ringSize_ < maxLength) {
+        ringSize_ <<= 1;
+    }
+    ringMask_ = static_cast<uint32_t>(ringSize_ - 1);
+    lines_.assign(ringSize_ * kNumLines, 0.0f);
+
+    UpdateLengths();
+    UpdateDamping();
+    Reset();
+}
+
+void FdnReverb::Reset() {
+    std::fill(lines_.begin(), lines_.end(), 0.0f);
+    lowpass_.fill(0.0f);
+    writeIndex_ = 0;
+}
+
+void FdnReverb::SetSize(float size) {
+    size = Clamp(size, 0.0f, 1.0f);
+    if (size == size_) return;
+    size_ = size;
+    UpdateLengths();
+}
+
+void FdnReverb::SetDecay(float seconds) {
+    seconds = Clamp(seconds, 0.1f, 20.0f);
+    if (seconds == decay_) return;
+    decay_ = seconds;
+    UpdateGains();
+}
+
+void FdnReverb::SetDamping(float damping) {
+    damping = Clamp(damping, 0.0f, 1.0f);
+    if (damping == damping_) return;
+    damping_ = damping;
+    UpdateDamping();
+}
+
+void FdnReverb::SetMix(float mix) {
+    mix_ = Clamp(mix, 0.0f, 1.0f);
+}
+
+void FdnReverb::UpdateLengths() {
+    if (ringSize_ == 0) return;
+
+    const float scale = Lerp(kMinSizeScale, 1.0f, size_) * sampleRate_ * 0.001f;
+    for (size_t i = 0; i < kNumLines; ++i) {
+        const auto length = static_cast<uint32_t>(std::lround(kLineMilliseconds[i] * scale));
+        lengths_[i] = std::min(std::max(length, 1u), ringMask_);
+    }
+    UpdateGains();
+}
+
+void FdnReverb::UpdateGains() {
+    // -60 dB after decay_ seconds: each pass through a line of n samples
+    // loses 60 dB * n / (decay_ * sampleRate_). The Hadamard stages scale
+    // by sqrt(8), undone here so the matrix itself is lossless.
+    for (size_t i = 0; i < kNumLines; ++i) {
+        const float passes = decay_ * sampleRate_ / static_cast<float>(lengths_[i]);
+        gains_[i] = std::pow(10.0f, -3.0f / passes) * kOutputGain;
+    }
+}
+
+void FdnReverb::UpdateDamping() {
+    const float cutoff = std::min(kBrightCutoff * std::pow(kDarkCutoffRatio, damping_), sampleRate_ * 0.45f);
+    dampingCoeff_ = 1.0f - std::exp(-kTwoPi * cutoff / sampleRate_);
+}
+
+float FdnReverb::ProcessSample(float input) {
+    Render(&input, 1);
+    return input;
+}
+
+void FdnReverb::Process(float* buffer, size_t numSamples) {
+    assert(buffer != nullptr && "Buffer cannot be null");
+
+    // Bypassed
+    if (mix_ <= 0.0f || lines_.empty()) {
+        active_ = false;
+        return;
+    }
+    if (! active_) {
+        Reset();
+        active_ = true;
+    }
+
+    Render(buffer, numSamples);
+}
+
+void FdnReverb::Render(float* buffer, size_t numSamples) {
+    if (lines_.empty()) return;
+
+    float* const lines = lines_.data();
+    const uint32_t mask = ringMask_;
+    const float coeff = dampingCoeff_;
+    const float dry = 1.0f - mix_;
+    const float wetGain = kOutputGain * mix_;
+    uint32_t writeIndex = writeIndex_;
+
+    alignas(32) Lanes x;
+    alignas(32) Lanes y;
+
+    for (size_t n = 0; n < numSamples; ++n) {
+        const float input = buffer[n];
+
+        // The only scalar step: each line is read at its own delay
+        for (size_t i = 0; i < kNumLines; ++i) {
+            x[i] = lines[static_cast<size_t>((writeIndex - lengths_[i]) & mask) * kNumLines + i];
+        }
+
+        float wet = 0.0f;
+        for (size_t i = 0; i < kNumLines; ++i) {
+            wet += x[i] * kOutputSigns[i];
+        }
+
+        // Damping and decay, lane-wise
+        for (size_t i = 0; i < kNumLines; ++i) {
+            lowpass_[i] += coeff * (x[i] - lowpass_[i]);
+            x[i] = lowpass_[i] * gains_[i];
+        }
+
+        HadamardStage(x, y);
+        HadamardStage(y, x);
+
+        // Last stage straight into the lines, all eight written together
+        constexpr size_t kHalf = kNumLines / 2;
+        float* write = lines + static_cast<size_t>(writeIndex) * kNumLines;
+        for (size_t i = 0; i < kHalf; ++i) {
+            write[i] = x[2 * i] + x[2 * i + 1] + input * kInputTaps[i];
+            write[i + kHalf] = x[2 * i] - x[2 * i + 1] + input * kInputTaps[i + kHalf];
+        }
+        writeIndex = (writeIndex + 1) & mask;
+
+        buffer[n] = input * dry + wet * wetGain;
+    }
+
+    writeIndex_ = writeIndex;
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
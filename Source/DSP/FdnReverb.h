@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Common.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Feedback Delay Network Reverb
+ *
+ * Eight delay lines fed back through an 8x8 Hadamard matrix: a dense,
+ * lossless mix, so the tail builds up fast and decays evenly. Small
+ * sizes give the short, metallic density of a spring or plate; larger
+ * ones open up into a room.
+ *
+ * The eight lines are eight SIMD lanes. Their samples are interleaved
+ * in one buffer, so the write of all lines is a single 8-float store;
+ * damping, decay and input injection are lane-wise multiply-adds; and
+ * the matrix is the fast Walsh-Hadamard transform, three identical
+ * butterfly stages of one add and one subtract on the even and odd
+ * lanes. All of these are fixed-length loops the compiler vectorizes
+ * (two SSE/NEON registers, or one AVX). Only the eight reads, at
+ * different delays, stay scalar.
+ *
+ * Line lengths are whole samples in a power-of-two ring, so wrapping is
+ * a mask. Each line has a one-pole low-pass (damping) and a gain that
+ * gives the set decay time (RT60) for its length.
+ *
+ * A mix of 0 bypasses it (README: Signal Chain).
+ */
+class FdnReverb {
+public:
+    static constexpr size_t kNumLines = 8;
+
+    // Longest line at size 1; the ring is sized for it
+    static constexpr float kMaxLineSeconds = 0.064f;
+
+    FdnReverb();
+    ~FdnReverb() = default;
+
+    void Init(float sampleRate);
+    void Reset();
+
+    void SetSize(float size);       // 0 (spring/plate) to 1 (room); jumps the line lengths
+    void SetDecay(float seconds);   // RT60, 0.1 to 20
+    void SetDamping(float damping); // 0 = bright to 1 = dark
+    void SetMix(float mix);         // 0 = dry (bypassed) to 1 = wet only
+
+    float ProcessSample(float input);
+    void Process(float* buffer, size_t numSamples);
+
+    // Getters for testing
+    size_t GetRingSize() const { return ringSize_; }
+    uint32_t GetLineLength(size_t line) const { return lengths_[line]; }
+    float GetLineGain(size_t line) const { return gains_[line]; }
+    bool IsActive() const { return active_; }
+
+private:
+    using Lanes = std::array<float, kNumLines>;
+
+    void Render(float* buffer, size_t numSamples);
+    void UpdateLengths();
+    void UpdateGains();
+    void UpdateDamping();
+
+    float sampleRate_;
+    float size_;
+    float decay_;
+    float damping_;
+    float mix_;
+
+    // Line samples interleaved: ring position p of line i at p * kNumLines + i
+    std::vector<float> lines_;
+    size_t ringSize_;       // Positions, power of two
+    uint32_t ringMask_;
+    uint32_t writeIndex_;
+
+    alignas(32) std::array<uint32_t, kNumLines> lengths_;
+    alignas(32) Lanes gains_;       // Decay per line, with the matrix's 1/sqrt(8)
+    alignas(32) Lanes lowpass_;     // Damping state
+    float dampingCoeff_;
+
+    bool active_;           // Not bypassed last block
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,125 @@
+#include "Fft.h"
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace SimpleSynth {
+namespace DSP {
+
+Fft::Fft()
+    : size_(0)
+{
+}
+
+void Fft::Init(size_t size) {
+    assert(size >= 2 && (size & (size - 1)) == 0 && "FFT size must be a power of two");
+    size_ = size;
+
+    size_t bits = 0;
+    while ((static_cast<size_t>(1) << bits) < size) {
+        ++bits;
+    }
+
+    // Bit-reversal as the list of pairs to swap, so the permutation has
+    // no branches
+    swaps_.clear();
+    for (size_t i = 0; i < size; ++i) {
+        size_t reversed = 0;
+        for (size_t b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        if (reversed > i) {
+            swaps_.push_back({ static_cast<uint32_t>(i), static_cast<uint32_t>(reversed) });
+        }
+    }
+
+    // Twiddles per pass, cos/sin interleaved in one table so the butterfly
+    // loop reads them in step with the data: the pass with span s holds
+    // e^(-i pi k / s), k < s, from offset 2 (s - 1). Computed in double so
+    // large sizes stay accurate.
+    twiddles_.resize(2 * (size - 1));
+    for (size_t span = 1; span < size; span <<= 1) {
+        for (size_t k = 0; k < span; ++k) {
+            const double angle = 3.14159265358979323846 * static_cast<double>(k) / static_cast<double>(span);
+            twiddles_[2 * (span - 1 + k)] = static_cast<float>(std::cos(angle));
+            twiddles_[2 * (span - 1 + k) + 1] = static_cast<float>(std::sin(angle));
+        }
+    }
+}
+
+void Fft::Forward(float* real, float* imag) const {
+    Transform(real, imag, -1.0f);
+}
+
+void Fft::Inverse(float* real, float* imag) const {
+    Transform(real, imag, 1.0f);
+
+    const float scale = 1.0f / static_cast<float>(size_);
+    for (size_t i = 0; i < size_; ++i) {
+        real[i] *= scale;
+        imag[i] *= scale;
+    }
+}
+
+void Fft::Transform(float* real, float* imag, float direction) const {
+    assert(size_ > 0 && "Fft::Init() not called");
+    assert(real != nullptr && imag != nullptr && "Buffers cannot be null");
+
+    for (const auto& swap : swaps_) {
+        std::swap(real[swap.first], real[swap.second]);
+        std::swap(imag[swap.first], imag[swap.second]);
+    }
+
+    // Spans 1 and 2 together, as one radix-4 pass: their twiddles are
+    // 1 and +-i, and their inner loops too short to be worth running
+    size_t span = 1;
+    if (size_ >= 4) {
+        for (size_t i = 0; i < size_; i += 4) {
+            const float r0 = real[i] + real[i + 1], i0 = imag[i] + imag[i + 1];
+            const float r1 = real[i] - real[i + 1], i1 = imag[i] - imag[i + 1];
+            const float r2 = real[i + 2] + real[i + 3], i2 = imag[i + 2] + imag[i + 3];
+            const float r3 = real[i + 2] - real[i + 3], i3 = imag[i + 2] - imag[i + 3];
+
+            // (r3, i3) times the span-2 twiddle (0, direction)
+            const float tr = -i3 * direction;
+            const float ti = r3 * direction;
+
+            real[i] = r0 + r2;
+            imag[i] = i0 + i2;
+            real[i + 2] = r0 - r2;
+            imag[i + 2] = i0 - i2;
+            real[i + 1] = r1 + tr;
+            imag[i + 1] = i1 + ti;
+            real[i + 3] = r1 - tr;
+            imag[i + 3] = i1 - ti;
+        }
+        span = 4;
+    }
+
+    // Remaining butterflies: span doubles each pass
+    for (; span < size_; span <<= 1) {
+        const float* w = twiddles_.data() + 2 * (span - 1);
+
+        for (size_t start = 0; start < size_; start += 2 * span) {
+            float* aReal = real + start;
+            float* aImag = imag + start;
+            float* bReal = aReal + span;
+            float* bImag = aImag + span;
+
+            for (size_t k = 0; k < span; ++k) {
+                const float wr = w[2 * k];
+                const float wi = direction * w[2 * k + 1];
+                const float tr = bReal[k] * wr - bImag[k] * wi;
+                const float ti = bReal[k] * wi + bImag[k] * wr;
+
+                bReal[k] = aReal[k] - tr;
+                bImag[k] = aImag[k] - ti;
+                aReal[k] += tr;
+                aImag[k] += ti;
+            }
+        }
+    }
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Common.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Radix-2 Complex FFT
+ *
+ * In-place iterative transform on split real/imaginary arrays, so the
+ * spectra it produces can be multiplied bin-wise in plain loops the
+ * compiler vectorizes. The bit-reversal permutation and twiddles are
+ * tables built by Init(); Forward() and Inverse() don't allocate.
+ *
+ * Forward: X[k] = sum x[n] e^(-2 pi i k n / N). Inverse includes the
+ * 1/N scale, so Inverse(Forward(x)) == x.
+ */
+class Fft {
+public:
+    Fft();
+    ~Fft() = default;
+
+    void Init(size_t size);     // Power of two, at least 2
+
+    void Forward(float* real, float* imag) const;
+    void Inverse(float* real, float* imag) const;
+
+    size_t GetSize() const { return size_; }
+
+private:
+    void Transform(float* real, float* imag, float direction) const;
+
+    size_t size_;
+    std::vector<std::pair<uint32_t, uint32_t>> swaps_;  // Bit-reversal pairs
+    std::vector<float> twiddles_;       // cos/sin pairs, pass by pass
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
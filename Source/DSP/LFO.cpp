@@ -21,6 +21,12 @@ void LFO::Init(float sampleRate) {
     phase_ = 0.0f;
 }
 
+void LFO::SetSampleRate(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+    phaseIncrement_ = rate_ / sampleRate_;
+}
+
 void LFO::SetRate(float rateHz) {
     rate_ = Clamp(rateHz, 0.1f, 80.0f); // LFO range 0.1Hz to 80Hz
     phaseIncrement_ = rate_ / sampleRate_;
@@ -45,6 +51,15 @@ float LFO::ProcessSample() {
     return lfoValue; // Bipolar -1.0 to +1.0
 }
 
+float LFO::Advance(size_t numSamples) {
+    float lfoValue = std::sin(kTwoPi * phase_);
+
+    phase_ += phaseIncrement_ * static_cast<float>(numSamples);
+    phase_ = WrapPhase(phase_);
+
+    return lfoValue;
+}
+
 float LFO::GetModulationValue() const {
     // Current LFO value scaled by amount
     float lfoValue = std::sin(kTwoPi * phase_);
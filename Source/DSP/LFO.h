@@ -17,11 +17,13 @@ public:
     ~LFO() = default;
 
     void Init(float sampleRate);
+    void SetSampleRate(float sampleRate); // Keeps phase, for oversampling changes
     void SetRate(float rateHz); // LFO frequency in Hz
     void SetAmount(float amount); // Modulation depth 0.0 to 1.0
     void Reset();
 
     float ProcessSample(); // Returns bipolar value -1.0 to +1.0
+    float Advance(size_t numSamples); // Control-rate step: current value, then skip numSamples
     float GetModulationValue() const; // Returns scaled by amount
 
 private:
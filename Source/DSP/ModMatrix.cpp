@@ -0,0 +1,142 @@
+#include "ModMatrix.h"
+#include <algorithm>
+#include <cassert>
+
+namespace SimpleSynth {
+namespace DSP {
+
+namespace {
+
+const ModMatrix::SourceInfo kSourceInfo[ModMatrix::kNumSources] = {
+    { "lfo1",     "LFO 1" },
+    { "lfo2",     "LFO 2" },
+    { "envelope", "Envelope" },
+    { "velocity", "Velocity" },
+    { "modWheel", "Mod Wheel" },
+    { "noise",    "Noise" }
+};
+
+// Scales keep the original LFO routings' feel at depth 1
+const ModMatrix::DestinationInfo kDestinationInfo[ModMatrix::kNumDestinations] = {
+    { "vcoRate",         "VCO Rate",         true,  4.0f, 20.0f,  2000.0f  },
+    { "vcoLevel",        "VCO Level",        false, 0.5f, 0.0f,   1.0f     },
+    { "delayTime",       "Delay Time",       true,  0.5f, 0.001f, 2.0f     },
+    { "delayFeedback",   "Delay Feedback",   false, 0.3f, 0.0f,   0.95f    },
+    { "delayWetDry",     "Delay Wet/Dry",    false, 0.3f, 0.0f,   1.0f     },
+    { "lfo1Rate",        "LFO 1 Rate",       true,  3.0f, 0.1f,   80.0f    },
+    { "lfo1Amount",      "LFO 1 Amount",     false, 0.5f, 0.0f,   1.0f     },
+    { "lfo2Rate",        "LFO 2 Rate",       true,  3.0f, 0.1f,   80.0f    },
+    { "lfo2Amount",      "LFO 2 Amount",     false, 0.5f, 0.0f,   1.0f     },
+    { "filterCutoff",    "Filter Cutoff",    true,  4.0f, 20.0f,  20000.0f },
+    { "filterResonance", "Filter Resonance", false, 0.5f, 0.0f,   1.0f     }
+};
+
+} // namespace
+
+ModMatrix::ModMatrix()
+    : slots_{}
+    , depths_{}
+    , activeSources_{}
+    , numActiveSources_(0)
+    , activeDestinations_{}
+    , numActiveDestinations_(0)
+{
+}
+
+void ModMatrix::SetSlot(size_t index, const Slot& slot) {
+    assert(index < kMaxSlots && "Slot index out of range");
+    if (index >= kMaxSlots) return;
+
+    if (slots_[index] == slot) {
+        return;
+    }
+    slots_[index] = slot;
+    Compile();
+}
+
+const ModMatrix::Slot& ModMatrix::GetSlot(size_t index) const {
+    assert(index < kMaxSlots && "Slot index out of range");
+    static const Slot kEmptySlot{};  // Out-of-range reads see an inactive slot
+    if (index >= kMaxSlots) return kEmptySlot;
+
+    return slots_[index];
+}
+
+void ModMatrix::Clear() {
+    slots_.fill(Slot{});
+    Compile();
+}
+
+bool ModMatrix::UsesSource(Source source) const {
+    for (size_t i = 0; i < numActiveSources_; ++i) {
+        if (activeSources_[i] == SourceIndex(source)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ModMatrix::Compile() {
+    // Slots sharing a route add their depths
+    depths_.fill(0.0f);
+    for (const auto& slot : slots_) {
+        if (slot.IsActive()) {
+            depths_[SourceIndex(slot.source) * kDestinationStride + DestinationIndex(slot.destination)] += slot.depth;
+        }
+    }
+
+    // Routes that cancel out drop from the lists like unused ones
+    numActiveSources_ = 0;
+    for (size_t s = 0; s < kNumSources; ++s) {
+        const float* column = depths_.data() + s * kDestinationStride;
+        if (std::any_of(column, column + kNumDestinations, [](float depth) { return depth != 0.0f; })) {
+            activeSources_[numActiveSources_++] = static_cast<uint8_t>(s);
+        }
+    }
+
+    numActiveDestinations_ = 0;
+    for (size_t d = 0; d < kNumDestinations; ++d) {
+        for (size_t s = 0; s < kNumSources; ++s) {
+            if (depths_[s * kDestinationStride + d] != 0.0f) {
+                activeDestinations_[numActiveDestinations_++] = static_cast<Destination>(d + 1);
+                break;
+            }
+        }
+    }
+}
+
+void ModMatrix::Process(const float* sources, float* outputs) const {
+    std::fill(outputs, outputs + kDestinationStride, 0.0f);
+
+    // One source's column at a time: fixed width, no reduction, so each
+    // is a few vector multiply-adds
+    for (size_t i = 0; i < numActiveSources_; ++i) {
+        const size_t s = activeSources_[i];
+        const float value = sources[s];
+        const float* column = depths_.data() + s * kDestinationStride;
+
+        for (size_t d = 0; d < kDestinationStride; ++d) {
+            outputs[d] += column[d] * value;
+        }
+    }
+}
+
+const ModMatrix::SourceInfo& ModMatrix::GetSourceInfo(Source source) {
+    assert(source != Source::None && source != Source::Count && "Not a modulation source");
+    return kSourceInfo[SourceIndex(source)];
+}
+
+const ModMatrix::DestinationInfo& ModMatrix::GetDestinationInfo(Destination destination) {
+    assert(destination != Destination::None && destination != Destination::Count && "Not a modulation destination");
+    return kDestinationInfo[DestinationIndex(destination)];
+}
+
+float ModMatrix::Apply(Destination destination, float base, float modulation) {
+    const auto& info = GetDestinationInfo(destination);
+    const float value = info.multiplicative ? base * (1.0f + info.scale * modulation)
+                                            : base + info.scale * modulation;
+    return Clamp(value, info.minimum, info.maximum);
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
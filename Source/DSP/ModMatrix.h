@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Common.h"
+#include <array>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Modulation Matrix
+ *
+ * Routes modulation sources (LFOs, envelope, velocity, mod wheel, noise)
+ * to destinations through up to kMaxSlots slots, each with a depth.
+ *
+ * Slots are compiled into a dense sources x destinations depth matrix
+ * (columns padded to kDestinationStride floats) plus flat lists of the
+ * sources and destinations any route uses. Process() is a matrix-vector
+ * product over the active sources only: one fixed-width multiply-add
+ * per source, a loop the compiler vectorizes. Unused sources cost
+ * nothing, and an empty matrix costs one branch.
+ *
+ * Outputs are unitless sums of depth x source. Apply() maps one onto a
+ * destination's base value with that destination's scaling and range.
+ */
+class ModMatrix {
+public:
+    enum class Source : uint8_t {
+        None = 0,
+        Lfo1,       // Bipolar, scaled by LFO 1 amount
+        Lfo2,       // Bipolar, scaled by LFO 2 amount
+        Envelope,   // 0..1
+        Velocity,   // 0..1, of the note or trigger that opened the gate
+        ModWheel,   // 0..1, MIDI CC 1
+        Noise,      // Bipolar, a new random value per control tick
+        Count
+    };
+
+    enum class Destination : uint8_t {
+        None = 0,
+        VcoRate,
+        VcoLevel,
+        DelayTime,
+        DelayFeedback,
+        DelayWetDry,
+        Lfo1Rate,
+        Lfo1Amount,
+        Lfo2Rate,
+        Lfo2Amount,
+        FilterCutoff,
+        FilterResonance,
+        Count
+    };
+
+    static constexpr size_t kNumSources = static_cast<size_t>(Source::Count) - 1;
+    static constexpr size_t kNumDestinations = static_cast<size_t>(Destination::Count) - 1;
+    static constexpr size_t kDestinationStride = 16;   // Padded for vector loads
+    static constexpr size_t kMaxSlots = 8;
+
+    static_assert(kNumDestinations <= kDestinationStride, "Destinations must fit one padded column");
+
+    struct Slot {
+        Source source = Source::None;
+        Destination destination = Destination::None;
+        float depth = 0.0f;     // -1 to 1
+
+        bool IsActive() const {
+            return source != Source::None && destination != Destination::None && depth != 0.0f;
+        }
+
+        bool operator==(const Slot& other) const {
+            return source == other.source && destination == other.destination && depth == other.depth;
+        }
+
+        bool operator!=(const Slot& other) const { return !(*this == other); }
+    };
+
+    struct SourceInfo {
+        const char* id;         // Stable, for saved state
+        const char* name;
+    };
+
+    struct DestinationInfo {
+        const char* id;
+        const char* name;
+        bool multiplicative;    // base * (1 + scale * m), else base + scale * m
+        float scale;
+        float minimum;
+        float maximum;
+    };
+
+    ModMatrix();
+    ~ModMatrix() = default;
+
+    void SetSlot(size_t index, const Slot& slot); // Recompiles; no allocation; ignores bad index
+    const Slot& GetSlot(size_t index) const;      // Bad index: an empty slot
+    void Clear();
+
+    bool HasRoutes() const { return numActiveSources_ > 0; }
+    bool UsesSource(Source source) const;
+
+    /**
+     * Evaluate the active routes.
+     * sources: kNumSources values, indexed by SourceIndex(); unused
+     *          sources are never read
+     * outputs: kDestinationStride values, indexed by DestinationIndex()
+     */
+    void Process(const float* sources, float* outputs) const;
+
+    // Destinations some route modulates, in destination order
+    size_t GetNumActiveDestinations() const { return numActiveDestinations_; }
+    Destination GetActiveDestination(size_t i) const { return activeDestinations_[i]; }
+
+    static size_t SourceIndex(Source source) { return static_cast<size_t>(source) - 1; }
+    static size_t DestinationIndex(Destination destination) { return static_cast<size_t>(destination) - 1; }
+
+    static const SourceInfo& GetSourceInfo(Source source);
+    static const DestinationInfo& GetDestinationInfo(Destination destination);
+
+    /**
+     * A destination's base value moved by a modulation output, clamped
+     * to the destination's range.
+     */
+    static float Apply(Destination destination, float base, float modulation);
+
+private:
+    void Compile();
+
+    std::array<Slot, kMaxSlots> slots_;
+
+    // Column per source: depths_[source * kDestinationStride + destination]
+    alignas(64) std::array<float, kNumSources * kDestinationStride> depths_;
+    std::array<uint8_t, kNumSources> activeSources_;
+    size_t numActiveSources_;
+    std::array<Destination, kNumDestinations> activeDestinations_;
+    size_t numActiveDestinations_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
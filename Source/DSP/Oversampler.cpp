@@ -0,0 +1,191 @@
+#include "Oversampler.h"
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+
+namespace SimpleSynth {
+namespace DSP {
+
+namespace {
+
+// Elliptic half-band allpass coefficients (polyphase IIR)
+constexpr float kSteepA[] = { 0.036681502163648017f, 0.2746317593794541f, 0.56109896978791948f,
+                              0.769741833862266f, 0.8922608180038789f, 0.962094548378084f };
+constexpr float kSteepB[] = { 0.13654762463195771f, 0.42313861743656667f, 0.6775400499741616f,
+                              0.839889624849638f, 0.9315419599631839f, 0.9878163707328971f };
+
+constexpr float kGentleA[] = { 0.07711507983241622f, 0.4820706250610472f,
+                               0.7968204713315797f, 0.9412514277740471f };
+constexpr float kGentleB[] = { 0.2659685265210946f, 0.6651041532634957f,
+                               0.8841015085506159f, 0.9820054141886075f };
+
+} // namespace
+
+//==============================================================================
+float HalfBandDecimator::AllpassChain::ProcessSample(float input) {
+    // First-order allpass per section: y = a * (x - y1) + x1
+    float x = input;
+    for (size_t s = 0; s < numSections; ++s) {
+        float y = coefficients[s] * (x - y1[s]) + x1[s];
+        x1[s] = x;
+        y1[s] = y;
+        x = y;
+    }
+    return x;
+}
+
+float HalfBandDecimator::AllpassChain::GetGroupDelay() const {
+    // DC group delay of (a + z^-1) / (1 + a z^-1) is (1 - a) / (1 + a)
+    float delay = 0.0f;
+    for (size_t s = 0; s < numSections; ++s) {
+        delay += (1.0f - coefficients[s]) / (1.0f + coefficients[s]);
+    }
+    return delay;
+}
+
+HalfBandDecimator::HalfBandDecimator(Order order)
+    : chainA_()
+    , chainB_()
+    , delayedB_(0.0f)
+{
+    const bool steep = (order == Order::Steep);
+    const size_t numSections = steep ? 6 : 4;
+    const float* a = steep ? kSteepA : kGentleA;
+    const float* b = steep ? kSteepB : kGentleB;
+
+    chainA_.numSections = numSections;
+    chainB_.numSections = numSections;
+    chainA_.coefficients.fill(0.0f);
+    chainB_.coefficients.fill(0.0f);
+    std::copy(a, a + numSections, chainA_.coefficients.begin());
+    std::copy(b, b + numSections, chainB_.coefficients.begin());
+
+    Reset();
+}
+
+void HalfBandDecimator::Reset() {
+    chainA_.x1.fill(0.0f);
+    chainA_.y1.fill(0.0f);
+    chainB_.x1.fill(0.0f);
+    chainB_.y1.fill(0.0f);
+    delayedB_ = 0.0f;
+}
+
+void HalfBandDecimator::Process(const float* input, float* output, size_t numOutputSamples) {
+    assert(input != nullptr && output != nullptr && "Buffers cannot be null");
+
+    for (size_t i = 0; i < numOutputSamples; ++i) {
+        float even = input[2 * i];
+        float odd = input[2 * i + 1];
+
+        output[i] = 0.5f * (chainA_.ProcessSample(even) + delayedB_);
+        delayedB_ = chainB_.ProcessSample(odd);
+    }
+
+    // Flush denormals once per block rather than per section
+    for (size_t s = 0; s < chainA_.numSections; ++s) {
+        chainA_.y1[s] = PreventDenormal(chainA_.y1[s]);
+        chainB_.y1[s] = PreventDenormal(chainB_.y1[s]);
+    }
+}
+
+float HalfBandDecimator::GetGroupDelay() const {
+    // Both branches are in phase across the passband; average them.
+    // Branch A sees even samples, branch B odd samples plus one delay.
+    float delayA = 2.0f * chainA_.GetGroupDelay();
+    float delayB = 2.0f * chainB_.GetGroupDelay() + 1.0f;
+    return 0.25f * (delayA + delayB); // Input-rate average, halved to output rate
+}
+
+//==============================================================================
+Oversampler::Oversampler()
+    : factor_(1)
+    , maxBlockSize_(0)
+    , outerStage_(HalfBandDecimator::Order::Gentle)
+    , innerStage_(HalfBandDecimator::Order::Steep)
+    , latency_(0)
+    , padding_(0)
+    , paddingLine_()
+    , paddingPosition_(0)
+{
+    latency_ = static_cast<size_t>(std::lround(GetFilterDelay(kMaxFactor)));
+    padding_ = latency_;
+    assert(latency_ < kPaddingSize && "Padding line too short for the 1x padding");
+}
+
+void Oversampler::Init(size_t maxBlockSize) {
+    assert(maxBlockSize > 0 && "Block size must be positive");
+    maxBlockSize_ = maxBlockSize;
+    buffer_.assign(maxBlockSize * kMaxFactor, 0.0f);
+    Reset();
+}
+
+void Oversampler::SetFactor(size_t factor) {
+    assert((factor == 1 || factor == 2 || factor == 4) && "Factor must be 1, 2 or 4");
+    factor = (factor >= 4) ? 4 : (factor >= 2 ? 2 : 1);
+
+    if (factor != factor_) {
+        factor_ = factor;
+        padding_ = latency_ - static_cast<size_t>(std::lround(GetFilterDelay(factor)));
+        Reset();
+    }
+}
+
+void Oversampler::Reset() {
+    outerStage_.Reset();
+    innerStage_.Reset();
+    paddingLine_.fill(0.0f);
+    paddingPosition_ = 0;
+}
+
+void Oversampler::Downsample(float* output, size_t numSamples) {
+    assert(output != nullptr && "Output buffer cannot be null");
+    assert(numSamples <= maxBlockSize_ && "Block larger than Init() size");
+
+    switch (factor_) {
+        case 1:
+            std::copy(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(numSamples), output);
+            break;
+
+        case 2:
+            innerStage_.Process(buffer_.data(), output, numSamples);
+            break;
+
+        case 4:
+            // Decimate in place to 2x, then to the host rate
+            outerStage_.Process(buffer_.data(), buffer_.data(), numSamples * 2);
+            innerStage_.Process(buffer_.data(), output, numSamples);
+            break;
+
+        default:
+            break;
+    }
+
+    if (padding_ == 0)
+        return;
+
+    constexpr size_t mask = kPaddingSize - 1;
+    for (size_t i = 0; i < numSamples; ++i) {
+        paddingLine_[paddingPosition_] = output[i];
+        output[i] = paddingLine_[(paddingPosition_ - padding_) & mask];
+        paddingPosition_ = (paddingPosition_ + 1) & mask;
+    }
+}
+
+float Oversampler::GetGroupDelay() const {
+    return GetFilterDelay(factor_) + static_cast<float>(padding_);
+}
+
+float Oversampler::GetFilterDelay(size_t factor) const {
+    switch (factor) {
+        case 2:
+            return innerStage_.GetGroupDelay();
+        case 4:
+            return innerStage_.GetGroupDelay() + 0.5f * outerStage_.GetGroupDelay();
+        default:
+            return 0.0f;
+    }
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Common.h"
+#include <array>
+#include <vector>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Polyphase Half-Band IIR Decimator (2:1)
+ *
+ * Two parallel chains of first-order allpass sections running at the
+ * low rate (polyphase form), so each input pair costs one pass through
+ * each chain:
+ *
+ *     y[m] = 0.5 * (A(x[2m]) + B(x[2m - 1]))
+ *
+ * Coefficient sets are the classic elliptic half-band designs:
+ * - Steep: 12th order, >100 dB rejection, transition 0.01 fs
+ * - Gentle: 8th order, ~70 dB rejection, transition 0.01 fs
+ */
+class HalfBandDecimator {
+public:
+    enum class Order {
+        Steep,  // For the stage closest to the output rate
+        Gentle  // For outer stages, where images sit far above the passband
+    };
+
+    explicit HalfBandDecimator(Order order = Order::Steep);
+    ~HalfBandDecimator() = default;
+
+    void Reset();
+
+    /**
+     * Decimate 2 * numOutputSamples input samples into numOutputSamples.
+     * input and output may alias (output never runs ahead of input).
+     */
+    void Process(const float* input, float* output, size_t numOutputSamples);
+
+    /**
+     * Group delay near DC, in output-rate samples.
+     */
+    float GetGroupDelay() const;
+
+private:
+    static constexpr size_t kMaxSections = 6;
+
+    struct AllpassChain {
+        std::array<float, kMaxSections> coefficients;
+        std::array<float, kMaxSections> x1;
+        std::array<float, kMaxSections> y1;
+        size_t numSections;
+
+        float ProcessSample(float input);
+        float GetGroupDelay() const;
+    };
+
+    AllpassChain chainA_;
+    AllpassChain chainB_;
+    float delayedB_;    // B branch output from the previous odd sample
+};
+
+/**
+ * Oversampler for the Siren Core
+ *
+ * The siren core is generated directly at the oversampled rate, so only
+ * the downsampling side is needed: the caller renders factor * n samples
+ * into GetBuffer() and Downsample() brings them back to the host rate.
+ *
+ * Factors 1 (bypass), 2 and 4. 4x cascades a gentle 4x->2x stage with a
+ * steep 2x->1x stage. All buffers are sized for 4x in Init(), so changing
+ * the factor never allocates.
+ *
+ * Every factor has the same latency: lower factors add whole samples of
+ * delay to match the 4x filters, so the host's delay compensation holds
+ * when the factor changes mid-session (quality tiers, the CPU governor,
+ * a bounce rendering a higher tier than playback).
+ */
+class Oversampler {
+public:
+    static constexpr size_t kMaxFactor = 4;
+
+    Oversampler();
+    ~Oversampler() = default;
+
+    /**
+     * Allocate buffers for the largest factor.
+     * maxBlockSize: Largest host-rate block passed to Downsample()
+     */
+    void Init(size_t maxBlockSize);
+
+    /**
+     * Set oversampling factor (1, 2 or 4). Resets filter state when
+     * the factor changes.
+     */
+    void SetFactor(size_t factor);
+    void Reset();
+
+    /**
+     * Oversampled render buffer, room for factor * maxBlockSize samples.
+     */
+    float* GetBuffer() { return buffer_.data(); }
+
+    /**
+     * Decimate factor * numSamples samples from GetBuffer() into output.
+     */
+    void Downsample(float* output, size_t numSamples);
+
+    /**
+     * Latency to report to the host, in host-rate samples: the 4x filters'
+     * delay rounded, the same at every factor.
+     */
+    size_t GetLatencySamples() const { return latency_; }
+
+    /**
+     * Delay near DC at the current factor (filters plus padding), in
+     * host-rate samples; within half a sample of GetLatencySamples().
+     */
+    float GetGroupDelay() const;
+
+    size_t GetFactor() const { return factor_; }
+    size_t GetMaxBlockSize() const { return maxBlockSize_; }
+
+private:
+    static constexpr size_t kPaddingSize = 8;    // Power of two above the 1x padding
+
+    float GetFilterDelay(size_t factor) const;
+
+    size_t factor_;
+    size_t maxBlockSize_;
+    std::vector<float> buffer_;
+
+    HalfBandDecimator outerStage_;  // 4x -> 2x
+    HalfBandDecimator innerStage_;  // 2x -> 1x
+
+    size_t latency_;                // Rounded 4x filter delay
+    size_t padding_;                // Whole samples added at this factor
+    std::array<float, kPaddingSize> paddingLine_;
+    size_t paddingPosition_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,95 @@
+#include "ParameterSmoother.h"
+#include <cassert>
+#include <cmath>
+
+namespace SimpleSynth {
+namespace DSP {
+
+ParameterSmoother::ParameterSmoother()
+    : mode_(Mode::OnePole)
+    , sampleRate_(44100.0f)
+    , time_(0.02f)
+    , current_(0.0f)
+    , target_(0.0f)
+    , step_(0.0f)
+    , remaining_(0.0f)
+    , cachedSamples_(0)
+    , cachedDecay_(0.0f)
+{
+}
+
+void ParameterSmoother::Init(float sampleRate) {
+    SetSampleRate(sampleRate);
+    Reset(target_);
+}
+
+void ParameterSmoother::SetSampleRate(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+    cachedSamples_ = 0;
+    UpdateLinearStep();
+}
+
+void ParameterSmoother::SetMode(Mode mode) {
+    mode_ = mode;
+    UpdateLinearStep();
+}
+
+void ParameterSmoother::SetTime(float seconds) {
+    assert(seconds >= 0.0f && "Smoothing time can't be negative");
+    time_ = seconds;
+    cachedSamples_ = 0;
+    UpdateLinearStep();
+}
+
+void ParameterSmoother::Reset(float value) {
+    current_ = value;
+    target_ = value;
+    step_ = 0.0f;
+    remaining_ = 0.0f;
+}
+
+void ParameterSmoother::SetTarget(float target) {
+    target_ = target;
+    UpdateLinearStep();
+}
+
+void ParameterSmoother::UpdateLinearStep() {
+    // A new target restarts the ramp from wherever we are now
+    remaining_ = std::max(1.0f, time_ * sampleRate_);
+    step_ = (target_ - current_) / remaining_;
+}
+
+float ParameterSmoother::Advance(size_t numSamples) {
+    if (current_ == target_) {
+        return current_;
+    }
+
+    const float samples = static_cast<float>(numSamples);
+
+    if (mode_ == Mode::Linear) {
+        if (samples >= remaining_) {
+            current_ = target_;
+        } else {
+            current_ += step_ * samples;
+            remaining_ -= samples;
+        }
+        return current_;
+    }
+
+    if (numSamples != cachedSamples_) {
+        cachedSamples_ = numSamples;
+        cachedDecay_ = (time_ > 0.0f) ? std::exp(-samples / (time_ * sampleRate_)) : 0.0f;
+    }
+
+    current_ = target_ + (current_ - target_) * cachedDecay_;
+
+    // Snap once the remaining distance is inaudible, so IsSmoothing() ends
+    if (std::abs(current_ - target_) <= 1.0e-5f * (1.0f + std::abs(target_))) {
+        current_ = target_;
+    }
+    return current_;
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Common.h"
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Control-Rate Parameter Smoother
+ *
+ * Glides a parameter toward its latest target so stepped sources (7-bit
+ * MIDI CCs) don't zipper. Advance() steps a whole control interval at
+ * once, so the cost is per control tick, not per sample, and a new
+ * target costs the same however often it arrives.
+ *
+ * - OnePole: exponential approach, time = time constant (63%)
+ * - Linear: reaches the target in exactly time seconds
+ */
+class ParameterSmoother {
+public:
+    enum class Mode {
+        OnePole = 0,
+        Linear
+    };
+
+    ParameterSmoother();
+    ~ParameterSmoother() = default;
+
+    void Init(float sampleRate);
+    void SetSampleRate(float sampleRate); // Keeps value and target
+    void SetMode(Mode mode);
+    void SetTime(float seconds);
+
+    void Reset(float value); // Jump to value, no glide
+    void SetTarget(float target);
+
+    float Advance(size_t numSamples); // Control-rate step, returns the new value
+    bool IsSmoothing() const { return current_ != target_; }
+
+    // Getters for testing
+    float GetValue() const { return current_; }
+    float GetTarget() const { return target_; }
+    Mode GetMode() const { return mode_; }
+
+private:
+    void UpdateLinearStep();
+
+    Mode mode_;
+    float sampleRate_;
+    float time_;
+    float current_;
+    float target_;
+
+    // Linear: per-sample step and samples left
+    float step_;
+    float remaining_;
+
+    // OnePole: decay over the last interval length, cached (intervals rarely change)
+    size_t cachedSamples_;
+    float cachedDecay_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
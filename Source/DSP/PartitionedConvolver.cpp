@@ -0,0 +1,244 @@
+#include "PartitionedConvolver.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace SimpleSynth {
+namespace DSP {
+
+namespace {
+
+constexpr size_t kHeadTile = 32;
+
+/**
+ * Bin-wise complex multiply-add: sum += a * b, over split real/imaginary
+ * arrays.
+ */
+inline void MultiplyAdd(const float* aReal, const float* aImag,
+                        const float* bReal, const float* bImag,
+                        float* sumReal, float* sumImag, size_t numBins) {
+    for (size_t i = 0; i < numBins; ++i) {
+        sumReal[i] += aReal[i] * bReal[i] - aImag[i] * bImag[i];
+        sumImag[i] += aReal[i] * bImag[i] + aImag[i] * bReal[i];
+    }
+}
+
+} // namespace
+
+ConvolutionKernel::ConvolutionKernel(const float* impulse, size_t length)
+    : length_(length)
+    , headSize_(0)
+    , numPartitions_(0)
+{
+    assert((impulse != nullptr || length == 0) && "Impulse cannot be null");
+
+    headSize_ = std::min(length, kPartitionSize);
+    head_.assign(headSize_, 0.0f);
+    for (size_t i = 0; i < headSize_; ++i) {
+        head_[headSize_ - 1 - i] = impulse[i];
+    }
+
+    const size_t tailTaps = length > kPartitionSize ? length - kPartitionSize : 0;
+    numPartitions_ = (tailTaps + kPartitionSize - 1) / kPartitionSize;
+    real_.assign(numPartitions_ * kNumBins, 0.0f);
+    imag_.assign(numPartitions_ * kNumBins, 0.0f);
+
+    // Each partition zero-padded to the FFT size, so the overlap-save
+    // half of the circular convolution is linear
+    Fft fft;
+    fft.Init(kFftSize);
+    std::vector<float> real(kFftSize), imag(kFftSize);
+
+    for (size_t p = 0; p < numPartitions_; ++p) {
+        const size_t start = kPartitionSize * (p + 1);
+        const size_t count = std::min(kPartitionSize, length - start);
+
+        std::fill(real.begin(), real.end(), 0.0f);
+        std::fill(imag.begin(), imag.end(), 0.0f);
+        std::copy(impulse + start, impulse + start + count, real.begin());
+        fft.Forward(real.data(), imag.data());
+
+        std::copy(real.begin(), real.begin() + kNumBins, real_.begin() + p * kNumBins);
+        std::copy(imag.begin(), imag.begin() + kNumBins, imag_.begin() + p * kNumBins);
+    }
+}
+
+PartitionedConvolver::PartitionedConvolver()
+    : kernel_(nullptr)
+    , mix_(0.0f)
+    , active_(false)
+    , position_(0)
+    , newestSpectrum_(0)
+    , partitionsDone_(1)
+{
+}
+
+void PartitionedConvolver::Init(const ConvolutionKernel* kernel) {
+    kernel_ = kernel;
+    active_ = false;
+    if (kernel_ == nullptr) return;
+
+    // FFT tables and every buffer the kernel needs, allocated here once
+    fft_.Init(kFftSize);
+    window_.assign(kFftSize, 0.0f);
+    head_.assign(kPartitionSize, 0.0f);
+    inputReal_.assign(kernel_->GetNumPartitions() * kNumBins, 0.0f);
+    inputImag_.assign(kernel_->GetNumPartitions() * kNumBins, 0.0f);
+    sumReal_.assign(kNumBins, 0.0f);
+    sumImag_.assign(kNumBins, 0.0f);
+    fftReal_.assign(kFftSize, 0.0f);
+    fftImag_.assign(kFftSize, 0.0f);
+    tail_.assign(kPartitionSize, 0.0f);
+
+    Reset();
+}
+
+void PartitionedConvolver::Reset() {
+    std::fill(window_.begin(), window_.end(), 0.0f);
+    std::fill(inputReal_.begin(), inputReal_.end(), 0.0f);
+    std::fill(inputImag_.begin(), inputImag_.end(), 0.0f);
+    std::fill(sumReal_.begin(), sumReal_.end(), 0.0f);
+    std::fill(sumImag_.begin(), sumImag_.end(), 0.0f);
+    std::fill(tail_.begin(), tail_.end(), 0.0f);
+
+    position_ = 0;
+    newestSpectrum_ = 0;
+    partitionsDone_ = 1;
+}
+
+void PartitionedConvolver::SetMix(float mix) {
+    mix_ = Clamp(mix, 0.0f, 1.0f);
+}
+
+void PartitionedConvolver::Process(float* buffer, size_t numSamples) {
+    assert(buffer != nullptr && "Buffer cannot be null");
+
+    // Bypassed
+    if (mix_ <= 0.0f || kernel_ == nullptr) {
+        active_ = false;
+        return;
+    }
+    if (! active_) {
+        Reset();
+        active_ = true;
+    }
+
+    Render(buffer, numSamples);
+}
+
+void PartitionedConvolver::Render(float* buffer, size_t numSamples) {
+    const size_t numPartitions = kernel_->GetNumPartitions();
+    const float dry = 1.0f - mix_;
+    const float wet = mix_;
+
+    size_t done = 0;
+    while (done < numSamples) {
+        const size_t count = std::min(numSamples - done, kPartitionSize - position_);
+
+        std::copy(buffer + done, buffer + done + count, window_.begin() + kPartitionSize + position_);
+        ProcessHead(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            const float convolved = head_[i] + tail_[position_ + i];
+            buffer[done + i] = buffer[done + i] * dry + convolved * wet;
+        }
+        position_ += count;
+        done += count;
+
+        if (numPartitions > 0) {
+            // This share of the older partitions, in step with the samples
+            AccumulatePartitions(1 + (numPartitions - 1) * position_ / kPartitionSize);
+        }
+
+        if (position_ == kPartitionSize) {
+            if (numPartitions > 0) {
+                FinishPartition();
+            }
+            std::copy(window_.begin() + kPartitionSize, window_.end(), window_.begin());
+            position_ = 0;
+        }
+    }
+}
+
+void PartitionedConvolver::ProcessHead(size_t count) {
+    // kHeadTile outputs at a time, their sums kept in registers across the
+    // taps so the lane loop vectorizes; the window always holds the inputs
+    const size_t headSize = kernel_->GetHeadSize();
+    const float* taps = kernel_->GetHead();
+    const float* window = window_.data() + kPartitionSize + position_ + 1 - headSize;
+    float* head = head_.data();
+
+    size_t i = 0;
+    for (; i + kHeadTile <= count; i += kHeadTile) {
+        std::array<float, kHeadTile> sums {};
+        const float* input = window + i;
+        for (size_t j = 0; j < headSize; ++j) {
+            const float tap = taps[j];
+            for (size_t lane = 0; lane < kHeadTile; ++lane) {
+                sums[lane] += tap * input[j + lane];
+            }
+        }
+        std::copy(sums.begin(), sums.end(), head + i);
+    }
+
+    for (; i < count; ++i) {
+        const float* input = window + i;
+        float sum = 0.0f;
+        for (size_t j = 0; j < headSize; ++j) {
+            sum += taps[j] * input[j];
+        }
+        head[i] = sum;
+    }
+}
+
+void PartitionedConvolver::AccumulatePartitions(size_t end) {
+    const size_t numPartitions = kernel_->GetNumPartitions();
+
+    // Partition p meets the input spectrum p partitions older than the
+    // one still being filled
+    for (; partitionsDone_ < end; ++partitionsDone_) {
+        const size_t slot = (newestSpectrum_ + numPartitions - (partitionsDone_ - 1)) % numPartitions;
+        MultiplyAdd(kernel_->GetPartitionReal(partitionsDone_), kernel_->GetPartitionImag(partitionsDone_),
+                    inputReal_.data() + slot * kNumBins, inputImag_.data() + slot * kNumBins,
+                    sumReal_.data(), sumImag_.data(), kNumBins);
+    }
+}
+
+void PartitionedConvolver::FinishPartition() {
+    const size_t numPartitions = kernel_->GetNumPartitions();
+
+    // The completed input (with the one before it) into the delay line
+    std::copy(window_.begin(), window_.end(), fftReal_.begin());
+    std::fill(fftImag_.begin(), fftImag_.end(), 0.0f);
+    fft_.Forward(fftReal_.data(), fftImag_.data());
+
+    newestSpectrum_ = (newestSpectrum_ + 1) % numPartitions;
+    float* newestReal = inputReal_.data() + newestSpectrum_ * kNumBins;
+    float* newestImag = inputImag_.data() + newestSpectrum_ * kNumBins;
+    std::copy(fftReal_.begin(), fftReal_.begin() + kNumBins, newestReal);
+    std::copy(fftImag_.begin(), fftImag_.begin() + kNumBins, newestImag);
+
+    MultiplyAdd(kernel_->GetPartitionReal(0), kernel_->GetPartitionImag(0),
+                newestReal, newestImag, sumReal_.data(), sumImag_.data(), kNumBins);
+
+    // Back to the time domain: the upper bins mirror the lower ones
+    for (size_t i = 0; i < kNumBins; ++i) {
+        fftReal_[i] = sumReal_[i];
+        fftImag_[i] = sumImag_[i];
+    }
+    for (size_t i = 1; i < kPartitionSize; ++i) {
+        fftReal_[kFftSize - i] = sumReal_[i];
+        fftImag_[kFftSize - i] = -sumImag_[i];
+    }
+    fft_.Inverse(fftReal_.data(), fftImag_.data());
+
+    // The second half is the linear part: the tail for the next partition
+    std::copy(fftReal_.begin() + kPartitionSize, fftReal_.end(), tail_.begin());
+
+    std::fill(sumReal_.begin(), sumReal_.end(), 0.0f);
+    std::fill(sumImag_.begin(), sumImag_.end(), 0.0f);
+    partitionsDone_ = 1;
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
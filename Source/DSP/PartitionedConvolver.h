@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Common.h"
+#include "Fft.h"
+#include <cstddef>
+#include <vector>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Convolution Kernel
+ *
+ * An impulse response prepared for PartitionedConvolver: the first
+ * kPartitionSize taps (the head) as a direct-form FIR, the rest cut
+ * into kPartitionSize-tap partitions and transformed once, here.
+ * Immutable after construction, so one kernel serves any number of
+ * convolvers (plugin instances) at the same sample rate.
+ */
+class ConvolutionKernel {
+public:
+    static constexpr size_t kPartitionSize = 512;
+    static constexpr size_t kFftSize = 2 * kPartitionSize;
+    static constexpr size_t kNumBins = kPartitionSize + 1;     // Real input: DC to Nyquist
+
+    ConvolutionKernel(const float* impulse, size_t length);
+
+    size_t GetLength() const { return length_; }
+
+    // Head taps in reverse order, GetHeadSize() long
+    const float* GetHead() const { return head_.data(); }
+    size_t GetHeadSize() const { return headSize_; }
+
+    // Tail partition p covers taps kPartitionSize * (p + 1) onwards
+    size_t GetNumPartitions() const { return numPartitions_; }
+    const float* GetPartitionReal(size_t p) const { return real_.data() + p * kNumBins; }
+    const float* GetPartitionImag(size_t p) const { return imag_.data() + p * kNumBins; }
+
+private:
+    size_t length_;
+    size_t headSize_;           // At most kPartitionSize
+    size_t numPartitions_;
+    std::vector<float> head_;
+    std::vector<float> real_;   // numPartitions_ * kNumBins
+    std::vector<float> imag_;
+};
+
+/**
+ * Partitioned Convolver
+ *
+ * Zero-latency convolution with a long impulse response (a sampled
+ * spring tank): the head is a direct-form FIR on each sample, the tail
+ * uniformly partitioned overlap-save convolution in the frequency
+ * domain. Each kPartitionSize input samples are transformed once into a
+ * frequency-domain delay line; the tail output for the next partition
+ * is the bin-wise sum of every partition spectrum times its input
+ * spectrum. The tail's one partition of latency is exactly what the
+ * head covers.
+ *
+ * The multiply-adds with older input spectra (all but the newest) are
+ * known a partition ahead, so they are spread evenly over the samples
+ * of the partition. What is left at a partition boundary (one forward
+ * FFT, the newest partition, one inverse FFT) is the same whatever the
+ * IR length: no block pays for the whole tail at once.
+ *
+ * Init() allocates everything for its kernel (FFT tables and partition
+ * buffers); Process() never allocates. A mix of 0 bypasses it
+ * (README: Signal Chain).
+ */
+class PartitionedConvolver {
+public:
+    static constexpr size_t kPartitionSize = ConvolutionKernel::kPartitionSize;
+
+    PartitionedConvolver();
+    ~PartitionedConvolver() = default;
+
+    // Kernel must outlive the convolver (or the next Init). nullptr: off.
+    void Init(const ConvolutionKernel* kernel);
+    void Reset();
+
+    void SetMix(float mix);     // 0 = dry (bypassed) to 1 = wet only
+
+    void Process(float* buffer, size_t numSamples);
+
+    // Getters for testing
+    const ConvolutionKernel* GetKernel() const { return kernel_; }
+    bool IsActive() const { return active_; }
+
+private:
+    static constexpr size_t kFftSize = ConvolutionKernel::kFftSize;
+    static constexpr size_t kNumBins = ConvolutionKernel::kNumBins;
+
+    void Render(float* buffer, size_t numSamples);
+    void ProcessHead(size_t count);
+    void AccumulatePartitions(size_t end);
+    void FinishPartition();
+
+    const ConvolutionKernel* kernel_;
+    float mix_;
+    bool active_;       // Not bypassed last block
+
+    Fft fft_;
+
+    // Overlap-save input: previous partition, then the one being filled.
+    // The head FIR reads its inputs from here too.
+    std::vector<float> window_;
+    size_t position_;
+    std::vector<float> head_;       // Head FIR output for the current chunk
+
+    // Frequency-domain delay line: one input spectrum per tail partition
+    std::vector<float> inputReal_;
+    std::vector<float> inputImag_;
+    size_t newestSpectrum_;
+
+    // Next partition's output spectrum, and how many partitions are in it
+    std::vector<float> sumReal_;
+    std::vector<float> sumImag_;
+    size_t partitionsDone_;
+
+    std::vector<float> fftReal_;
+    std::vector<float> fftImag_;
+    std::vector<float> tail_;       // Tail output for the current partition
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,106 @@
+#include "PitchGlide.h"
+#include <cassert>
+#include <cmath>
+
+namespace SimpleSynth {
+namespace DSP {
+
+PitchGlide::PitchGlide()
+    : sampleRate_(44100.0f)
+    , time_(0.0f)
+    , current_(1.0)
+    , target_(1.0)
+    , ratio_(1.0)
+    , remaining_(0)
+    , cachedSamples_(0)
+    , cachedRatio_(1.0)
+{
+}
+
+void PitchGlide::Init(float sampleRate) {
+    SetSampleRate(sampleRate);
+    Reset(static_cast<float>(target_));
+}
+
+void PitchGlide::SetSampleRate(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+
+    if (IsGliding()) {
+        SetTarget(static_cast<float>(target_));
+    }
+}
+
+void PitchGlide::SetTime(float seconds) {
+    assert(seconds >= 0.0f && "Glide time can't be negative");
+    time_ = seconds;
+}
+
+void PitchGlide::Reset(float value) {
+    assert(value > 0.0f && "Glide values must be positive");
+    current_ = value;
+    target_ = value;
+    ratio_ = 1.0;
+    remaining_ = 0;
+    cachedSamples_ = 0;
+}
+
+void PitchGlide::SetTarget(float target) {
+    assert(target > 0.0f && "Glide values must be positive");
+    target_ = target;
+
+    // A new target restarts the sweep from wherever we are now
+    const double samples = std::floor(static_cast<double>(time_) * sampleRate_);
+    if (samples < 1.0 || current_ == target_) {
+        current_ = target_;
+        ratio_ = 1.0;
+        remaining_ = 0;
+        return;
+    }
+
+    remaining_ = static_cast<size_t>(samples);
+    ratio_ = std::exp2(std::log2(target_ / current_) / samples);
+    cachedSamples_ = 0;
+}
+
+float PitchGlide::Process() {
+    if (remaining_ == 0) {
+        return static_cast<float>(current_);
+    }
+
+    // Land exactly on the target, whatever rounding accumulated
+    current_ = (--remaining_ == 0) ? target_ : current_ * ratio_;
+    return static_cast<float>(current_);
+}
+
+float PitchGlide::Advance(size_t numSamples) {
+    if (remaining_ == 0) {
+        return static_cast<float>(current_);
+    }
+
+    if (numSamples >= remaining_) {
+        current_ = target_;
+        remaining_ = 0;
+        return static_cast<float>(current_);
+    }
+
+    if (numSamples != cachedSamples_) {
+        // Square-and-multiply: ratio_^n without pow()
+        cachedSamples_ = numSamples;
+        cachedRatio_ = 1.0;
+        double power = ratio_;
+        for (size_t n = numSamples; n > 0; n >>= 1) {
+            if (n & 1) {
+                cachedRatio_ *= power;
+            }
+            power *= power;
+        }
+    }
+
+    current_ *= cachedRatio_;
+    remaining_ -= numSamples;
+    return static_cast<float>(current_);
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Common.h"
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Log-Domain Pitch Glide
+ *
+ * Sweeps a frequency (or frequency ratio) to its target in a fixed time,
+ * evenly in pitch: the value is multiplied by a constant ratio every
+ * sample. A new target costs one log2/exp2 pair; after that a sample is
+ * one multiply and a control-rate Advance() one multiply by the cached
+ * ratio for that interval length. No pow() per sample.
+ *
+ * Values must be positive.
+ */
+class PitchGlide {
+public:
+    PitchGlide();
+    ~PitchGlide() = default;
+
+    void Init(float sampleRate);
+    void SetSampleRate(float sampleRate); // Keeps value; a running glide restarts at the new rate
+    void SetTime(float seconds);          // Used by the next SetTarget(); 0 jumps
+
+    void Reset(float value); // Jump to value, no glide
+    void SetTarget(float target);
+
+    float Process();                  // One sample
+    float Advance(size_t numSamples); // Control-rate step, returns the new value
+    bool IsGliding() const { return remaining_ > 0; }
+
+    // Getters for testing
+    float GetValue() const { return static_cast<float>(current_); }
+    float GetTarget() const { return static_cast<float>(target_); }
+    float GetTime() const { return time_; }
+
+private:
+    float sampleRate_;
+    float time_;
+
+    // Double precision so thousands of multiplies land on the target
+    double current_;
+    double target_;
+    double ratio_;           // Per-sample multiplier
+    size_t remaining_;       // Samples until the target
+
+    // ratio_^n for the last interval length (intervals rarely change)
+    size_t cachedSamples_;
+    double cachedRatio_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
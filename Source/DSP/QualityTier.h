@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Common.h"
+#include "DubDelay.h"
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Quality Tiers
+ *
+ * Presets that pick a cost/fidelity point for every DSP module at once.
+ * Ordered cheapest first so a tier index can be stepped up or down.
+ *
+ * - Eco: lowest cost, for overloaded machines
+ * - Live: cheap paths for realtime playback
+ * - Studio: highest quality, for offline bounces
+ *
+ * All tiers run on buffers allocated for Studio, so switching between
+ * them never allocates.
+ */
+enum class QualityTier {
+    Eco = 0,
+    Live,
+    Studio
+};
+
+constexpr size_t kNumQualityTiers = 3;
+
+struct QualitySettings {
+    size_t oversamplingFactor;                  // 1, 2 or 4
+    bool oversampleVcoOnly;                     // Modulation/envelope stay at host rate
+    DubDelay::Interpolation delayInterpolation;
+    bool bandLimitedVco;                        // PolyBLEP square edges
+    size_t controlInterval;                     // Samples between modulation updates
+
+    bool operator==(const QualitySettings& other) const {
+        return oversamplingFactor == other.oversamplingFactor
+            && oversampleVcoOnly == other.oversampleVcoOnly
+            && delayInterpolation == other.delayInterpolation
+            && bandLimitedVco == other.bandLimitedVco
+            && controlInterval == other.controlInterval;
+    }
+
+    bool operator!=(const QualitySettings& other) const { return !(*this == other); }
+};
+
+/**
+ * Preset settings for a tier.
+ */
+inline QualitySettings GetQualitySettings(QualityTier tier) {
+    switch (tier) {
+        case QualityTier::Eco:
+            return { 1, false, DubDelay::Interpolation::None, false, 32 };
+        case QualityTier::Live:
+            return { 1, false, DubDelay::Interpolation::Linear, false, 8 };
+        case QualityTier::Studio:
+            return { 4, false, DubDelay::Interpolation::Cubic, true, 1 };
+    }
+    return { 1, false, DubDelay::Interpolation::None, false, 1 };
+}
+
+/**
+ * Rough CPU cost of each tier relative to Live, from the SirenCore and
+ * DubDelay benchmarks. Used by the CPU governor to predict whether
+ * stepping up a tier would fit the budget.
+ */
+inline float GetQualityTierCost(QualityTier tier) {
+    switch (tier) {
+        case QualityTier::Eco:    return 0.8f;
+        case QualityTier::Live:   return 1.0f;
+        case QualityTier::Studio: return 5.0f;
+    }
+    return 1.0f;
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
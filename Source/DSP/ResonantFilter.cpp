@@ -0,0 +1,175 @@
+#include "ResonantFilter.h"
+#include <algorithm>
+#include <cassert>
+
+namespace SimpleSynth {
+namespace DSP {
+
+namespace {
+
+// Resonance 0..1 onto the damping k = 1 / Q, from Q 0.5 to Q 10
+constexpr float kMaxDamping = 2.0f;
+constexpr float kMinDamping = 0.1f;
+
+} // namespace
+
+ResonantFilter::ResonantFilter()
+    : sampleRate_(44100.0f)
+    , maxCutoff_(0.45f * 44100.0f)
+    , mode_(Mode::Off)
+    , cutoff_(1000.0f)
+    , resonance_(0.0f)
+    , latest_{}
+    , current_{}
+    , targets_{}
+    , numTargets_(0)
+    , ic1_(0.0f)
+    , ic2_(0.0f)
+    , active_(false)
+    , numCoefficientUpdates_(0)
+{
+}
+
+void ResonantFilter::Init(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+    maxCutoff_ = std::min(kMaxFrequency, 0.45f * sampleRate);
+
+    cutoff_ = Clamp(cutoff_, kMinFrequency, maxCutoff_);
+    latest_ = ComputeCoefficients();
+    Reset();
+}
+
+void ResonantFilter::Reset() {
+    ic1_ = 0.0f;
+    ic2_ = 0.0f;
+    current_ = latest_;
+    numTargets_ = 0;
+}
+
+void ResonantFilter::SetMode(Mode mode) {
+    mode_ = mode;
+}
+
+void ResonantFilter::SetTarget(float cutoff, float resonance, size_t offset) {
+    cutoff = Clamp(cutoff, kMinFrequency, maxCutoff_);
+    resonance = Clamp(resonance, 0.0f, 1.0f);
+
+    // A static cutoff never gets past here
+    if (cutoff == cutoff_ && resonance == resonance_) {
+        return;
+    }
+    cutoff_ = cutoff;
+    resonance_ = resonance;
+    latest_ = ComputeCoefficients();
+    ++numCoefficientUpdates_;
+
+    // Same offset replaces; a full list gives up resolution, not the target
+    if (numTargets_ > 0 && (targets_[numTargets_ - 1].offset >= offset || numTargets_ == kMaxTargets)) {
+        targets_[numTargets_ - 1].coefficients = latest_;
+        return;
+    }
+    targets_[numTargets_++] = { offset, latest_ };
+}
+
+ResonantFilter::Coefficients ResonantFilter::ComputeCoefficients() const {
+    const float g = FastTan(kPi * cutoff_ / sampleRate_);
+    const float k = Lerp(kMaxDamping, kMinDamping, resonance_);
+
+    Coefficients coefficients;
+    coefficients.a1 = 1.0f / (1.0f + g * (g + k));
+    coefficients.a2 = g * coefficients.a1;
+    coefficients.a3 = g * coefficients.a2;
+    coefficients.k = k;
+    return coefficients;
+}
+
+void ResonantFilter::Process(float* buffer, size_t numSamples) {
+    assert(buffer != nullptr && "Buffer cannot be null");
+
+    // Bypassed
+    if (mode_ == Mode::Off) {
+        active_ = false;
+        numTargets_ = 0;
+        return;
+    }
+
+    // Back from Off: from the first target queued for this call
+    if (! active_) {
+        ic1_ = 0.0f;
+        ic2_ = 0.0f;
+        current_ = numTargets_ > 0 ? targets_[0].coefficients : latest_;
+        active_ = true;
+    }
+
+    // One pass over spans between targets, state and coefficients kept in
+    // locals throughout: each span ramps linearly toward the next target,
+    // four adds per sample (zero steps once past the last target)
+    float a1 = current_.a1;
+    float a2 = current_.a2;
+    float a3 = current_.a3;
+    float k = current_.k;
+    float ic1 = ic1_;
+    float ic2 = ic2_;
+    const bool lowPass = mode_ == Mode::LowPass;
+
+    size_t position = 0;
+    size_t t = 0;
+    for (;;) {
+        // Exactly on each target reached, whatever the ramp's rounding
+        for (; t < numTargets_ && targets_[t].offset <= position; ++t) {
+            a1 = targets_[t].coefficients.a1;
+            a2 = targets_[t].coefficients.a2;
+            a3 = targets_[t].coefficients.a3;
+            k = targets_[t].coefficients.k;
+        }
+        if (position == numSamples) {
+            break;
+        }
+
+        size_t end = numSamples;
+        float a1Step = 0.0f;
+        float a2Step = 0.0f;
+        float a3Step = 0.0f;
+        float kStep = 0.0f;
+        if (t < numTargets_) {
+            const auto& target = targets_[t];
+            const float scale = 1.0f / static_cast<float>(target.offset - position);
+            a1Step = (target.coefficients.a1 - a1) * scale;
+            a2Step = (target.coefficients.a2 - a2) * scale;
+            a3Step = (target.coefficients.a3 - a3) * scale;
+            kStep = (target.coefficients.k - k) * scale;
+            end = std::min(target.offset, numSamples);
+        }
+
+        for (size_t i = position; i < end; ++i) {
+            a1 += a1Step;
+            a2 += a2Step;
+            a3 += a3Step;
+            k += kStep;
+
+            const float v3 = buffer[i] - ic2;
+            const float v1 = a1 * ic1 + a2 * v3;
+            const float v2 = ic2 + a2 * ic1 + a3 * v3;
+            ic1 = 2.0f * v1 - ic1;
+            ic2 = 2.0f * v2 - ic2;
+
+            buffer[i] = lowPass ? v2 : k * v1;
+        }
+        position = end;
+    }
+
+    // Targets past the end carry into the next call, counted from its start
+    size_t numCarried = 0;
+    for (; t < numTargets_; ++t) {
+        targets_[numCarried++] = { targets_[t].offset - numSamples, targets_[t].coefficients };
+    }
+    numTargets_ = numCarried;
+
+    current_ = { a1, a2, a3, k };
+    ic1_ = ic1;
+    ic2_ = ic2;
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
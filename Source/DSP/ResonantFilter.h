@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Common.h"
+#include <array>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Resonant Filter
+ *
+ * Zero-delay-feedback (topology-preserving) state-variable filter, low-
+ * pass or band-pass, for the classic siren sweeps. Resonance goes from
+ * flat (Q 0.5) to a sharp peak (Q 10); the band-pass is normalised to
+ * unity gain at its peak.
+ *
+ * Coefficients are worked out only when a target is set (control rate,
+ * one FastTan) and ramped linearly per sample in between, so a swept
+ * cutoff costs the same per sample as a static one. SetTarget() gives a
+ * sample offset into the next Process() call: the coefficients reach the
+ * target there, ramping from wherever the previous target left them.
+ * Offsets past the end of the call carry into the next one, so a ramp
+ * can span blocks. Unchanged targets cost nothing.
+ *
+ * Mode Off bypasses it (README: Signal Chain); it comes back from the
+ * first target set since.
+ */
+class ResonantFilter {
+public:
+    enum class Mode {
+        Off = 0,
+        LowPass,
+        BandPass
+    };
+
+    // Targets one Process() call can take, one per sample offset
+    static constexpr size_t kMaxTargets = kMaxBlockSize;
+
+    ResonantFilter();
+    ~ResonantFilter() = default;
+
+    void Init(float sampleRate);
+    void Reset();
+
+    void SetMode(Mode mode);
+
+    /**
+     * Cutoff (Hz) and resonance (0 to 1) to reach at sample offset of the
+     * next Process() call (or later, past its end). Offsets must not go
+     * backwards; a second target at the same offset replaces the first.
+     */
+    void SetTarget(float cutoff, float resonance, size_t offset);
+
+    void Process(float* buffer, size_t numSamples);
+
+    // Getters for testing
+    Mode GetMode() const { return mode_; }
+    float GetCutoff() const { return cutoff_; }
+    float GetResonance() const { return resonance_; }
+    bool IsActive() const { return active_; }
+    size_t GetNumPendingTargets() const { return numTargets_; }
+    uint32_t GetNumCoefficientUpdates() const { return numCoefficientUpdates_; }
+
+private:
+    struct Coefficients {
+        float a1 = 1.0f;
+        float a2 = 0.0f;
+        float a3 = 0.0f;
+        float k = 2.0f;     // Damping, 1 / Q
+    };
+
+    struct Target {
+        size_t offset;
+        Coefficients coefficients;
+    };
+
+    Coefficients ComputeCoefficients() const;
+
+    float sampleRate_;
+    float maxCutoff_;       // Below Nyquist, where FastTan holds
+    Mode mode_;
+
+    // Latest target, and the coefficients for it
+    float cutoff_;
+    float resonance_;
+    Coefficients latest_;
+
+    Coefficients current_;
+    std::array<Target, kMaxTargets> targets_;
+    size_t numTargets_;
+
+    // Integrator states
+    float ic1_;
+    float ic2_;
+
+    bool active_;           // Not bypassed last call
+    uint32_t numCoefficientUpdates_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,97 @@
+#include "TapeFeedback.h"
+#include <cassert>
+#include <cmath>
+
+namespace SimpleSynth {
+namespace DSP {
+
+TapeFeedback::TapeFeedback()
+    : sampleRate_(44100.0f)
+    , lowCut_(120.0f)
+    , highCut_(3500.0f)
+    , drive_(2.0f)
+    , inverseDrive_(0.5f)
+    , lowCutCoeff_(0.0f)
+    , highCutCoeff_(0.0f)
+    , lowCutState_(0.0f)
+    , highCutState_(0.0f)
+{
+    lowCutCoeff_ = OnePoleCoefficient(lowCut_);
+    highCutCoeff_ = OnePoleCoefficient(highCut_);
+}
+
+void TapeFeedback::Init(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+
+    lowCutCoeff_ = OnePoleCoefficient(lowCut_);
+    highCutCoeff_ = OnePoleCoefficient(highCut_);
+
+    Reset();
+}
+
+float TapeFeedback::OnePoleCoefficient(float frequency) const {
+    float cutoff = Clamp(frequency, kMinFrequency, sampleRate_ * 0.45f);
+    return 1.0f - std::exp(-kTwoPi * cutoff / sampleRate_);
+}
+
+void TapeFeedback::SetLowCut(float frequency) {
+    if (frequency == lowCut_) return;
+    lowCut_ = frequency;
+    lowCutCoeff_ = OnePoleCoefficient(lowCut_);
+}
+
+void TapeFeedback::SetHighCut(float frequency) {
+    if (frequency == highCut_) return;
+    highCut_ = frequency;
+    highCutCoeff_ = OnePoleCoefficient(highCut_);
+}
+
+void TapeFeedback::SetDrive(float drive) {
+    drive_ = Clamp(drive, 1.0f, 8.0f);
+    inverseDrive_ = 1.0f / drive_;
+}
+
+void TapeFeedback::Reset() {
+    lowCutState_ = 0.0f;
+    highCutState_ = 0.0f;
+}
+
+float TapeFeedback::ProcessSample(float input) {
+    // Low cut: subtract a low-passed copy
+    lowCutState_ += lowCutCoeff_ * (input - lowCutState_);
+    float highPassed = input - lowCutState_;
+
+    // High cut
+    highCutState_ += highCutCoeff_ * (highPassed - highCutState_);
+
+    lowCutState_ = PreventDenormal(lowCutState_);
+    highCutState_ = PreventDenormal(highCutState_);
+
+    return FastTanh(highCutState_ * drive_) * inverseDrive_;
+}
+
+void TapeFeedback::Process(float* buffer, size_t numSamples) {
+    assert(buffer != nullptr && "Buffer cannot be null");
+
+    // Filters are recursive, keep them in one tight loop on locals
+    float lowState = lowCutState_;
+    float highState = highCutState_;
+
+    for (size_t i = 0; i < numSamples; ++i) {
+        lowState += lowCutCoeff_ * (buffer[i] - lowState);
+        highState += highCutCoeff_ * ((buffer[i] - lowState) - highState);
+        buffer[i] = highState;
+    }
+
+    lowCutState_ = PreventDenormal(lowState);
+    highCutState_ = PreventDenormal(highState);
+
+    // Saturation has no state, so this loop vectorizes
+    for (size_t i = 0; i < numSamples; ++i) {
+        buffer[i] = FastTanh(buffer[i] * drive_) * inverseDrive_;
+    }
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Common.h"
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Tape Feedback Chain
+ *
+ * Cheap in-loop coloration for the DubDelay feedback path:
+ * one-pole low cut, one-pole high cut and soft saturation.
+ * Each pass through the loop darkens, thins and compresses the
+ * repeats the way a worn tape echo does.
+ *
+ * Cost notes:
+ * - Filter coefficients are recomputed only when a cutoff changes
+ * - Saturation uses FastTanh (rational, no std::tanh)
+ * - Saturation is normalized by drive so small signals pass at unity
+ *   and the delay's feedback amount keeps its meaning
+ */
+class TapeFeedback {
+public:
+    TapeFeedback();
+    ~TapeFeedback() = default;
+
+    void Init(float sampleRate);
+    void SetLowCut(float frequency);  // High-pass corner in Hz
+    void SetHighCut(float frequency); // Low-pass corner in Hz
+    void SetDrive(float drive);       // 1.0 (clean) to 8.0
+    void Reset();
+
+    float ProcessSample(float input);
+    void Process(float* buffer, size_t numSamples);
+
+    // Getters for testing
+    float GetLowCut() const { return lowCut_; }
+    float GetHighCut() const { return highCut_; }
+
+private:
+    float OnePoleCoefficient(float frequency) const;
+
+    float sampleRate_;
+    float lowCut_;
+    float highCut_;
+    float drive_;
+    float inverseDrive_;
+
+    // One-pole smoothing coefficients: y += coeff * (x - y)
+    float lowCutCoeff_;
+    float highCutCoeff_;
+
+    float lowCutState_;   // Low-passed copy subtracted for the high-pass
+    float highCutState_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
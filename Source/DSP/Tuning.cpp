@@ -0,0 +1,300 @@
+#include "Tuning.h"
+#include <cassert>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+namespace SimpleSynth {
+namespace DSP {
+
+namespace {
+
+// Floor division, so notes below the middle note land in lower octaves
+int FloorDiv(int value, int divisor) {
+    const int quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+// Non-comment lines, without trailing whitespace or CR. Scala comments start with '!'.
+std::vector<std::string> ReadScalaLines(const std::string& text, bool skipBlank) {
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+    std::string line;
+
+    while (std::getline(stream, line)) {
+        while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) {
+            line.pop_back();
+        }
+        if (!line.empty() && line[0] == '!') {
+            continue;
+        }
+        if (skipBlank && line.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+// First whitespace-separated token; anything after it is a comment
+std::string FirstToken(const std::string& line) {
+    std::istringstream fields(line);
+    std::string token;
+    fields >> token;
+    return token;
+}
+
+bool ParseInt(const std::string& token, int& value) {
+    if (token.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    const long parsed = std::strtol(token.c_str(), &end, 10);
+    if (*end != '\0') {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+bool ParseDouble(const std::string& token, double& value) {
+    if (token.empty()) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtod(token.c_str(), &end);
+    return *end == '\0' && std::isfinite(value);
+}
+
+// Scala pitch: cents if it has a '.', otherwise a ratio "n/d" or integer "n"
+bool ParsePitch(const std::string& token, double& cents) {
+    if (token.find('.') != std::string::npos) {
+        return ParseDouble(token, cents);
+    }
+
+    const size_t slash = token.find('/');
+    double numerator = 0.0;
+    double denominator = 1.0;
+
+    if (!ParseDouble(token.substr(0, slash), numerator)) {
+        return false;
+    }
+    if (slash != std::string::npos && !ParseDouble(token.substr(slash + 1), denominator)) {
+        return false;
+    }
+    if (numerator <= 0.0 || denominator <= 0.0) {
+        return false;
+    }
+
+    cents = 1200.0 * std::log2(numerator / denominator);
+    return true;
+}
+
+} // namespace
+
+Tuning::Tuning()
+    : degreeCents_{}
+    , numDegrees_(0)
+    , keyDegrees_{}
+    , mapSize_(0)
+    , firstNote_(0)
+    , lastNote_(kNumNotes - 1)
+    , middleNote_(60)
+    , referenceNote_(kMidiA4)
+    , referenceFrequency_(kA4Frequency)
+    , octaveDegree_(0)
+    , sampleRate_(44100.0f)
+    , frequencies_{}
+    , phaseIncrements_{}
+    , mapped_{}
+{
+    ResetScale();
+    ResetKeyboardMapping();
+}
+
+void Tuning::SetSampleRate(float sampleRate) {
+    assert(sampleRate > 0.0f && "Sample rate must be positive");
+    sampleRate_ = sampleRate;
+    RebuildPhaseIncrements();
+}
+
+bool Tuning::LoadScala(const std::string& text) {
+    // Line 1: description (may be blank), line 2: degree count, then one pitch per degree
+    const auto lines = ReadScalaLines(text, false);
+    if (lines.size() < 2) {
+        return false;
+    }
+
+    int count = 0;
+    if (!ParseInt(FirstToken(lines[1]), count) || count < 1
+        || count > static_cast<int>(kMaxScaleDegrees)
+        || lines.size() < static_cast<size_t>(count) + 2) {
+        return false;
+    }
+
+    std::array<double, kMaxScaleDegrees> cents{};
+    for (int degree = 0; degree < count; ++degree) {
+        if (!ParsePitch(FirstToken(lines[static_cast<size_t>(degree) + 2]), cents[static_cast<size_t>(degree)])) {
+            return false;
+        }
+    }
+
+    // The last degree is the period; the mapping repeats at it
+    if (cents[static_cast<size_t>(count) - 1] <= 0.0) {
+        return false;
+    }
+
+    degreeCents_ = cents;
+    numDegrees_ = static_cast<size_t>(count);
+    RebuildFrequencies();
+    return true;
+}
+
+bool Tuning::LoadKeyboardMapping(const std::string& text) {
+    const auto lines = ReadScalaLines(text, true);
+    if (lines.size() < 7) {
+        return false;
+    }
+
+    int header[5] = {};
+    for (size_t i = 0; i < 5; ++i) {
+        if (!ParseInt(FirstToken(lines[i]), header[i])) {
+            return false;
+        }
+    }
+
+    double frequency = 0.0;
+    int octaveDegree = 0;
+    if (!ParseDouble(FirstToken(lines[5]), frequency) || !ParseInt(FirstToken(lines[6]), octaveDegree)) {
+        return false;
+    }
+
+    const int mapSize = header[0];
+    const int firstNote = header[1];
+    const int lastNote = header[2];
+    const int middleNote = header[3];
+    const int referenceNote = header[4];
+
+    auto isNote = [](int note) { return note >= 0 && note < kNumNotes; };
+
+    if (mapSize < 0 || mapSize > static_cast<int>(kMaxMapSize) || !isNote(firstNote)
+        || !isNote(lastNote) || firstNote > lastNote || !isNote(middleNote)
+        || !isNote(referenceNote) || frequency <= 0.0 || octaveDegree < 0) {
+        return false;
+    }
+
+    // Keys past the end of a short mapping are unmapped
+    std::array<int, kMaxMapSize> keyDegrees;
+    keyDegrees.fill(-1);
+    for (int key = 0; key < mapSize && static_cast<size_t>(key) + 7 < lines.size(); ++key) {
+        const std::string token = FirstToken(lines[static_cast<size_t>(key) + 7]);
+        if (token == "x" || token == "X") {
+            continue;
+        }
+        int degree = 0;
+        if (!ParseInt(token, degree) || degree < 0) {
+            return false;
+        }
+        keyDegrees[static_cast<size_t>(key)] = degree;
+    }
+
+    keyDegrees_ = keyDegrees;
+    mapSize_ = static_cast<size_t>(mapSize);
+    firstNote_ = firstNote;
+    lastNote_ = lastNote;
+    middleNote_ = middleNote;
+    referenceNote_ = referenceNote;
+    referenceFrequency_ = static_cast<float>(frequency);
+    octaveDegree_ = octaveDegree;
+    RebuildFrequencies();
+    return true;
+}
+
+void Tuning::ResetScale() {
+    degreeCents_.fill(0.0);
+    for (size_t degree = 0; degree < 12; ++degree) {
+        degreeCents_[degree] = 100.0 * static_cast<double>(degree + 1);
+    }
+    numDegrees_ = 12;
+    RebuildFrequencies();
+}
+
+void Tuning::ResetKeyboardMapping() {
+    keyDegrees_.fill(-1);
+    mapSize_ = 0;
+    firstNote_ = 0;
+    lastNote_ = kNumNotes - 1;
+    middleNote_ = 60;
+    referenceNote_ = kMidiA4;
+    referenceFrequency_ = kA4Frequency;
+    octaveDegree_ = 0;
+    RebuildFrequencies();
+}
+
+double Tuning::DegreeToCents(int degree) const {
+    const int numDegrees = static_cast<int>(numDegrees_);
+    const int period = FloorDiv(degree, numDegrees);
+    const int step = degree - period * numDegrees;
+
+    const double periodCents = degreeCents_[numDegrees_ - 1];
+    const double stepCents = (step == 0) ? 0.0 : degreeCents_[static_cast<size_t>(step) - 1];
+    return static_cast<double>(period) * periodCents + stepCents;
+}
+
+bool Tuning::NoteToDegree(int midiNote, int& degree) const {
+    const int offset = midiNote - middleNote_;
+
+    if (mapSize_ == 0) {
+        degree = offset;
+        return midiNote >= firstNote_ && midiNote <= lastNote_;
+    }
+
+    // The mapping repeats every mapSize_ keys, octaveDegree_ degrees higher
+    const int mapSize = static_cast<int>(mapSize_);
+    const int repeat = FloorDiv(offset, mapSize);
+    const int key = offset - repeat * mapSize;
+    const int keyDegree = keyDegrees_[static_cast<size_t>(key)];
+    const int octaveDegree = (octaveDegree_ > 0) ? octaveDegree_ : static_cast<int>(numDegrees_);
+
+    // Unmapped keys still get a pitch (as if mapped linearly) so
+    // interpolation across them stays smooth
+    degree = repeat * octaveDegree + ((keyDegree >= 0) ? keyDegree : key);
+    return keyDegree >= 0 && midiNote >= firstNote_ && midiNote <= lastNote_;
+}
+
+void Tuning::RebuildFrequencies() {
+    // The reference frequency pins the reference note's degree, mapped or not
+    int referenceDegree = 0;
+    NoteToDegree(referenceNote_, referenceDegree);
+    const double referenceCents = DegreeToCents(referenceDegree);
+
+    for (int note = 0; note < kNumNotes; ++note) {
+        int degree = 0;
+        mapped_[static_cast<size_t>(note)] = NoteToDegree(note, degree);
+
+        const double cents = DegreeToCents(degree) - referenceCents;
+        frequencies_[static_cast<size_t>(note)] =
+            static_cast<float>(referenceFrequency_ * std::exp2(cents / 1200.0));
+    }
+
+    RebuildPhaseIncrements();
+}
+
+void Tuning::RebuildPhaseIncrements() {
+    const float inverseSampleRate = 1.0f / sampleRate_;
+    for (size_t note = 0; note < frequencies_.size(); ++note) {
+        phaseIncrements_[note] = frequencies_[note] * inverseSampleRate;
+    }
+}
+
+float Tuning::Interpolate(const std::array<float, kNumNotes>& table, float midiNote) {
+    const float note = Clamp(midiNote, 0.0f, static_cast<float>(kNumNotes - 1));
+    const int index = std::min(static_cast<int>(note), kNumNotes - 2);
+    const float fraction = note - static_cast<float>(index);
+    return Lerp(table[static_cast<size_t>(index)], table[static_cast<size_t>(index) + 1], fraction);
+}
+
+} // namespace DSP
+} // namespace SimpleSynth
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Common.h"
+#include <array>
+#include <string>
+
+namespace SimpleSynth {
+namespace DSP {
+
+/**
+ * Tuning Table
+ *
+ * Frequency and phase-increment per MIDI note, rebuilt whenever the
+ * scale, keyboard mapping or sample rate changes, so note lookups never
+ * call pow(). Fractional notes (bends, glides between keys) interpolate
+ * between neighbouring entries.
+ *
+ * Defaults to 12-tone equal temperament with A4 = 440 Hz. Alternative
+ * tunings load from Scala files:
+ * - .scl: scale degrees in cents ("701.955") or ratios ("3/2", "2")
+ * - .kbm: keyboard mapping (middle note, reference note and frequency,
+ *   which keys play which degree; "x" leaves a key unmapped)
+ *
+ * Everything is stored inline, so a Tuning can be copied to the audio
+ * thread without allocating. Load*() parse strings: message thread only.
+ */
+class Tuning {
+public:
+    static constexpr int kNumNotes = 128;
+    static constexpr size_t kMaxScaleDegrees = 128;
+    static constexpr size_t kMaxMapSize = 128;
+
+    Tuning();
+    ~Tuning() = default;
+
+    void SetSampleRate(float sampleRate); // Rebuilds phase increments only
+
+    /**
+     * Load a Scala scale (.scl contents). Returns false and keeps the
+     * current scale if the text doesn't parse.
+     */
+    bool LoadScala(const std::string& text);
+
+    /**
+     * Load a Scala keyboard mapping (.kbm contents). Returns false and
+     * keeps the current mapping if the text doesn't parse.
+     */
+    bool LoadKeyboardMapping(const std::string& text);
+
+    void ResetScale();           // 12-TET
+    void ResetKeyboardMapping(); // Linear mapping, A4 = 440 Hz
+
+    float GetFrequency(int midiNote) const {
+        return frequencies_[static_cast<size_t>(Clamp(midiNote, 0, kNumNotes - 1))];
+    }
+
+    float GetPhaseIncrement(int midiNote) const {
+        return phaseIncrements_[static_cast<size_t>(Clamp(midiNote, 0, kNumNotes - 1))];
+    }
+
+    // Fractional notes, linearly interpolated (within a cent for 12-TET steps)
+    float GetFrequency(float midiNote) const { return Interpolate(frequencies_, midiNote); }
+    float GetPhaseIncrement(float midiNote) const { return Interpolate(phaseIncrements_, midiNote); }
+
+    // Unmapped keys (kbm "x", or outside its note range) shouldn't sound
+    bool IsMapped(int midiNote) const {
+        return midiNote >= 0 && midiNote < kNumNotes && mapped_[static_cast<size_t>(midiNote)];
+    }
+
+    // Getters for testing
+    float GetReferenceFrequency() const { return referenceFrequency_; }
+    int GetReferenceNote() const { return referenceNote_; }
+    size_t GetNumScaleDegrees() const { return numDegrees_; }
+    float GetSampleRate() const { return sampleRate_; }
+
+private:
+    void RebuildFrequencies();
+    void RebuildPhaseIncrements();
+    double DegreeToCents(int degree) const;
+    bool NoteToDegree(int midiNote, int& degree) const;
+
+    static float Interpolate(const std::array<float, kNumNotes>& table, float midiNote);
+
+    // Scale: cents of degrees 1..N (degree 0 is 0 cents, degree N the period)
+    std::array<double, kMaxScaleDegrees> degreeCents_;
+    size_t numDegrees_;
+
+    // Keyboard mapping (mapSize_ 0 = every key is the next degree)
+    std::array<int, kMaxMapSize> keyDegrees_;   // -1 = unmapped
+    size_t mapSize_;
+    int firstNote_;
+    int lastNote_;
+    int middleNote_;
+    int referenceNote_;
+    float referenceFrequency_;
+    int octaveDegree_;                         // Degree the mapping repeats at
+
+    float sampleRate_;
+    std::array<float, kNumNotes> frequencies_;
+    std::array<float, kNumNotes> phaseIncrements_;
+    std::array<bool, kNumNotes> mapped_;
+};
+
+} // namespace DSP
+} // namespace SimpleSynth
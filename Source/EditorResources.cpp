@@ -0,0 +1,23 @@
+#include "EditorResources.h"
+#include <BinaryData.h>
+
+EditorResources::EditorResources()
+{
+    decodeThread = std::thread([this] {
+        const auto start = juce::Time::getMillisecondCounterHiRes();
+        panelImage = juce::ImageFileFormat::loadFrom(BinaryData::panel_jpg, BinaryData::panel_jpgSize);
+        decodeMilliseconds.store(juce::Time::getMillisecondCounterHiRes() - start, std::memory_order_release);
+        panelDecoded.store(true, std::memory_order_release);
+    });
+}
+
+EditorResources::~EditorResources()
+{
+    // Plugin unloading right after loading: let the decode finish
+    decodeThread.join();
+}
+
+juce::Image EditorResources::getPanelImage() const
+{
+    return isPanelDecoded() ? panelImage : juce::Image();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <atomic>
+#include <thread>
+
+/**
+ * Editor resources shared by every plugin instance in the process, held
+ * through juce::SharedResourcePointer<EditorResources>.
+ *
+ * The processor holds one, so the panel JPEG is decoded on a background
+ * thread as soon as the plugin loads, once per process rather than on
+ * every editor open. An editor opened before decoding finishes shows a
+ * placeholder and picks the panel up from its timer.
+ */
+class EditorResources
+{
+public:
+    EditorResources();
+    ~EditorResources();
+
+    // The decoded panel; invalid while decoding, or if decoding failed
+    juce::Image getPanelImage() const;
+    bool isPanelDecoded() const { return panelDecoded.load(std::memory_order_acquire); }
+
+    // Time the background decode took (for the editor benchmark)
+    double getPanelDecodeMilliseconds() const { return decodeMilliseconds.load(std::memory_order_acquire); }
+
+private:
+    // Written once by the decode thread before panelDecoded is set
+    juce::Image panelImage;
+    std::atomic<bool> panelDecoded { false };
+    std::atomic<double> decodeMilliseconds { 0.0 };
+    std::thread decodeThread;
+
+    JUCE_DECLARE_NON_COPYABLE (EditorResources)
+};
@@ -0,0 +1,94 @@
+#include "OutputRecorder.h"
+#include <chrono>
+
+OutputRecorder::OutputRecorder()
+    : ring(std::make_unique<Ring>())
+{
+}
+
+OutputRecorder::~OutputRecorder()
+{
+    stop();
+}
+
+bool OutputRecorder::start(const juce::File& fileToWrite, double sampleRate)
+{
+    stop();
+
+    fileToWrite.getParentDirectory().createDirectory();
+    fileToWrite.deleteFile();
+
+    auto stream = std::make_unique<juce::FileOutputStream>(fileToWrite, static_cast<size_t>(fileBufferSize));
+    if (stream->failedToOpen())
+        return false;
+
+    std::unique_ptr<juce::AudioFormat> format;
+    if (fileToWrite.hasFileExtension("flac"))
+        format = std::make_unique<juce::FlacAudioFormat>();
+    else
+        format = std::make_unique<juce::WavAudioFormat>();
+
+    writer.reset(format->createWriterFor(stream.get(), sampleRate, 1, bitsPerSample, {}, 0));
+    if (writer == nullptr)
+        return false;
+
+    stream.release(); // owned by the writer now
+    file = fileToWrite;
+
+    // Blocks the audio thread queued after the last recording's final drain
+    ring->Consume(ring->GetNumReady());
+
+    samplesWritten.store(0, std::memory_order_relaxed);
+    droppedSamples.store(0, std::memory_order_relaxed);
+
+    writerRunning.store(true, std::memory_order_release);
+    writerThread = std::thread([this] { writerLoop(); });
+    recording.store(true, std::memory_order_release);
+    return true;
+}
+
+void OutputRecorder::stop()
+{
+    if (! writerThread.joinable())
+        return;
+
+    recording.store(false, std::memory_order_release);
+    writerRunning.store(false, std::memory_order_release);
+    writerThread.join();
+
+    // What was queued before recording stopped, then the header is finalised
+    drain();
+    writer.reset();
+}
+
+void OutputRecorder::process(const float* samples, int numSamples)
+{
+    if (! recording.load(std::memory_order_acquire) || numSamples <= 0)
+        return;
+
+    if (! ring->Write(samples, static_cast<size_t>(numSamples)))
+        droppedSamples.fetch_add(numSamples, std::memory_order_relaxed);
+}
+
+void OutputRecorder::writerLoop()
+{
+    while (writerRunning.load(std::memory_order_acquire))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(flushIntervalMs));
+        drain();
+    }
+}
+
+void OutputRecorder::drain()
+{
+    const auto regions = ring->GetReadRegions();
+
+    // Straight from the ring to the encoder
+    if (regions.firstSize > 0)
+        writer->writeFromFloatArrays(&regions.first, 1, static_cast<int>(regions.firstSize));
+    if (regions.secondSize > 0)
+        writer->writeFromFloatArrays(&regions.second, 1, static_cast<int>(regions.secondSize));
+
+    ring->Consume(regions.GetSize());
+    samplesWritten.fetch_add(static_cast<juce::int64>(regions.GetSize()), std::memory_order_relaxed);
+}
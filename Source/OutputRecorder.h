@@ -0,0 +1,69 @@
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "Util/SampleRing.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+/**
+ * Streams the plugin's output to a WAV or FLAC file while playing.
+ *
+ * The audio thread only copies each block into a preallocated lock-free
+ * ring (SimpleSynth::Util::SampleRing). A writer thread drains the ring
+ * every flushIntervalMs and hands the queued samples, in place, to the
+ * encoder, which writes through a large buffered file stream. The audio
+ * thread never touches the file.
+ *
+ * If the writer falls more than the ring's length behind, whole blocks
+ * are dropped and counted (getNumDroppedSamples()); the file is shorter
+ * by that much, and nothing on the audio thread waits.
+ *
+ * Threading: start()/stop() on one thread (the message thread), process()
+ * on the audio thread, the getters from anywhere.
+ */
+class OutputRecorder
+{
+public:
+    static constexpr size_t ringSize = 1 << 18;     // Samples: ~5 s at 48 kHz
+    static constexpr int flushIntervalMs = 50;
+    static constexpr int bitsPerSample = 24;
+    static constexpr int fileBufferSize = 1 << 18;  // Bytes
+
+    OutputRecorder();
+    ~OutputRecorder();
+
+    // Begin recording to file (.flac for FLAC, anything else WAV), replacing
+    // it. Returns false if the file can't be written. Stops a running recording.
+    bool start(const juce::File& file, double sampleRate);
+    void stop();
+
+    bool isRecording() const { return recording.load(std::memory_order_acquire); }
+    juce::File getFile() const { return file; }
+
+    // Audio thread: queue a block; no-op unless recording. Wait-free.
+    void process(const float* samples, int numSamples);
+
+    // For the current or last recording
+    juce::int64 getNumSamplesWritten() const { return samplesWritten.load(std::memory_order_relaxed); }
+    juce::int64 getNumDroppedSamples() const { return droppedSamples.load(std::memory_order_relaxed); }
+
+private:
+    void writerLoop();
+    void drain();
+
+    using Ring = SimpleSynth::Util::SampleRing<ringSize>;
+    const std::unique_ptr<Ring> ring;
+
+    std::atomic<bool> recording { false };
+    std::atomic<juce::int64> samplesWritten { 0 };
+    std::atomic<juce::int64> droppedSamples { 0 };
+
+    // Owned by start()/stop() and the writer thread between them
+    juce::File file;
+    std::unique_ptr<juce::AudioFormatWriter> writer;
+    std::atomic<bool> writerRunning { false };
+    std::thread writerThread;
+
+    JUCE_DECLARE_NON_COPYABLE (OutputRecorder)
+};
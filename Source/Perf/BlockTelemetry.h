@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef DUBSIREN_TELEMETRY
+ #define DUBSIREN_TELEMETRY 0
+#endif
+
+#if DUBSIREN_TELEMETRY
+ #include "Util/SpscRing.h"
+#endif
+
+namespace SimpleSynth {
+namespace Perf {
+
+/**
+ * One processBlock call as seen by the telemetry ring.
+ */
+struct BlockStats {
+    float durationMicroseconds = 0.0f;
+    uint32_t numSamples = 0;
+    float loadFraction = 0.0f;     // duration / (numSamples / sampleRate)
+    uint32_t activeVoices = 0;
+};
+
+/**
+ * Per-Block CPU Telemetry
+ *
+ * The audio thread pushes one BlockStats per processBlock into an SPSC
+ * ring; the editor drains it on a timer. Push() is wait-free - when the
+ * editor is closed or slow the ring fills and new blocks are dropped,
+ * which only costs the GUI some history.
+ *
+ * Built with DUBSIREN_TELEMETRY=0 (CMake option DUBSIREN_TELEMETRY=OFF)
+ * the class is empty and Push()/Drain() are inline no-ops, so the calls
+ * compile to nothing.
+ */
+class BlockTelemetry {
+public:
+    static constexpr bool kEnabled = (DUBSIREN_TELEMETRY != 0);
+
+    // ~1.4 s of history at 48 kHz / 64-sample blocks
+    static constexpr size_t kRingSize = 1024;
+
+    /**
+     * Audio thread: record one block. Drops the entry if the ring is full.
+     */
+    void Push(const BlockStats& stats) {
+#if DUBSIREN_TELEMETRY
+        ring_.Push(stats);
+#else
+        (void) stats;
+#endif
+    }
+
+    /**
+     * Reader thread: hand every waiting entry to callback(const BlockStats&).
+     * Returns the number of entries drained.
+     */
+    template <typename Callback>
+    size_t Drain(Callback&& callback) {
+#if DUBSIREN_TELEMETRY
+        size_t count = 0;
+        BlockStats stats;
+        while (ring_.Pop(stats)) {
+            callback(stats);
+            ++count;
+        }
+        return count;
+#else
+        (void) callback;
+        return 0;
+#endif
+    }
+
+private:
+#if DUBSIREN_TELEMETRY
+    Util::SpscRing<BlockStats, kRingSize> ring_;
+#endif
+};
+
+} // namespace Perf
+} // namespace SimpleSynth
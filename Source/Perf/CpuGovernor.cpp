@@ -0,0 +1,88 @@
+#include "CpuGovernor.h"
+#include <algorithm>
+#include <cassert>
+
+namespace SimpleSynth {
+namespace Perf {
+
+CpuGovernor::CpuGovernor()
+    : numTiers_(1)
+    , ceiling_(0)
+    , average_(0.0f)
+    , settleCountdown_(0)
+    , headroomCount_(0)
+    , tier_(0)
+    , averageLoad_(0.0f)
+{
+    tierCosts_.fill(1.0f);
+}
+
+void CpuGovernor::SetTierCosts(const float* costs, size_t numTiers) {
+    assert(costs != nullptr && numTiers > 0 && numTiers <= kMaxTiers && "Invalid tier costs");
+
+    numTiers_ = std::min(numTiers, kMaxTiers);
+    for (size_t t = 0; t < numTiers_; ++t) {
+        tierCosts_[t] = std::max(costs[t], 1e-3f);
+    }
+
+    SetCeiling(std::min(ceiling_, numTiers_ - 1));
+}
+
+void CpuGovernor::SetCeiling(size_t tier) {
+    tier = std::min(tier, numTiers_ - 1);
+    if (tier == ceiling_) return;
+
+    ceiling_ = tier;
+    SetTier(ceiling_);
+}
+
+void CpuGovernor::Reset() {
+    average_ = 0.0f;
+    averageLoad_.store(0.0f, std::memory_order_relaxed);
+    SetTier(ceiling_);
+}
+
+void CpuGovernor::SetTier(size_t tier) {
+    tier_.store(tier, std::memory_order_relaxed);
+    settleCountdown_ = kSettleBlocks;
+    headroomCount_ = 0;
+}
+
+size_t CpuGovernor::Update(float loadFraction) {
+    average_ += kAverageCoefficient * (loadFraction - average_);
+    averageLoad_.store(average_, std::memory_order_relaxed);
+
+    size_t tier = tier_.load(std::memory_order_relaxed);
+
+    if (settleCountdown_ > 0) {
+        --settleCountdown_;
+        return tier;
+    }
+
+    if (tier > 0 && (average_ > kStepDownLoad || loadFraction > kPanicLoad)) {
+        // Rescale the average to the cheaper tier so the next decision
+        // doesn't wait for the old tier's load to decay out of it
+        average_ *= tierCosts_[tier - 1] / tierCosts_[tier];
+        SetTier(tier - 1);
+        return tier - 1;
+    }
+
+    if (tier < ceiling_) {
+        float predictedLoad = average_ * tierCosts_[tier + 1] / tierCosts_[tier];
+
+        if (predictedLoad < kStepUpLoad) {
+            if (++headroomCount_ >= kHeadroomBlocks) {
+                average_ = predictedLoad;
+                SetTier(tier + 1);
+                return tier + 1;
+            }
+        } else {
+            headroomCount_ = 0;
+        }
+    }
+
+    return tier;
+}
+
+} // namespace Perf
+} // namespace SimpleSynth
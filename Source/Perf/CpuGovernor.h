@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace SimpleSynth {
+namespace Perf {
+
+/**
+ * Adaptive CPU-Budget Governor
+ *
+ * Steps the processor down to cheaper quality tiers when block processing
+ * time approaches the buffer deadline, and back up with hysteresis once
+ * there is headroom again. Tiers are indices ordered cheapest first
+ * (see DSP::QualityTier).
+ *
+ * The audio thread feeds one load sample per block:
+ *     load = processing time / (numSamples / sampleRate)
+ * and the governor keeps an exponential moving average of it.
+ *
+ * Step down: average above kStepDownLoad, or a single block above
+ * kPanicLoad. Takes effect immediately, then waits kSettleBlocks so the
+ * cheaper tier's timing is measured before deciding again.
+ *
+ * Step up: only after kHeadroomBlocks consecutive blocks whose average,
+ * scaled by the next tier's relative cost, would still be under
+ * kStepUpLoad. Without the cost scaling an expensive tier (4x
+ * oversampling) would be re-entered and immediately dropped again.
+ *
+ * Threading: Update() is audio-thread only (single writer). GetTier()
+ * and GetAverageLoad() are lock-free atomic reads, safe from any thread.
+ */
+class CpuGovernor {
+public:
+    static constexpr size_t kMaxTiers = 8;
+
+    static constexpr float kStepDownLoad = 0.70f;
+    static constexpr float kPanicLoad = 0.95f;
+    static constexpr float kStepUpLoad = 0.50f;
+    static constexpr float kAverageCoefficient = 0.1f;
+    static constexpr size_t kSettleBlocks = 16;
+    static constexpr size_t kHeadroomBlocks = 200;
+
+    CpuGovernor();
+    ~CpuGovernor() = default;
+
+    /**
+     * Set tier count and relative cost of each tier (cheapest first).
+     * Costs only need to be right relative to each other.
+     */
+    void SetTierCosts(const float* costs, size_t numTiers);
+
+    /**
+     * Highest tier the governor may use (the user's/host's choice).
+     * Raising the ceiling jumps straight to it; the governor steps
+     * back down if it turns out too expensive.
+     */
+    void SetCeiling(size_t tier);
+
+    /**
+     * Feed one block's load fraction. Returns the tier for the next block.
+     */
+    size_t Update(float loadFraction);
+
+    void Reset();
+
+    size_t GetTier() const { return tier_.load(std::memory_order_relaxed); }
+    size_t GetCeiling() const { return ceiling_; }
+    float GetAverageLoad() const { return averageLoad_.load(std::memory_order_relaxed); }
+
+private:
+    void SetTier(size_t tier);
+
+    std::array<float, kMaxTiers> tierCosts_;
+    size_t numTiers_;
+    size_t ceiling_;
+
+    float average_;
+    size_t settleCountdown_;
+    size_t headroomCount_;
+
+    // Published for the editor
+    std::atomic<size_t> tier_;
+    std::atomic<float> averageLoad_;
+};
+
+} // namespace Perf
+} // namespace SimpleSynth
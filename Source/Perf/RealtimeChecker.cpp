@@ -0,0 +1,69 @@
+#include "RealtimeChecker.h"
+
+#if defined(__GNUC__)
+
+// Hooks defined by RealtimeInterpose.cpp. Weak, so a build without the
+// interposer still links and the checker quietly does nothing.
+extern "C" {
+__attribute__((weak)) void dubsiren_rt_enter();
+__attribute__((weak)) void dubsiren_rt_leave();
+__attribute__((weak)) uint64_t dubsiren_rt_violations();
+__attribute__((weak)) void dubsiren_rt_reset();
+__attribute__((weak)) void dubsiren_rt_report_stacks(int enabled);
+}
+
+namespace SimpleSynth {
+namespace Perf {
+
+bool RealtimeChecker::IsAvailable() {
+    return dubsiren_rt_enter != nullptr;
+}
+
+void RealtimeChecker::EnterSection() {
+    if (dubsiren_rt_enter != nullptr) {
+        dubsiren_rt_enter();
+    }
+}
+
+void RealtimeChecker::LeaveSection() {
+    if (dubsiren_rt_leave != nullptr) {
+        dubsiren_rt_leave();
+    }
+}
+
+uint64_t RealtimeChecker::GetNumViolations() {
+    return (dubsiren_rt_violations != nullptr) ? dubsiren_rt_violations() : 0;
+}
+
+void RealtimeChecker::ResetViolations() {
+    if (dubsiren_rt_reset != nullptr) {
+        dubsiren_rt_reset();
+    }
+}
+
+void RealtimeChecker::SetReportStacks(bool reportStacks) {
+    if (dubsiren_rt_report_stacks != nullptr) {
+        dubsiren_rt_report_stacks(reportStacks ? 1 : 0);
+    }
+}
+
+} // namespace Perf
+} // namespace SimpleSynth
+
+#else
+
+// No weak symbols (MSVC): the checker is never available
+namespace SimpleSynth {
+namespace Perf {
+
+bool RealtimeChecker::IsAvailable() { return false; }
+void RealtimeChecker::EnterSection() {}
+void RealtimeChecker::LeaveSection() {}
+uint64_t RealtimeChecker::GetNumViolations() { return 0; }
+void RealtimeChecker::ResetViolations() {}
+void RealtimeChecker::SetReportStacks(bool) {}
+
+} // namespace Perf
+} // namespace SimpleSynth
+
+#endif
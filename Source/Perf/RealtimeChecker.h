@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+#ifndef DUBSIREN_REALTIME_CHECK
+ #define DUBSIREN_REALTIME_CHECK 0
+#endif
+
+namespace SimpleSynth {
+namespace Perf {
+
+/**
+ * Realtime-Safety Checker
+ *
+ * Flags heap allocation/deallocation (malloc family, operator new/delete)
+ * and pthread_mutex_lock calls made while a realtime section is open on
+ * the calling thread, and prints the offending call stack to stderr.
+ *
+ * The checking itself lives in RealtimeInterpose.cpp, which replaces
+ * those functions (Linux/glibc only). It is either linked straight into
+ * a test executable (see Tests/test_RealtimeSafety.cpp) or built as the
+ * DubSirenRealtimeCheck shared library and LD_PRELOADed into a host:
+ *
+ *     LD_PRELOAD=libDubSirenRealtimeCheck.so <host>
+ *
+ * This class only talks to the interposer through weak hooks. Without
+ * one, every call here is a no-op and IsAvailable() returns false.
+ */
+class RealtimeChecker {
+public:
+    /**
+     * True if the interposer is linked in or preloaded.
+     */
+    static bool IsAvailable();
+
+    /**
+     * Open / close a realtime section on the calling thread (nestable).
+     */
+    static void EnterSection();
+    static void LeaveSection();
+
+    /**
+     * Violations seen in any thread's realtime sections since the last reset.
+     */
+    static uint64_t GetNumViolations();
+    static void ResetViolations();
+
+    /**
+     * Print a stack trace per violation (default) or only count them.
+     */
+    static void SetReportStacks(bool reportStacks);
+};
+
+/**
+ * Marks the enclosing scope as realtime for the checker.
+ */
+class ScopedRealtimeSection {
+public:
+    ScopedRealtimeSection() { RealtimeChecker::EnterSection(); }
+    ~ScopedRealtimeSection() { RealtimeChecker::LeaveSection(); }
+
+    ScopedRealtimeSection(const ScopedRealtimeSection&) = delete;
+    ScopedRealtimeSection& operator=(const ScopedRealtimeSection&) = delete;
+};
+
+} // namespace Perf
+} // namespace SimpleSynth
+
+// Realtime section marker; compiles to nothing unless built with DUBSIREN_REALTIME_CHECK=1
+#if DUBSIREN_REALTIME_CHECK
+ #define DUBSIREN_REALTIME_SECTION() \
+     ::SimpleSynth::Perf::ScopedRealtimeSection dubsirenRealtimeSection_
+#else
+ #define DUBSIREN_REALTIME_SECTION() ((void) 0)
+#endif
@@ -0,0 +1,220 @@
+/**
+ * Realtime-Safety Interposer
+ *
+ * Replaces malloc/calloc/realloc/free/posix_memalign/aligned_alloc,
+ * global operator new/delete and pthread_mutex_lock with versions that
+ * report a violation when called inside a realtime section (see
+ * RealtimeChecker.h), then forward to glibc.
+ *
+ * Link into an executable, or build as a shared library for LD_PRELOAD.
+ * Never link into the plugin itself: a dlopen'ed library can't
+ * interpose symbols the host has already bound.
+ *
+ * Linux/glibc only - forwarding uses glibc's __libc_* entry points so
+ * the allocator hooks don't need dlsym (which itself allocates).
+ */
+
+#if defined(__linux__)
+ #include <features.h> // defines __GLIBC__
+#endif
+
+#if defined(__linux__) && defined(__GLIBC__)
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <unistd.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* pointer);
+}
+
+namespace {
+
+constexpr int kMaxFrames = 48;
+
+// Initial-exec TLS never allocates on first access, so it is safe inside malloc
+__thread int sectionDepth __attribute__((tls_model("initial-exec"))) = 0;
+__thread int reporting __attribute__((tls_model("initial-exec"))) = 0;
+
+std::atomic<uint64_t> numViolations { 0 };
+std::atomic<int> reportStacks { 1 };
+
+void WriteString(const char* text) {
+    ssize_t ignored = ::write(STDERR_FILENO, text, std::strlen(text));
+    (void) ignored;
+}
+
+void Report(const char* what) {
+    if (sectionDepth == 0 || reporting != 0) {
+        return;
+    }
+
+    // Anything the report itself does (backtrace may load libgcc) is exempt
+    reporting = 1;
+    numViolations.fetch_add(1, std::memory_order_relaxed);
+
+    if (reportStacks.load(std::memory_order_relaxed) != 0) {
+        WriteString("[DubSiren realtime check] ");
+        WriteString(what);
+        WriteString(" called inside a realtime section:\n");
+
+        // backtrace_symbols_fd writes straight to the fd without allocating
+        void* frames[kMaxFrames];
+        int numFrames = backtrace(frames, kMaxFrames);
+        backtrace_symbols_fd(frames, numFrames, STDERR_FILENO);
+        WriteString("\n");
+    }
+
+    reporting = 0;
+}
+
+// First backtrace() call dlopens the unwinder; get that over with at load time
+[[maybe_unused]] const bool backtraceWarmed = [] {
+    void* frame[1];
+    return backtrace(frame, 1) >= 0;
+}();
+
+} // namespace
+
+//==============================================================================
+// Section hooks (found by RealtimeChecker.cpp through weak references)
+extern "C" {
+
+__attribute__((visibility("default"))) void dubsiren_rt_enter() { ++sectionDepth; }
+__attribute__((visibility("default"))) void dubsiren_rt_leave() { --sectionDepth; }
+
+__attribute__((visibility("default"))) uint64_t dubsiren_rt_violations() {
+    return numViolations.load(std::memory_order_relaxed);
+}
+
+__attribute__((visibility("default"))) void dubsiren_rt_reset() {
+    numViolations.store(0, std::memory_order_relaxed);
+}
+
+__attribute__((visibility("default"))) void dubsiren_rt_report_stacks(int enabled) {
+    reportStacks.store(enabled, std::memory_order_relaxed);
+}
+
+//==============================================================================
+// C allocator and lock replacements
+void* malloc(size_t size) {
+    Report("malloc");
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    Report("calloc");
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+    Report("realloc");
+    return __libc_realloc(pointer, size);
+}
+
+void free(void* pointer) {
+    if (pointer != nullptr) {
+        Report("free");
+    }
+    __libc_free(pointer);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size) {
+    Report("posix_memalign");
+    void* pointer = __libc_memalign(alignment, size);
+    if (pointer == nullptr) {
+        return ENOMEM;
+    }
+    *result = pointer;
+    return 0;
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    Report("aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) {
+    using LockFunction = int (*)(pthread_mutex_t*);
+    static const LockFunction realLock =
+        reinterpret_cast<LockFunction>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+
+    Report("pthread_mutex_lock");
+    return realLock(mutex);
+}
+
+} // extern "C"
+
+//==============================================================================
+// Global operator new/delete replacements
+namespace {
+
+void* CheckedNew(size_t size, const char* what) {
+    Report(what);
+    void* pointer = __libc_malloc(size != 0 ? size : 1);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* CheckedAlignedNew(size_t size, std::align_val_t alignment, const char* what) {
+    Report(what);
+    void* pointer = __libc_memalign(static_cast<size_t>(alignment), size != 0 ? size : 1);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void CheckedDelete(void* pointer, const char* what) {
+    if (pointer != nullptr) {
+        Report(what);
+    }
+    __libc_free(pointer);
+}
+
+} // namespace
+
+void* operator new(size_t size) { return CheckedNew(size, "operator new"); }
+void* operator new[](size_t size) { return CheckedNew(size, "operator new[]"); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    Report("operator new");
+    return __libc_malloc(size != 0 ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    Report("operator new[]");
+    return __libc_malloc(size != 0 ? size : 1);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return CheckedAlignedNew(size, alignment, "operator new");
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return CheckedAlignedNew(size, alignment, "operator new[]");
+}
+
+void operator delete(void* pointer) noexcept { CheckedDelete(pointer, "operator delete"); }
+void operator delete[](void* pointer) noexcept { CheckedDelete(pointer, "operator delete[]"); }
+void operator delete(void* pointer, size_t) noexcept { CheckedDelete(pointer, "operator delete"); }
+void operator delete[](void* pointer, size_t) noexcept { CheckedDelete(pointer, "operator delete[]"); }
+void operator delete(void* pointer, std::align_val_t) noexcept { CheckedDelete(pointer, "operator delete"); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { CheckedDelete(pointer, "operator delete[]"); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { CheckedDelete(pointer, "operator delete"); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { CheckedDelete(pointer, "operator delete[]"); }
+
+#endif // __linux__ && __GLIBC__
@@ -0,0 +1,172 @@
+#include "TraceRecorder.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+
+namespace SimpleSynth {
+namespace Perf {
+
+TraceRecorder& TraceRecorder::GetInstance() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::TraceRecorder()
+    : numClaimed_(0)
+    , dropped_(0)
+    , running_(false)
+    , users_(0)
+    , firstEvent_(true)
+    , originNanoseconds_(0)
+{
+}
+
+TraceRecorder::~TraceRecorder() {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    if (flushThread_.joinable()) {
+        running_.store(false, std::memory_order_release);
+        flushThread_.join();
+    }
+}
+
+uint64_t TraceRecorder::NowNanoseconds() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool TraceRecorder::Start(const std::string& path) {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+
+    if (users_++ > 0) {
+        return true;
+    }
+
+    if (buffers_ == nullptr) {
+        buffers_ = std::make_unique<std::array<ThreadBuffer, kMaxThreads>>();
+        for (size_t t = 0; t < kMaxThreads; ++t) {
+            (*buffers_)[t].threadId = static_cast<uint32_t>(t + 1);
+        }
+    }
+
+    // Discard anything recorded after the previous session's final flush
+    TraceEvent stale;
+    const size_t numClaimed = std::min(numClaimed_.load(std::memory_order_acquire), kMaxThreads);
+    for (size_t t = 0; t < numClaimed; ++t) {
+        while ((*buffers_)[t].ring.Pop(stale)) {}
+    }
+
+    file_.open(path, std::ios::out | std::ios::trunc);
+    if (! file_.is_open()) {
+        users_ = 0;
+        return false;
+    }
+
+    file_ << std::fixed << std::setprecision(3);
+    file_ << "{\"traceEvents\":[\n";
+    firstEvent_ = true;
+    originNanoseconds_ = NowNanoseconds();
+    dropped_.store(0, std::memory_order_relaxed);
+
+    running_.store(true, std::memory_order_release);
+    flushThread_ = std::thread([this] { FlushLoop(); });
+    return true;
+}
+
+void TraceRecorder::Stop() {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+
+    if (users_ == 0 || --users_ > 0) {
+        return;
+    }
+
+    running_.store(false, std::memory_order_release);
+    flushThread_.join();
+    Flush();
+
+    // Name the threads so the viewer shows more than bare ids
+    const size_t numClaimed = std::min(numClaimed_.load(std::memory_order_acquire), kMaxThreads);
+    for (size_t t = 0; t < numClaimed; ++t) {
+        file_ << (firstEvent_ ? "" : ",\n")
+              << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << (*buffers_)[t].threadId
+              << ",\"args\":{\"name\":\"DubSiren thread " << (*buffers_)[t].threadId << "\"}}";
+        firstEvent_ = false;
+    }
+
+    file_ << "\n],\"otherData\":{\"droppedEvents\":" << dropped_.load(std::memory_order_relaxed) << "}}\n";
+    file_.close();
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::GetThreadBuffer() {
+    // Claimed once per thread; later calls are a thread-local load
+    thread_local ThreadBuffer* buffer = nullptr;
+    thread_local bool claimed = false;
+
+    if (! claimed) {
+        claimed = true;
+        const size_t index = numClaimed_.fetch_add(1, std::memory_order_acq_rel);
+        if (index < kMaxThreads) {
+            buffer = &(*buffers_)[index];
+        }
+    }
+
+    return buffer;
+}
+
+void TraceRecorder::Record(const char* name, uint64_t startNanoseconds, uint64_t endNanoseconds) {
+    assert(name != nullptr && "Trace names must be string literals");
+
+    if (! IsRunning()) {
+        return;
+    }
+
+    ThreadBuffer* buffer = GetThreadBuffer();
+    TraceEvent event;
+    event.name = name;
+    event.startNanoseconds = startNanoseconds;
+    event.durationNanoseconds = endNanoseconds - startNanoseconds;
+
+    if (buffer == nullptr || ! buffer->ring.Push(event)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void TraceRecorder::FlushLoop() {
+    while (running_.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kFlushIntervalMs));
+        Flush();
+    }
+}
+
+void TraceRecorder::Flush() {
+    const size_t numClaimed = std::min(numClaimed_.load(std::memory_order_acquire), kMaxThreads);
+    TraceEvent event;
+
+    for (size_t t = 0; t < numClaimed; ++t) {
+        ThreadBuffer& buffer = (*buffers_)[t];
+        while (buffer.ring.Pop(event)) {
+            WriteEvent(event, buffer.threadId);
+        }
+    }
+
+    file_.flush();
+}
+
+void TraceRecorder::WriteEvent(const TraceEvent& event, uint32_t threadId) {
+    // Spans started before Start() would get negative timestamps
+    if (event.startNanoseconds < originNanoseconds_) {
+        return;
+    }
+
+    // Chrome trace timestamps are microseconds
+    const double ts = static_cast<double>(event.startNanoseconds - originNanoseconds_) * 1.0e-3;
+    const double dur = static_cast<double>(event.durationNanoseconds) * 1.0e-3;
+
+    file_ << (firstEvent_ ? "" : ",\n")
+          << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+          << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+    firstEvent_ = false;
+}
+
+} // namespace Perf
+} // namespace SimpleSynth
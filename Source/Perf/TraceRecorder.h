@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Util/SpscRing.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifndef DUBSIREN_TRACE
+ #define DUBSIREN_TRACE 0
+#endif
+
+namespace SimpleSynth {
+namespace Perf {
+
+/**
+ * One completed span. Names must be string literals (they are stored by
+ * pointer and written to JSON unescaped).
+ */
+struct TraceEvent {
+    const char* name = nullptr;
+    uint64_t startNanoseconds = 0;
+    uint64_t durationNanoseconds = 0;
+};
+
+/**
+ * Chrome Trace Recorder
+ *
+ * Collects scoped spans from any thread and writes them as Chrome
+ * trace-event JSON ("ph":"X" complete events), loadable in Perfetto or
+ * chrome://tracing.
+ *
+ * Each recording thread claims one preallocated SPSC ring the first time
+ * it records, so Record() is a timestamp plus a wait-free push - no
+ * locks, no allocation, no I/O. A background thread drains every ring
+ * every kFlushIntervalMs and does the file writes. Rings that fill up
+ * between flushes drop events and count them.
+ *
+ * Process-wide singleton, reference counted across plugin instances:
+ * the first Start() opens the file, the last Stop() closes it.
+ */
+class TraceRecorder {
+public:
+    static constexpr size_t kMaxThreads = 16;
+    static constexpr size_t kEventsPerThread = 8192;
+    static constexpr int kFlushIntervalMs = 20;
+
+    static TraceRecorder& GetInstance();
+
+    /**
+     * Begin recording to path (ignored if already recording).
+     * Returns false if the file could not be opened.
+     */
+    bool Start(const std::string& path);
+
+    /**
+     * Release one Start(). The last one flushes and closes the file.
+     */
+    void Stop();
+
+    bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+
+    /**
+     * Record a finished span on the calling thread. Wait-free.
+     */
+    void Record(const char* name, uint64_t startNanoseconds, uint64_t endNanoseconds);
+
+    static uint64_t NowNanoseconds();
+
+    // Getters for testing
+    uint64_t GetNumDropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct ThreadBuffer {
+        Util::SpscRing<TraceEvent, kEventsPerThread> ring;
+        uint32_t threadId = 0;
+    };
+
+    TraceRecorder();
+    ~TraceRecorder();
+
+    ThreadBuffer* GetThreadBuffer();
+    void FlushLoop();
+    void Flush();
+    void WriteEvent(const TraceEvent& event, uint32_t threadId);
+
+    // Allocated once by the first Start() and kept for the process lifetime,
+    // so thread-local pointers into it never dangle
+    std::unique_ptr<std::array<ThreadBuffer, kMaxThreads>> buffers_;
+    std::atomic<size_t> numClaimed_;
+    std::atomic<uint64_t> dropped_;
+    std::atomic<bool> running_;
+
+    // Control and file state, owned by Start()/Stop() and the flush thread
+    std::mutex controlMutex_;
+    int users_;
+    std::thread flushThread_;
+    std::ofstream file_;
+    bool firstEvent_;
+    uint64_t originNanoseconds_;
+};
+
+/**
+ * Records a span from construction to destruction if the recorder is running.
+ */
+class ScopedTrace {
+public:
+    explicit ScopedTrace(const char* name)
+        : name_(name)
+        , start_(TraceRecorder::GetInstance().IsRunning() ? TraceRecorder::NowNanoseconds() : 0)
+    {
+    }
+
+    ~ScopedTrace() {
+        if (start_ != 0) {
+            TraceRecorder::GetInstance().Record(name_, start_, TraceRecorder::NowNanoseconds());
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* name_;
+    uint64_t start_;
+};
+
+} // namespace Perf
+} // namespace SimpleSynth
+
+// Scoped span marker; compiles to nothing unless built with DUBSIREN_TRACE=1
+#if DUBSIREN_TRACE
+ #define DUBSIREN_TRACE_CONCAT_INNER(a, b) a##b
+ #define DUBSIREN_TRACE_CONCAT(a, b) DUBSIREN_TRACE_CONCAT_INNER(a, b)
+ #define DUBSIREN_TRACE_SCOPE(name) \
+     ::SimpleSynth::Perf::ScopedTrace DUBSIREN_TRACE_CONCAT(traceScope_, __LINE__)(name)
+#else
+ #define DUBSIREN_TRACE_SCOPE(name) ((void) 0)
+#endif
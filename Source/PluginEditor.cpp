@@ -1,14 +1,13 @@
 #include "PluginEditor.h"
 #include "PluginProcessor.h"
-#include <BinaryData.h>
 
 //==============================================================================
-RastaKnobLookAndFeel::RastaKnobLookAndFeel()
-    : currentKnobColour(juce::Colours::red)
+namespace
 {
+    const juce::Identifier knobColourProperty { "knobColour" };
 }
 
-void RastaKnobLookAndFeel::setKnobColour(int index)
+void RastaKnobLookAndFeel::setKnobColour(juce::Slider& slider, int index)
 {
     // Cycle through rasta colors: red, yellow, green
     const juce::Colour rastaColors[] = {
@@ -16,7 +15,7 @@ void RastaKnobLookAndFeel::setKnobColour(int index)
         juce::Colour(0xffFFD700),  // Gold/Yellow
         juce::Colour(0xff009900)   // Green
     };
-    currentKnobColour = rastaColors[index % 3];
+    slider.getProperties().set(knobColourProperty, static_cast<juce::int64>(rastaColors[index % 3].getARGB()));
 }
 
 void RastaKnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height,
@@ -27,9 +26,13 @@ void RastaKnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int
     auto centreX = x + width * 0.5f;
     auto centreY = y + height * 0.5f;
     auto angle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
+
+    const auto* colour = slider.getProperties().getVarPointer(knobColourProperty);
+    const auto knobColour = colour != nullptr ? juce::Colour(static_cast<juce::uint32>(static_cast<juce::int64>(*colour)))
+                                              : juce::Colour(0xffCC0000);
     
     // Draw solid filled circle for knob body
-    g.setColour(currentKnobColour);
+    g.setColour(knobColour);
     g.fillEllipse(centreX - radius, centreY - radius, radius * 2.0f, radius * 2.0f);
     
     // Draw black outline
@@ -37,14 +40,364 @@ void RastaKnobLookAndFeel::drawRotarySlider(juce::Graphics& g, int x, int y, int
     g.drawEllipse(centreX - radius, centreY - radius, radius * 2.0f, radius * 2.0f, 3.0f);
     
     // Draw position indicator (white line from center)
-    juce::Path p;
-    auto pointerLength = radius * 0.7f;
-    auto pointerThickness = 4.0f;
-    p.addRectangle(-pointerThickness * 0.5f, -radius, pointerThickness, pointerLength);
-    p.applyTransform(juce::AffineTransform::rotation(angle).translated(centreX, centreY));
-    
+    if (radius != pointerRadius)
+    {
+        auto pointerLength = radius * 0.7f;
+        auto pointerThickness = 4.0f;
+        pointerPath.clear();
+        pointerPath.addRectangle(-pointerThickness * 0.5f, -radius, pointerThickness, pointerLength);
+        pointerRadius = radius;
+    }
+
     g.setColour(juce::Colours::white);
-    g.fillPath(p);
+    g.fillPath(pointerPath, juce::AffineTransform::rotation(angle).translated(centreX, centreY));
+}
+
+//==============================================================================
+void LoadMeter::update(float averageLoad, float worstBlockLoad)
+{
+    // Fast attack, slow release so short spikes stay readable
+    load = averageLoad > load ? averageLoad : load + 0.2f * (averageLoad - load);
+    worstLoad = juce::jmax(worstLoad, worstBlockLoad);
+    repaint();
+}
+
+void LoadMeter::mouseDown(const juce::MouseEvent&)
+{
+    worstLoad = 0.0f;
+    repaint();
+}
+
+void LoadMeter::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+    auto bar = bounds.removeFromTop(6.0f);
+
+    g.setColour(juce::Colours::black.withAlpha(0.6f));
+    g.fillRect(bar);
+
+    const auto barColour = load < 0.5f ? juce::Colour(0xff009900)
+                         : load < 0.8f ? juce::Colour(0xffFFD700)
+                                       : juce::Colour(0xffCC0000);
+    g.setColour(barColour);
+    g.fillRect(bar.withWidth(bar.getWidth() * juce::jlimit(0.0f, 1.0f, load)));
+
+    // Worst block since the last reset; past the deadline means a dropout
+    const float worstX = bar.getX() + bar.getWidth() * juce::jlimit(0.0f, 1.0f, worstLoad);
+    g.setColour(worstLoad >= 1.0f ? juce::Colour(0xffCC0000) : juce::Colours::white);
+    g.fillRect(worstX - 1.0f, bar.getY(), 2.0f, bar.getHeight());
+
+    g.setColour(juce::Colours::black.withAlpha(0.8f));
+    g.setFont(juce::Font(11.0f, juce::Font::bold));
+    g.drawText("CPU " + juce::String(juce::roundToInt(load * 100.0f)) + "%  PEAK "
+                   + juce::String(juce::roundToInt(worstLoad * 100.0f)) + "%",
+               bounds, juce::Justification::centred);
+}
+
+//==============================================================================
+AnalyzerView::AnalyzerView()
+{
+    bandLevels.fill(minDecibels);
+    setInterceptsMouseClicks(false, false);
+}
+
+void AnalyzerView::update(SimpleSynth::DSP::AnalysisTap& tap)
+{
+    SimpleSynth::DSP::AnalysisTap::Chunk chunk;
+    bool received = false;
+    while (tap.Pop(chunk))
+    {
+        for (const float sample : chunk.samples)
+        {
+            history[static_cast<size_t>(historyPosition)] = sample;
+            historyPosition = (historyPosition + 1) % fftSize;
+        }
+        received = true;
+    }
+
+    // Nothing played since the last tick: leave the display as it is
+    if (! received)
+        return;
+
+    // Oldest first
+    const auto split = history.begin() + historyPosition;
+    std::copy(split, history.end(), fftData.begin());
+    std::copy(history.begin(), split, fftData.begin() + (fftSize - historyPosition));
+
+    // Scope: trigger on the latest rising zero crossing that still leaves
+    // a full trace, so a steady tone stands still
+    int start = fftSize - scopeSize;
+    for (int i = start; i > 0; --i)
+    {
+        if (fftData[static_cast<size_t>(i - 1)] < 0.0f && fftData[static_cast<size_t>(i)] >= 0.0f)
+        {
+            start = i;
+            break;
+        }
+    }
+    std::copy_n(fftData.begin() + start, scopeSize, scope.begin());
+
+    // Spectrum: a full-scale sine reads 0 dB (2/N one-sided, 1/2 for Hann's gain)
+    std::fill(fftData.begin() + fftSize, fftData.end(), 0.0f);
+    window.multiplyWithWindowingTable(fftData.data(), static_cast<size_t>(fftSize));
+    fft.performFrequencyOnlyForwardTransform(fftData.data(), true);
+
+    const float sampleRate = tap.GetOutputRate();
+    const float binsPerHz = static_cast<float>(fftSize) / sampleRate;
+    const float frequencyRatio = 0.5f * sampleRate / minFrequency;
+    const float gain = 4.0f / static_cast<float>(fftSize);
+
+    // Log-spaced bands from minFrequency to Nyquist; peak bin per band
+    for (int band = 0; band < numBands; ++band)
+    {
+        const float low = minFrequency * std::pow(frequencyRatio, static_cast<float>(band) / numBands);
+        const float high = minFrequency * std::pow(frequencyRatio, static_cast<float>(band + 1) / numBands);
+        const int firstBin = juce::jlimit(1, fftSize / 2 - 1, static_cast<int>(low * binsPerHz));
+        const int lastBin = juce::jlimit(firstBin, fftSize / 2 - 1, static_cast<int>(high * binsPerHz));
+
+        float magnitude = 0.0f;
+        for (int bin = firstBin; bin <= lastBin; ++bin)
+            magnitude = juce::jmax(magnitude, fftData[static_cast<size_t>(bin)]);
+
+        // Instant rise, 3 dB per tick fall
+        auto& level = bandLevels[static_cast<size_t>(band)];
+        level = juce::jmax(juce::Decibels::gainToDecibels(magnitude * gain, minDecibels), level - 3.0f);
+    }
+
+    repaint();
+}
+
+void AnalyzerView::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+    g.setColour(juce::Colours::black.withAlpha(0.6f));
+    g.fillRoundedRectangle(bounds, 6.0f);
+
+    bounds = bounds.reduced(6.0f);
+    auto scopeArea = bounds.removeFromTop(bounds.getHeight() * 0.5f);
+    bounds.removeFromTop(4.0f);
+    const auto spectrumArea = bounds;
+
+    // Scope, full scale to the edges
+    juce::Path trace;
+    trace.preallocateSpace(3 * scopeSize);
+    for (int i = 0; i < scopeSize; ++i)
+    {
+        const float x = scopeArea.getX() + scopeArea.getWidth() * static_cast<float>(i) / (scopeSize - 1);
+        const float y = scopeArea.getCentreY()
+                      - 0.5f * scopeArea.getHeight() * juce::jlimit(-1.0f, 1.0f, scope[static_cast<size_t>(i)]);
+        if (i == 0)
+            trace.startNewSubPath(x, y);
+        else
+            trace.lineTo(x, y);
+    }
+    g.setColour(juce::Colour(0xff009900));
+    g.strokePath(trace, juce::PathStrokeType(1.5f));
+
+    // Spectrum, minDecibels to 0 dB
+    const float barWidth = spectrumArea.getWidth() / numBands;
+    g.setColour(juce::Colour(0xffFFD700));
+    for (int band = 0; band < numBands; ++band)
+    {
+        const float level = juce::jmap(bandLevels[static_cast<size_t>(band)], minDecibels, 0.0f, 0.0f, 1.0f);
+        const float height = spectrumArea.getHeight() * juce::jlimit(0.0f, 1.0f, level);
+        g.fillRect(spectrumArea.getX() + static_cast<float>(band) * barWidth, spectrumArea.getBottom() - height,
+                   barWidth - 1.0f, height);
+    }
+}
+
+//==============================================================================
+PerformancePad::PerformancePad(const juce::String& padText)
+    : text(padText)
+{
+}
+
+void PerformancePad::mouseDown(const juce::MouseEvent&)
+{
+    pressed = true;
+    repaint();
+    if (onPress != nullptr)
+        onPress();
+}
+
+void PerformancePad::mouseUp(const juce::MouseEvent&)
+{
+    pressed = false;
+    repaint();
+    if (onRelease != nullptr)
+        onRelease();
+}
+
+void PerformancePad::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat().reduced(2.0f);
+
+    g.setColour(pressed ? juce::Colour(0xffCC0000) : juce::Colours::black.withAlpha(0.7f));
+    g.fillRoundedRectangle(bounds, 6.0f);
+
+    g.setColour(juce::Colour(0xffFFD700));
+    g.drawRoundedRectangle(bounds, 6.0f, 2.0f);
+
+    g.setFont(juce::Font(14.0f, juce::Font::bold));
+    g.drawText(text, bounds, juce::Justification::centred);
+}
+
+//==============================================================================
+ModMatrixPanel::ModMatrixPanel(SimpleSynthProcessor& processor)
+    : processorRef(processor)
+{
+    using ModMatrix = SimpleSynth::DSP::ModMatrix;
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        auto& row = rows[i];
+        const auto slot = processorRef.getModulationSlot(i);
+
+        // Item ids are enum values + 1, so "None" is id 1
+        row.source.addItem("None", 1);
+        for (int s = 1; s < static_cast<int>(ModMatrix::Source::Count); ++s)
+            row.source.addItem(ModMatrix::GetSourceInfo(static_cast<ModMatrix::Source>(s)).name, s + 1);
+
+        row.destination.addItem("None", 1);
+        for (int d = 1; d < static_cast<int>(ModMatrix::Destination::Count); ++d)
+            row.destination.addItem(ModMatrix::GetDestinationInfo(static_cast<ModMatrix::Destination>(d)).name, d + 1);
+
+        row.source.setSelectedId(static_cast<int>(slot.source) + 1, juce::dontSendNotification);
+        row.destination.setSelectedId(static_cast<int>(slot.destination) + 1, juce::dontSendNotification);
+
+        row.depth.setRange(-1.0, 1.0, 0.01);
+        row.depth.setValue(slot.depth, juce::dontSendNotification);
+        row.depth.setDoubleClickReturnValue(true, 0.0);
+        row.depth.setTextBoxStyle(juce::Slider::TextBoxRight, false, 48, 20);
+
+        row.source.onChange = [this, i] { sendSlot(i); };
+        row.destination.onChange = [this, i] { sendSlot(i); };
+        row.depth.onValueChange = [this, i] { sendSlot(i); };
+
+        addAndMakeVisible(row.source);
+        addAndMakeVisible(row.destination);
+        addAndMakeVisible(row.depth);
+    }
+
+    setSize(470, 40 + 30 * static_cast<int>(rows.size()));
+}
+
+void ModMatrixPanel::sendSlot(size_t index)
+{
+    using ModMatrix = SimpleSynth::DSP::ModMatrix;
+
+    const auto& row = rows[index];
+    ModMatrix::Slot slot;
+    slot.source = static_cast<ModMatrix::Source>(juce::jmax(0, row.source.getSelectedId() - 1));
+    slot.destination = static_cast<ModMatrix::Destination>(juce::jmax(0, row.destination.getSelectedId() - 1));
+    slot.depth = static_cast<float>(row.depth.getValue());
+    processorRef.setModulationSlot(index, slot);
+}
+
+void ModMatrixPanel::paint(juce::Graphics& g)
+{
+    g.setColour(juce::Colour(0xffFFD700));
+    g.setFont(juce::Font(12.0f, juce::Font::bold));
+
+    auto header = getLocalBounds().reduced(8, 0).removeFromTop(24);
+    g.drawText("SOURCE", header.removeFromLeft(140), juce::Justification::centredLeft);
+    g.drawText("DESTINATION", header.removeFromLeft(150), juce::Justification::centredLeft);
+    g.drawText("DEPTH", header, juce::Justification::centredLeft);
+}
+
+void ModMatrixPanel::resized()
+{
+    auto bounds = getLocalBounds().reduced(8, 0).withTrimmedTop(28);
+
+    for (auto& row : rows)
+    {
+        auto line = bounds.removeFromTop(30).reduced(0, 3);
+        row.source.setBounds(line.removeFromLeft(134));
+        line.removeFromLeft(6);
+        row.destination.setBounds(line.removeFromLeft(144));
+        line.removeFromLeft(6);
+        row.depth.setBounds(line);
+    }
+}
+
+//==============================================================================
+ScenePanel::ScenePanel(SimpleSynthProcessor& processor)
+    : processorRef(processor)
+{
+    for (size_t slot = 0; slot < slotButtons.size(); ++slot)
+    {
+        auto& button = slotButtons[slot];
+        button.setButtonText(juce::String(static_cast<int>(slot) + 1));
+        button.setColour(juce::TextButton::buttonOnColourId, juce::Colour(0xff009900));
+        button.onClick = [this, slot] {
+            processorRef.captureSnapshot(slot);
+            refreshSlots();
+        };
+        button.addMouseListener(this, false);
+        addAndMakeVisible(button);
+    }
+
+    // Item ids are slot + 1, so id 1 is "None" (slot 0)
+    for (auto* box : { &morphABox, &morphBBox })
+    {
+        box->addItem("None", 1);
+        for (int slot = 1; slot <= static_cast<int>(SimpleSynthProcessor::kNumSnapshots); ++slot)
+            box->addItem("Scene " + juce::String(slot), slot + 1);
+        addAndMakeVisible(*box);
+    }
+
+    morphAAttach = std::make_unique<ChoiceAttachment>(processorRef.getParameters(), "morphA", morphABox);
+    morphBAttach = std::make_unique<ChoiceAttachment>(processorRef.getParameters(), "morphB", morphBBox);
+
+    refreshSlots();
+    setSize(300, 110);
+}
+
+void ScenePanel::refreshSlots()
+{
+    for (size_t slot = 0; slot < slotButtons.size(); ++slot)
+        slotButtons[slot].setToggleState(processorRef.hasSnapshot(slot), juce::dontSendNotification);
+}
+
+void ScenePanel::mouseDown(const juce::MouseEvent& e)
+{
+    if (! e.mods.isPopupMenu())
+        return;
+
+    for (size_t slot = 0; slot < slotButtons.size(); ++slot)
+        if (e.eventComponent == &slotButtons[slot])
+            processorRef.clearSnapshot(slot);
+
+    refreshSlots();
+}
+
+void ScenePanel::paint(juce::Graphics& g)
+{
+    g.setColour(juce::Colour(0xffFFD700));
+    g.setFont(juce::Font(12.0f, juce::Font::bold));
+
+    auto bounds = getLocalBounds().reduced(8, 0);
+    g.drawText("CAPTURE (RIGHT-CLICK CLEARS)", bounds.removeFromTop(22), juce::Justification::centredLeft);
+    bounds.removeFromTop(34);
+    auto labels = bounds.removeFromTop(20);
+    g.drawText("MORPH A", labels.removeFromLeft(146), juce::Justification::centredLeft);
+    g.drawText("MORPH B", labels, juce::Justification::centredLeft);
+}
+
+void ScenePanel::resized()
+{
+    auto bounds = getLocalBounds().reduced(8, 0).withTrimmedTop(22);
+
+    auto slots = bounds.removeFromTop(30);
+    const int slotWidth = slots.getWidth() / static_cast<int>(slotButtons.size());
+    for (auto& button : slotButtons)
+        button.setBounds(slots.removeFromLeft(slotWidth).reduced(2, 2));
+
+    bounds.removeFromTop(24);
+    auto boxes = bounds.removeFromTop(28);
+    morphABox.setBounds(boxes.removeFromLeft(138));
+    boxes.removeFromLeft(8);
+    morphBBox.setBounds(boxes);
 }
 
 //==============================================================================
@@ -53,13 +406,6 @@ SimpleSynthEditor::SimpleSynthEditor(SimpleSynthProcessor& p)
 {
     auto& params = processorRef.getParameters();
     
-    // Create LookAndFeel instances with different rasta colors for each knob
-    for (int i = 0; i < 9; ++i)
-    {
-        knobLookAndFeels[i] = std::make_unique<RastaKnobLookAndFeel>();
-        knobLookAndFeels[i]->setKnobColour(i);
-    }
-
     auto makeKnob = [](juce::Slider& s){
         s.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
         s.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
@@ -75,16 +421,15 @@ SimpleSynthEditor::SimpleSynthEditor(SimpleSynthProcessor& p)
     makeKnob(lfo2RateSlider);
     makeKnob(lfo2AmountSlider);
     
-    // Apply custom LookAndFeel to each knob with alternating rasta colors
-    vcoRateSlider.setLookAndFeel(knobLookAndFeels[0].get());
-    vcoLevelSlider.setLookAndFeel(knobLookAndFeels[1].get());
-    delayTimeSlider.setLookAndFeel(knobLookAndFeels[2].get());
-    delayFeedbackSlider.setLookAndFeel(knobLookAndFeels[3].get());
-    delayWetDrySlider.setLookAndFeel(knobLookAndFeels[4].get());
-    lfo1RateSlider.setLookAndFeel(knobLookAndFeels[5].get());
-    lfo1AmountSlider.setLookAndFeel(knobLookAndFeels[6].get());
-    lfo2RateSlider.setLookAndFeel(knobLookAndFeels[7].get());
-    lfo2AmountSlider.setLookAndFeel(knobLookAndFeels[8].get());
+    // One shared LookAndFeel; each knob carries its alternating rasta colour
+    int knobIndex = 0;
+    for (auto* slider : { &vcoRateSlider, &vcoLevelSlider, &delayTimeSlider, &delayFeedbackSlider,
+                          &delayWetDrySlider, &lfo1RateSlider, &lfo1AmountSlider,
+                          &lfo2RateSlider, &lfo2AmountSlider })
+    {
+        RastaKnobLookAndFeel::setKnobColour(*slider, knobIndex++);
+        slider->setLookAndFeel(&knobLookAndFeel.get());
+    }
 
     addAndMakeVisible(vcoRateSlider);
     addAndMakeVisible(vcoLevelSlider);
@@ -114,6 +459,13 @@ SimpleSynthEditor::SimpleSynthEditor(SimpleSynthProcessor& p)
     setupLabel(lfo2RateLabel, "SHAKE");
     setupLabel(lfo2AmountLabel, "POWER");
     
+    // The knob captions never change: cache them rather than re-rendering
+    // their text whenever the knob beneath repaints
+    for (auto* label : { &vcoRateLabel, &vcoLevelLabel, &delayTimeLabel, &delayFeedbackLabel,
+                         &delayWetDryLabel, &lfo1RateLabel, &lfo1AmountLabel,
+                         &lfo2RateLabel, &lfo2AmountLabel })
+        label->setBufferedToImage(true);
+
     addAndMakeVisible(vcoRateLabel);
     addAndMakeVisible(vcoLevelLabel);
     addAndMakeVisible(delayTimeLabel);
@@ -124,6 +476,94 @@ SimpleSynthEditor::SimpleSynthEditor(SimpleSynthProcessor& p)
     addAndMakeVisible(lfo2RateLabel);
     addAndMakeVisible(lfo2AmountLabel);
 
+    qualityTierLabel.setJustificationType(juce::Justification::centred);
+    qualityTierLabel.setFont(juce::Font(12.0f, juce::Font::bold));
+    qualityTierLabel.setColour(juce::Label::textColourId, juce::Colours::black.withAlpha(0.8f));
+    addAndMakeVisible(qualityTierLabel);
+
+    loadMeter.setVisible(SimpleSynth::Perf::BlockTelemetry::kEnabled);
+    addChildComponent(loadMeter);
+
+    // The processor feeds the analyzer only while an editor is open;
+    // anything a previous editor left queued is stale
+    auto& analysisTap = processorRef.getAnalysisTap();
+    SimpleSynth::DSP::AnalysisTap::Chunk staleChunk;
+    while (analysisTap.Pop(staleChunk)) {}
+    analysisTap.SetEnabled(true);
+    addAndMakeVisible(analyzerView);
+
+    // Performance pads: the siren is played from the panel as well as MIDI
+    using EventType = SimpleSynth::Control::ControlEvent::Type;
+    using SimpleSynth::Control::ParamIndex;
+
+    triggerPad.onPress = [this] { sendControlEvent(EventType::TriggerOn, 1.0f); };
+    triggerPad.onRelease = [this] { sendControlEvent(EventType::TriggerOff); };
+
+    // Dive two octaves while held, spring back on release
+    divePad.onPress = [this] { sendControlEvent(EventType::PitchDive, -2.0f, 1.5f); };
+    divePad.onRelease = [this] { sendControlEvent(EventType::PitchDive, 0.0f, 0.25f); };
+
+    // Dub throw: slam the echo in while held
+    throwPad.onPress = [this] {
+        sendControlEvent(EventType::SetParameter, 1.0f, 0.0f, ParamIndex::DelayWetDry);
+        sendControlEvent(EventType::SetParameter, 0.9f, 0.0f, ParamIndex::DelayFeedback);
+    };
+    throwPad.onRelease = [this] {
+        sendControlEvent(EventType::ReleaseParameter, 0.0f, 0.0f, ParamIndex::DelayWetDry);
+        sendControlEvent(EventType::ReleaseParameter, 0.0f, 0.0f, ParamIndex::DelayFeedback);
+    };
+
+    holdButton.setClickingTogglesState(true);
+    holdButton.onClick = [this] {
+        sendControlEvent(holdButton.getToggleState() ? EventType::HoldOn : EventType::HoldOff);
+    };
+
+    // Right-click any knob for MIDI learn
+    for (auto* slider : { &vcoRateSlider, &vcoLevelSlider, &delayTimeSlider, &delayFeedbackSlider,
+                          &delayWetDrySlider, &lfo1RateSlider, &lfo1AmountSlider,
+                          &lfo2RateSlider, &lfo2AmountSlider })
+        slider->addMouseListener(this, false);
+
+    midiLearnLabel.setText("MIDI LEARN: move a controller", juce::dontSendNotification);
+    midiLearnLabel.setJustificationType(juce::Justification::centred);
+    midiLearnLabel.setFont(juce::Font(12.0f, juce::Font::bold));
+    midiLearnLabel.setColour(juce::Label::textColourId, juce::Colour(0xffCC0000));
+    addChildComponent(midiLearnLabel);
+
+    addAndMakeVisible(triggerPad);
+    addAndMakeVisible(divePad);
+    addAndMakeVisible(throwPad);
+    addAndMakeVisible(holdButton);
+
+    tuningButton.onClick = [this] { showTuningMenu(); };
+    addAndMakeVisible(tuningButton);
+
+    recordButton.setColour(juce::TextButton::buttonOnColourId, juce::Colour(0xffCC0000));
+    recordButton.onClick = [this] {
+        if (processorRef.getRecorder().isRecording())
+            stopRecording();
+        else
+            showRecordMenu();
+    };
+    addAndMakeVisible(recordButton);
+
+    // The callout owns the panel and closes it when focus moves away
+    modMatrixButton.onClick = [this] {
+        juce::CallOutBox::launchAsynchronously(std::make_unique<ModMatrixPanel>(processorRef),
+                                               modMatrixButton.getScreenBounds(), nullptr);
+    };
+    addAndMakeVisible(modMatrixButton);
+
+    scenesButton.onClick = [this] {
+        juce::CallOutBox::launchAsynchronously(std::make_unique<ScenePanel>(processorRef),
+                                               scenesButton.getScreenBounds(), nullptr);
+    };
+    addAndMakeVisible(scenesButton);
+
+    morphSlider.setColour(juce::Slider::thumbColourId, juce::Colour(0xffFFD700));
+    morphSlider.addMouseListener(this, false);
+    addAndMakeVisible(morphSlider);
+
     lfo1TargetBox.addItem("None", 1);
     lfo1TargetBox.addItem("VCO Rate", 2);
     lfo1TargetBox.addItem("Delay Time", 3);
@@ -147,25 +587,284 @@ SimpleSynthEditor::SimpleSynthEditor(SimpleSynthProcessor& p)
     lfo1AmountAttach = std::make_unique<Attachment>(processorRef.getParameters(), "lfo1Amount", lfo1AmountSlider);
     lfo2RateAttach = std::make_unique<Attachment>(processorRef.getParameters(), "lfo2Rate", lfo2RateSlider);
     lfo2AmountAttach = std::make_unique<Attachment>(processorRef.getParameters(), "lfo2Amount", lfo2AmountSlider);
+    morphAttach = std::make_unique<Attachment>(processorRef.getParameters(), "morph", morphSlider);
 
     lfo1TargetAttach = std::make_unique<ChoiceAttachment>(processorRef.getParameters(), "lfo1Target", lfo1TargetBox);
     lfo2TargetAttach = std::make_unique<ChoiceAttachment>(processorRef.getParameters(), "lfo2Target", lfo2TargetBox);
 
-    // Load the panel background image
-    panelImage = juce::ImageCache::getFromMemory(BinaryData::panel_jpg, BinaryData::panel_jpgSize);
+    // Panel background, decoded in the background when the plugin loaded;
+    // until it's ready the timer keeps checking. It covers the whole
+    // editor, so nothing behind the editor needs painting.
+    panelImage = resources->getPanelImage();
+    waitingForPanel = ! resources->isPanelDecoded();
+    setOpaque(true);
 
     setSize(800, 600);
+
+    timerCallback();
+    startTimerHz(30);
 }
 
-SimpleSynthEditor::~SimpleSynthEditor() = default;
+SimpleSynthEditor::~SimpleSynthEditor()
+{
+    // Back to a single flag check per block on the audio thread
+    processorRef.getAnalysisTap().SetEnabled(false);
+
+    // Don't leave the siren held after the panel closes
+    if (holdButton.getToggleState())
+        sendControlEvent(SimpleSynth::Control::ControlEvent::Type::HoldOff);
+}
+
+void SimpleSynthEditor::sendControlEvent(SimpleSynth::Control::ControlEvent::Type type, float value,
+                                         float duration, SimpleSynth::Control::ParamIndex parameter)
+{
+    SimpleSynth::Control::ControlEvent event;
+    event.type = type;
+    event.value = value;
+    event.duration = duration;
+    event.parameter = parameter;
+
+    // A full queue drops the gesture; the queue counts it
+    processorRef.pushControlEvent(event);
+}
+
+void SimpleSynthEditor::timerCallback()
+{
+    // The panel finished decoding after the editor opened
+    if (waitingForPanel && resources->isPanelDecoded())
+    {
+        waitingForPanel = false;
+        panelImage = resources->getPanelImage();
+        scaledPanel = {};
+        repaint();
+    }
+
+    if constexpr (SimpleSynth::Perf::BlockTelemetry::kEnabled)
+    {
+        float loadSum = 0.0f;
+        float worstLoad = 0.0f;
+        const auto numBlocks = processorRef.getTelemetry().Drain([&](const SimpleSynth::Perf::BlockStats& stats) {
+            loadSum += stats.loadFraction;
+            worstLoad = juce::jmax(worstLoad, stats.loadFraction);
+        });
+
+        if (numBlocks > 0)
+            loadMeter.update(loadSum / static_cast<float>(numBlocks), worstLoad);
+    }
+
+    analyzerView.update(processorRef.getAnalysisTap());
+
+    const int learnTarget = processorRef.getMidiMapping().GetLearnTarget();
+    if (learnTarget != displayedLearnTarget)
+    {
+        displayedLearnTarget = learnTarget;
+        midiLearnLabel.setVisible(learnTarget != SimpleSynth::Control::MidiMapping::kNotLearning);
+    }
+
+    const auto tuningName = processorRef.getTuningName();
+    if (tuningName != displayedTuningName)
+    {
+        displayedTuningName = tuningName;
+        tuningButton.setButtonText("TUNING: " + tuningName);
+    }
+
+    // Elapsed time while recording, and whether the writer has fallen behind
+    const auto& recorder = processorRef.getRecorder();
+    juce::String recordText = "REC";
+    if (recorder.isRecording())
+    {
+        const auto seconds = static_cast<int>(static_cast<double>(recorder.getNumSamplesWritten())
+                                              / juce::jmax(1.0, processorRef.getSampleRate()));
+        recordText = juce::String::formatted("STOP  %d:%02d", seconds / 60, seconds % 60);
+        if (recorder.getNumDroppedSamples() > 0)
+            recordText << "  DROPOUTS";
+    }
+    if (recordText != displayedRecordText)
+    {
+        displayedRecordText = recordText;
+        recordButton.setButtonText(recordText);
+        recordButton.setToggleState(recorder.isRecording(), juce::dontSendNotification);
+    }
+
+    const int tier = processorRef.getActiveQualityTier();
+    if (tier == displayedQualityTier)
+        return;
+
+    displayedQualityTier = tier;
+
+    static const char* const tierNames[] = { "ECO", "LIVE", "STUDIO" };
+    qualityTierLabel.setText(tier >= 0 && tier < static_cast<int>(SimpleSynth::DSP::kNumQualityTiers) ? tierNames[tier] : "CUSTOM",
+                             juce::dontSendNotification);
+}
+
+void SimpleSynthEditor::mouseDown(const juce::MouseEvent& e)
+{
+    if (! e.mods.isPopupMenu())
+        return;
+
+    using SimpleSynth::Control::ParamIndex;
+    const std::pair<juce::Slider*, ParamIndex> knobs[] = {
+        { &vcoRateSlider, ParamIndex::VcoRate },
+        { &vcoLevelSlider, ParamIndex::VcoLevel },
+        { &delayTimeSlider, ParamIndex::DelayTime },
+        { &delayFeedbackSlider, ParamIndex::DelayFeedback },
+        { &delayWetDrySlider, ParamIndex::DelayWetDry },
+        { &lfo1RateSlider, ParamIndex::Lfo1Rate },
+        { &lfo1AmountSlider, ParamIndex::Lfo1Amount },
+        { &lfo2RateSlider, ParamIndex::Lfo2Rate },
+        { &lfo2AmountSlider, ParamIndex::Lfo2Amount },
+        { &morphSlider, ParamIndex::Morph }
+    };
+
+    for (const auto& [slider, parameter] : knobs)
+        if (e.eventComponent == slider)
+            showMidiLearnMenu(*slider, parameter);
+}
+
+void SimpleSynthEditor::showMidiLearnMenu(juce::Slider& slider, SimpleSynth::Control::ParamIndex parameter)
+{
+    auto& mapping = processorRef.getMidiMapping();
+    const bool learningThis = mapping.GetLearnTarget() == static_cast<int>(parameter);
+
+    juce::PopupMenu menu;
+    menu.addItem(1, learningThis ? "Cancel MIDI Learn" : "MIDI Learn");
+    menu.addItem(2, "Clear MIDI Mapping", mapping.HasMapping(parameter));
+
+    juce::Component::SafePointer<SimpleSynthEditor> safeThis(this);
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&slider),
+                       [safeThis, parameter, learningThis](int result) {
+        if (safeThis == nullptr)
+            return;
+
+        auto& menuMapping = safeThis->processorRef.getMidiMapping();
+        if (result == 1)
+        {
+            if (learningThis)
+                menuMapping.CancelLearn();
+            else
+                menuMapping.StartLearn(parameter);
+        }
+        else if (result == 2)
+        {
+            menuMapping.ClearDestination(parameter);
+        }
+    });
+}
+
+void SimpleSynthEditor::showTuningMenu()
+{
+    auto* keyTrack = processorRef.getParameters().getParameter("keyTrack");
+    const bool keyTrackOn = keyTrack != nullptr && keyTrack->getValue() > 0.5f;
+
+    juce::PopupMenu menu;
+    menu.addItem(1, "Key Track", keyTrack != nullptr, keyTrackOn);
+    menu.addSeparator();
+    menu.addItem(2, "Load Scale (.scl)...");
+    menu.addItem(3, "Load Keyboard Mapping (.kbm)...");
+    menu.addItem(4, "Reset to 12-TET");
+
+    juce::Component::SafePointer<SimpleSynthEditor> safeThis(this);
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&tuningButton),
+                       [safeThis, keyTrackOn](int result) {
+        if (safeThis == nullptr)
+            return;
+
+        auto& processor = safeThis->processorRef;
+        if (result == 1)
+        {
+            if (auto* parameter = processor.getParameters().getParameter("keyTrack"))
+            {
+                parameter->beginChangeGesture();
+                parameter->setValueNotifyingHost(keyTrackOn ? 0.0f : 1.0f);
+                parameter->endChangeGesture();
+            }
+        }
+        else if (result == 2 || result == 3)
+        {
+            safeThis->chooseTuningFile(result == 2);
+        }
+        else if (result == 4)
+        {
+            processor.loadTuningScale({}, {});
+            processor.loadTuningMapping({}, {});
+        }
+    });
+}
+
+void SimpleSynthEditor::chooseTuningFile(bool scale)
+{
+    tuningChooser = std::make_unique<juce::FileChooser>(scale ? "Load Scala Scale" : "Load Scala Keyboard Mapping",
+                                                        juce::File(), scale ? "*.scl" : "*.kbm");
+
+    // The chooser belongs to the editor, so the callback can't outlive it
+    const auto flags = juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles;
+    tuningChooser->launchAsync(flags, [this, scale](const juce::FileChooser& chooser) {
+        const auto file = chooser.getResult();
+        if (! file.existsAsFile())
+            return;
+
+        const auto text = file.loadFileAsString();
+        const auto name = file.getFileNameWithoutExtension();
+        const bool loaded = scale ? processorRef.loadTuningScale(text, name)
+                                  : processorRef.loadTuningMapping(text, name);
+
+        if (! loaded)
+            juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Tuning",
+                                                   file.getFileName() + " is not a valid Scala file.");
+    });
+}
+
+void SimpleSynthEditor::showRecordMenu()
+{
+    juce::PopupMenu menu;
+    menu.addItem(1, "Record WAV");
+    menu.addItem(2, "Record FLAC");
+
+    juce::Component::SafePointer<SimpleSynthEditor> safeThis(this);
+    menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&recordButton),
+                       [safeThis](int result) {
+        if (safeThis == nullptr || result == 0)
+            return;
+
+        const auto file = SimpleSynthProcessor::getNewRecordingFile(result == 1 ? ".wav" : ".flac");
+        if (! safeThis->processorRef.startRecording(file))
+            juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Record",
+                                                   "Can't write " + file.getFullPathName() + ".");
+        safeThis->timerCallback();
+    });
+}
+
+void SimpleSynthEditor::stopRecording()
+{
+    processorRef.stopRecording();
+    timerCallback();
+
+    // Blocks the writer had no room for are missing from the file
+    const auto& recorder = processorRef.getRecorder();
+    if (recorder.getNumDroppedSamples() > 0)
+    {
+        const auto droppedSeconds = static_cast<double>(recorder.getNumDroppedSamples())
+                                  / juce::jmax(1.0, processorRef.getSampleRate());
+        juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Record",
+            recorder.getFile().getFileName() + " is missing " + juce::String(droppedSeconds, 2)
+                + " s of audio: the disk didn't keep up.");
+    }
+}
 
 void SimpleSynthEditor::paint(juce::Graphics& g)
 {
-    // Draw the panel background image
+    // Draw the panel background image. Every knob drag repaints the panel
+    // behind the knob, so resampling happens only when the size or the
+    // display scale changes; a repaint is a 1:1 copy of the cached pixels.
     if (panelImage.isValid())
     {
-        g.drawImage(panelImage, getLocalBounds().toFloat(),
-                    juce::RectanglePlacement::fillDestination);
+        updateScaledPanel(g.getInternalContext().getPhysicalPixelScaleFactor());
+        g.drawImage(scaledPanel, getLocalBounds().toFloat());
+    }
+    else if (! resources->isPanelDecoded())
+    {
+        // Still decoding: a plain panel until the timer swaps the image in
+        g.fillAll(juce::Colour(0xff1E1E1E));
     }
     else
     {
@@ -177,8 +876,35 @@ void SimpleSynthEditor::paint(juce::Graphics& g)
     }
 }
 
+void SimpleSynthEditor::updateScaledPanel(float scale)
+{
+    const int width = juce::roundToInt(static_cast<float>(getWidth()) * scale);
+    const int height = juce::roundToInt(static_cast<float>(getHeight()) * scale);
+    if (scaledPanel.isValid() && scale == scaledPanelScale
+        && scaledPanel.getWidth() == width && scaledPanel.getHeight() == height)
+        return;
+
+    scaledPanelScale = scale;
+    if (width <= 0 || height <= 0)
+    {
+        scaledPanel = {};
+        return;
+    }
+
+    // Same placement as drawing the full-size panel directly
+    scaledPanel = juce::Image(juce::Image::RGB, width, height, false);
+    juce::Graphics g(scaledPanel);
+    g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+    g.drawImage(panelImage, scaledPanel.getBounds().toFloat(), juce::RectanglePlacement::fillDestination);
+}
+
 void SimpleSynthEditor::resized()
 {
+    // Re-resampled for the new size at the last display scale; paint()
+    // catches a scale change
+    if (panelImage.isValid())
+        updateScaledPanel(scaledPanelScale > 0.0f ? scaledPanelScale : 1.0f);
+
     auto bounds = getLocalBounds();
     int w = bounds.getWidth();
     int h = bounds.getHeight();
@@ -208,6 +934,21 @@ void SimpleSynthEditor::resized()
     // ComboBoxes in available space
     lfo1TargetBox.setBounds(280, 420, 180, 30);                    // Center area
     lfo2TargetBox.setBounds(280, 480, 180, 30);                    // Center area
+    modMatrixButton.setBounds(280, 522, 88, 26);                   // Under the LFO targets
+    scenesButton.setBounds(372, 522, 88, 26);
+    morphSlider.setBounds(280, 554, 180, 26);                      // Scene morph, under the buttons
+    qualityTierLabel.setBounds(340, 20, 120, 20);                  // Top center
+    loadMeter.setBounds(340, 42, 120, 22);                         // Under the tier
+    midiLearnLabel.setBounds(300, 66, 200, 18);                    // Under the meter
+    analyzerView.setBounds(385, 90, 185, 140);                     // Between the top-right knobs
+
+    // Performance pads between the middle-row knobs
+    triggerPad.setBounds(285, 255, 110, 55);
+    divePad.setBounds(405, 255, 110, 55);
+    throwPad.setBounds(285, 320, 110, 40);
+    holdButton.setBounds(405, 320, 110, 40);
+    tuningButton.setBounds(285, 366, 230, 26);
+    recordButton.setBounds(285, 396, 230, 20);
     
     // Position labels overlaid on knobs
     auto labelHeight = 20;
@@ -2,24 +2,142 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_dsp/juce_dsp.h>
 #include "PluginProcessor.h"
+#include "EditorResources.h"
 
-// Custom LookAndFeel for rasta-colored solid knobs
+// Custom LookAndFeel for rasta-colored solid knobs. One instance is shared
+// by every knob (and editor); each knob's colour is a property on the slider.
 class RastaKnobLookAndFeel : public juce::LookAndFeel_V4
 {
 public:
-    RastaKnobLookAndFeel();
     void drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height,
                          float sliderPos, float rotaryStartAngle, float rotaryEndAngle,
                          juce::Slider& slider) override;
-    
-    void setKnobColour(int index);
-    
+
+    // Cycles red, gold, green by index
+    static void setKnobColour(juce::Slider& slider, int index);
+
+private:
+    // Pointer geometry for the last knob radius; every knob is the same
+    // size, so it is built once and only transformed per paint
+    juce::Path pointerPath;
+    float pointerRadius = -1.0f;
+};
+
+// CPU load bar with a held worst-case marker (click to reset the marker)
+class LoadMeter : public juce::Component
+{
+public:
+    // Fold one timer tick of telemetry into the display
+    void update(float averageLoad, float worstBlockLoad);
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent&) override;
+
+private:
+    float load = 0.0f;
+    float worstLoad = 0.0f;
+};
+
+// Output oscilloscope and spectrum, fed from the processor's analysis tap
+// while the editor is open. Everything past the tap runs here on the
+// message thread, in the editor's timer: a 1024-point FFT per tick.
+class AnalyzerView : public juce::Component
+{
+public:
+    AnalyzerView();
+
+    // Drain the tap and refresh the display (editor timer)
+    void update(SimpleSynth::DSP::AnalysisTap& tap);
+
+    void paint(juce::Graphics& g) override;
+
+private:
+    static constexpr int fftOrder = 10;
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int scopeSize = 256;
+    static constexpr int numBands = 40;
+    static constexpr float minFrequency = 30.0f;
+    static constexpr float minDecibels = -90.0f;
+
+    juce::dsp::FFT fft { fftOrder };
+    juce::dsp::WindowingFunction<float> window { static_cast<size_t>(fftSize),
+                                                 juce::dsp::WindowingFunction<float>::hann, false };
+
+    // Last fftSize tap samples, circular from historyPosition
+    std::array<float, fftSize> history {};
+    int historyPosition = 0;
+
+    std::array<float, 2 * fftSize> fftData {};
+    std::array<float, scopeSize> scope {};
+    std::array<float, numBands> bandLevels {};   // dB, falling back slowly
+};
+
+// Momentary performance pad: fires onPress/onRelease around a mouse press
+class PerformancePad : public juce::Component
+{
+public:
+    explicit PerformancePad(const juce::String& text);
+
+    std::function<void()> onPress, onRelease;
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent&) override;
+    void mouseUp(const juce::MouseEvent&) override;
+
+private:
+    juce::String text;
+    bool pressed = false;
+};
+
+// Editor for the modulation matrix's user slots: source, destination and
+// depth per row. Writes straight through to the processor.
+class ModMatrixPanel : public juce::Component
+{
+public:
+    explicit ModMatrixPanel(SimpleSynthProcessor& processor);
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
 private:
-    juce::Colour currentKnobColour;
+    struct Row
+    {
+        juce::ComboBox source, destination;
+        juce::Slider depth { juce::Slider::LinearHorizontal, juce::Slider::TextBoxRight };
+    };
+
+    void sendSlot(size_t index);
+
+    SimpleSynthProcessor& processorRef;
+    std::array<Row, SimpleSynthProcessor::kNumUserModSlots> rows;
 };
 
-class SimpleSynthEditor  : public juce::AudioProcessorEditor
+// Scene snapshots: click a slot to capture the knobs into it, right-click
+// to clear it; Morph A/B pick the two scenes the Morph slider blends.
+class ScenePanel : public juce::Component
+{
+public:
+    explicit ScenePanel(SimpleSynthProcessor& processor);
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void mouseDown(const juce::MouseEvent& e) override;
+
+private:
+    void refreshSlots();
+
+    SimpleSynthProcessor& processorRef;
+    std::array<juce::TextButton, SimpleSynthProcessor::kNumSnapshots> slotButtons;
+    juce::ComboBox morphABox, morphBBox;
+
+    using ChoiceAttachment = juce::AudioProcessorValueTreeState::ComboBoxAttachment;
+    std::unique_ptr<ChoiceAttachment> morphAAttach, morphBAttach;
+};
+
+class SimpleSynthEditor  : public juce::AudioProcessorEditor,
+                           private juce::Timer
 {
 public:
     SimpleSynthEditor(SimpleSynthProcessor&);
@@ -28,9 +146,22 @@ public:
     void paint(juce::Graphics&) override;
     void resized() override;
 
+    // Right-click on a knob: MIDI learn menu
+    void mouseDown(const juce::MouseEvent& e) override;
+
 private:
+    void timerCallback() override;
+    void showMidiLearnMenu(juce::Slider& slider, SimpleSynth::Control::ParamIndex parameter);
+    void showTuningMenu();
+    void chooseTuningFile(bool scale);
+
     SimpleSynthProcessor& processorRef;
 
+    // Shared by every editor in the process; declared before the controls
+    // so the look-and-feel outlives the knobs using it
+    juce::SharedResourcePointer<EditorResources> resources;
+    juce::SharedResourcePointer<RastaKnobLookAndFeel> knobLookAndFeel;
+
     // Controls
     juce::Slider vcoRateSlider, vcoLevelSlider;
     juce::Slider delayTimeSlider, delayFeedbackSlider, delayWetDrySlider;
@@ -45,6 +176,47 @@ private:
     juce::Label lfo1RateLabel, lfo1AmountLabel;
     juce::Label lfo2RateLabel, lfo2AmountLabel;
 
+    // Quality tier currently in use (may be below the chosen one under CPU load)
+    juce::Label qualityTierLabel;
+    int displayedQualityTier = -2;
+
+    // Fed from the processor's block telemetry ring
+    LoadMeter loadMeter;
+
+    // Fed from the processor's analysis tap, enabled while the editor is open
+    AnalyzerView analyzerView;
+
+    // Performance gestures, sent through the processor's control event queue
+    PerformancePad triggerPad { "TRIGGER" }, divePad { "DIVE" }, throwPad { "THROW" };
+    juce::TextButton holdButton { "HOLD" };
+    // Shown while a MIDI learn waits for a controller
+    juce::Label midiLearnLabel;
+    int displayedLearnTarget = SimpleSynth::Control::MidiMapping::kNotLearning;
+
+    // Key tracking and Scala tuning files
+    juce::TextButton tuningButton;
+    juce::String displayedTuningName;
+    std::unique_ptr<juce::FileChooser> tuningChooser;
+
+    // Record mode: click to pick WAV or FLAC and start, click again to stop.
+    // Recording carries on with the editor closed; the timer resyncs the button.
+    juce::TextButton recordButton { "REC" };
+    juce::String displayedRecordText;
+    void showRecordMenu();
+    void stopRecording();
+
+    // Opens a ModMatrixPanel in a callout
+    juce::TextButton modMatrixButton { "MOD MATRIX" };
+
+    // Scene morph: the slider is on the panel for live use, the snapshot
+    // slots in a ScenePanel callout
+    juce::Slider morphSlider { juce::Slider::LinearHorizontal, juce::Slider::NoTextBox };
+    juce::TextButton scenesButton { "SCENES" };
+
+    void sendControlEvent(SimpleSynth::Control::ControlEvent::Type type,
+                          float value = 0.0f, float duration = 0.0f,
+                          SimpleSynth::Control::ParamIndex parameter = SimpleSynth::Control::ParamIndex::VcoRate);
+
     using Attachment = juce::AudioProcessorValueTreeState::SliderAttachment;
     using ChoiceAttachment = juce::AudioProcessorValueTreeState::ComboBoxAttachment;
 
@@ -52,14 +224,17 @@ private:
     std::unique_ptr<Attachment> delayTimeAttach, delayFeedbackAttach, delayWetDryAttach;
     std::unique_ptr<Attachment> lfo1RateAttach, lfo1AmountAttach;
     std::unique_ptr<Attachment> lfo2RateAttach, lfo2AmountAttach;
+    std::unique_ptr<Attachment> morphAttach;
 
     std::unique_ptr<ChoiceAttachment> lfo1TargetAttach, lfo2TargetAttach;
 
-    // Background panel image
+    // Background panel image (from resources once decoded), and a copy
+    // resampled to the editor's size in physical pixels so repaints only blit it
     juce::Image panelImage;
-    
-    // Custom LookAndFeel instances for each knob with different rasta colors
-    std::array<std::unique_ptr<RastaKnobLookAndFeel>, 9> knobLookAndFeels;
+    bool waitingForPanel = false;
+    juce::Image scaledPanel;
+    float scaledPanelScale = 0.0f;
+    void updateScaledPanel(float scale);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimpleSynthEditor)
 };
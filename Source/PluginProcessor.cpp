@@ -28,6 +28,13 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleSynthProcessor::create
         "delayWetDry", "Delay Wet/Dry",
         juce::NormalisableRange<float>(0.0f, 1.0f), 0.4f));
 
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        "delayHeads", "Delay Heads", 1,
+        static_cast<int>(SimpleSynth::DSP::DubDelay::kMaxTaps), 1));
+
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "delayTape", "Delay Tape", false));
+
     // LFO 1 Parameters
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         "lfo1Rate", "LFO 1 Rate",
@@ -54,6 +61,69 @@ juce::AudioProcessorValueTreeState::ParameterLayout SimpleSynthProcessor::create
         "lfo2Target", "LFO 2 Target",
         juce::StringArray{"None", "LFO1 Rate", "LFO1 Amount", "Delay Wet/Dry"}, 0));
 
+    // Quality
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "oversampling", "Oversampling",
+        juce::StringArray{"Off", "2x", "4x", "2x VCO Only", "4x VCO Only"}, 0));
+
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "quality", "Quality",
+        juce::StringArray{"Auto", "Eco", "Live", "Studio", "Custom"}, 0));
+
+    // Pitch: off, the siren sits at VCO Rate whatever key gates it
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "keyTrack", "Key Track", false));
+
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "glide", "Glide",
+        juce::NormalisableRange<float>(0.0f, 2.0f, 0.001f, 0.5f), 0.0f));
+
+    // Scenes: morph between two captured snapshots (slot 0 = none)
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "morph", "Morph",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.0f));
+
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        "morphA", "Morph A", 0, static_cast<int>(kNumSnapshots), 0));
+
+    layout.add(std::make_unique<juce::AudioParameterInt>(
+        "morphB", "Morph B", 0, static_cast<int>(kNumSnapshots), 0));
+
+    // Reverb (after the delay): mix 0 bypasses it
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "reverbMix", "Reverb Mix",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.0f));
+
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "reverbDecay", "Reverb Decay",
+        juce::NormalisableRange<float>(0.1f, 10.0f, 0.01f, 0.4f), 2.0f));
+
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "reverbDamping", "Reverb Damping",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.4f));
+
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "reverbSize", "Reverb Size",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.5f));
+
+    // Spring (between delay and reverb): mix 0 bypasses it
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "springMix", "Spring Mix",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.0f));
+
+    // Filter (between the VCO and the delay)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "filterMode", "Filter Mode",
+        juce::StringArray{"Off", "Low-pass", "Band-pass"}, 0));
+
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "filterCutoff", "Filter Cutoff",
+        juce::NormalisableRange<float>(20.0f, 20000.0f, 0.1f, 0.25f), 2000.0f));
+
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        "filterResonance", "Filter Resonance",
+        juce::NormalisableRange<float>(0.0f, 1.0f), 0.2f));
+
     return layout;
 }
 
@@ -63,10 +133,48 @@ SimpleSynthProcessor::SimpleSynthProcessor()
                          .withOutput("Output", juce::AudioChannelSet::mono(), true))
     , parameters_(*this, nullptr, "DubSiren", createParameterLayout())
 {
+    using SimpleSynth::DSP::QualityTier;
+
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+    {
+        rawParams_[i] = parameters_.getRawParameterValue(SimpleSynth::Control::kParameterInfo[i].id);
+        jassert(rawParams_[i] != nullptr); // Table out of step with createParameterLayout()
+        parameterRanges_[i] = parameters_.getParameterRange(SimpleSynth::Control::kParameterInfo[i].id);
+        parameterObjects_[i] = parameters_.getParameter(SimpleSynth::Control::kParameterInfo[i].id);
+
+        controllers_[i].smoother.SetMode(SimpleSynth::Control::kParameterInfo[i].smoothing);
+        controllers_[i].smoother.SetTime(SimpleSynth::Control::kParameterInfo[i].smoothingSeconds);
+    }
+
+    const float tierCosts[SimpleSynth::DSP::kNumQualityTiers] = {
+        SimpleSynth::DSP::GetQualityTierCost(QualityTier::Eco),
+        SimpleSynth::DSP::GetQualityTierCost(QualityTier::Live),
+        SimpleSynth::DSP::GetQualityTierCost(QualityTier::Studio)
+    };
+    governor_.SetTierCosts(tierCosts, SimpleSynth::DSP::kNumQualityTiers);
+
+    morphPosition_.SetMode(SimpleSynth::Control::GetParameterInfo(ParamIndex::Morph).smoothing);
+    morphPosition_.SetTime(SimpleSynth::Control::GetParameterInfo(ParamIndex::Morph).smoothingSeconds);
+
+    // Controller echoes to the host (knobs follow CCs)
+    startTimerHz(30);
+
+#if DUBSIREN_TRACE
+    // Shared by every instance in the process; the first one names the file
+    const auto defaultTraceFile = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                      .getChildFile("DubSiren-trace.json").getFullPathName();
+    SimpleSynth::Perf::TraceRecorder::GetInstance().Start(
+        juce::SystemStats::getEnvironmentVariable("DUBSIREN_TRACE_FILE", defaultTraceFile).toStdString());
+#endif
 }
 
 SimpleSynthProcessor::~SimpleSynthProcessor()
 {
+    stopTimer();
+
+#if DUBSIREN_TRACE
+    SimpleSynth::Perf::TraceRecorder::GetInstance().Stop();
+#endif
 }
 
 //==============================================================================
@@ -92,48 +200,234 @@ bool SimpleSynthProcessor::isMidiEffect() const
 
 double SimpleSynthProcessor::getTailLengthSeconds() const
 {
-    return 2.0; // Delay tail
+    // Delay tail, or the spring's or reverb's if they ring longer (any
+    // thread: the atomics, not the audio thread's state snapshot)
+    double tail = 2.0;
+    if (rawParams_[static_cast<size_t>(ParamIndex::SpringMix)]->load() > 0.0f)
+        tail = juce::jmax(tail, springImpulse_->getLengthSeconds());
+    if (rawParams_[static_cast<size_t>(ParamIndex::ReverbMix)]->load() > 0.0f)
+        tail = juce::jmax(tail, static_cast<double>(rawParams_[static_cast<size_t>(ParamIndex::ReverbDecay)]->load()));
+    return tail;
+}
+
+juce::File SimpleSynthProcessor::getPresetBankFile()
+{
+    const auto defaultBank = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+                                 .getChildFile("DubSiren").getChildFile("Presets.dspb").getFullPathName();
+    return juce::File(juce::SystemStats::getEnvironmentVariable("DUBSIREN_PRESET_BANK", defaultBank));
+}
+
+SimpleSynthProcessor::SharedPresetBank::SharedPresetBank()
+{
+    // Mapped read-only: pages are shared with every instance (and process)
+    // using the bank, and only presets actually recalled are read in
+    const auto path = getPresetBankFile();
+    if (! path.existsAsFile())
+        return;
+
+    file = std::make_unique<juce::MemoryMappedFile>(path, juce::MemoryMappedFile::readOnly);
+    if (file->getData() == nullptr || ! bank.Open(file->getData(), file->getSize()))
+    {
+        bank.Close();
+        file.reset();
+    }
+}
+
+juce::File SimpleSynthProcessor::getSpringImpulseFile()
+{
+    const auto defaultImpulse = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+                                    .getChildFile("DubSiren").getChildFile("Spring.wav").getFullPathName();
+    return juce::File(juce::SystemStats::getEnvironmentVariable("DUBSIREN_SPRING_IR", defaultImpulse));
+}
+
+std::unique_ptr<juce::MemoryMappedAudioFormatReader> SimpleSynthProcessor::SharedSpringImpulse::openImpulse()
+{
+    const auto path = getSpringImpulseFile();
+    if (! path.existsAsFile())
+        return nullptr;
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> reader(wav.createMemoryMappedReader(path));
+    if (reader == nullptr || reader->numChannels == 0 || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0)
+        return nullptr;
+
+    return reader;
+}
+
+SimpleSynthProcessor::SharedSpringImpulse::SharedSpringImpulse()
+{
+    // Only the header: the tail length is needed before any kernel
+    auto reader = openImpulse();
+    if (reader == nullptr)
+        return;
+
+    impulseRate = reader->sampleRate;
+    impulseLength = static_cast<int>(juce::jmin(reader->lengthInSamples,
+                                                static_cast<juce::int64>(kMaxLengthSeconds * impulseRate)));
+}
+
+const SimpleSynth::DSP::ConvolutionKernel* SimpleSynthProcessor::SharedSpringImpulse::getKernel(double sampleRate)
+{
+    if (impulseLength <= 0)
+        return nullptr;
+
+    const juce::ScopedLock lock(kernelLock);
+    for (const auto& kernel : kernels)
+        if (kernel.first == sampleRate)
+            return kernel.second.get();
+
+    // Mapped rather than streamed, and decoded into a local copy that
+    // goes once the kernel is built
+    auto reader = openImpulse();
+    if (reader == nullptr || ! reader->mapEntireFile() || reader->getMappedSection().isEmpty())
+        return nullptr;
+
+    const auto numChannels = static_cast<int>(reader->numChannels);
+    const auto length = static_cast<int>(juce::jmin(static_cast<juce::int64>(impulseLength), reader->lengthInSamples));
+    juce::AudioBuffer<float> buffer(numChannels, length);
+    reader->read(buffer.getArrayOfWritePointers(), numChannels, 0, length);
+
+    // A stereo tank becomes mono, as the siren is
+    std::vector<float> impulse(static_cast<size_t>(length), 0.0f);
+    for (int channel = 0; channel < numChannels; ++channel)
+        juce::FloatVectorOperations::addWithMultiply(impulse.data(), buffer.getReadPointer(channel),
+                                                     1.0f / static_cast<float>(numChannels), length);
+
+    // Linear resampling to the host rate is enough for a reverb tail
+    const double step = reader->sampleRate / sampleRate;
+    const auto resampledLength = static_cast<size_t>(static_cast<double>(impulse.size() - 1) / step) + 1;
+    std::vector<float> resampled(resampledLength);
+    for (size_t i = 0; i < resampledLength; ++i)
+    {
+        const double position = static_cast<double>(i) * step;
+        const auto index = juce::jmin(static_cast<size_t>(position), impulse.size() - 1);
+        const auto next = juce::jmin(index + 1, impulse.size() - 1);
+        const auto fraction = static_cast<float>(position - static_cast<double>(index));
+        resampled[i] = impulse[index] + (impulse[next] - impulse[index]) * fraction;
+    }
+
+    // Unit energy, so the mix knob means the same for any recording
+    double energy = 0.0;
+    for (float sample : resampled)
+        energy += static_cast<double>(sample) * sample;
+    if (energy > 0.0)
+    {
+        const auto gain = static_cast<float>(1.0 / std::sqrt(energy));
+        for (auto& sample : resampled)
+            sample *= gain;
+    }
+
+    kernels.emplace_back(sampleRate, std::make_unique<SimpleSynth::DSP::ConvolutionKernel>(resampled.data(), resampled.size()));
+    return kernels.back().second.get();
+}
+
+double SimpleSynthProcessor::SharedSpringImpulse::getLengthSeconds() const
+{
+    return impulseRate > 0.0 ? static_cast<double>(impulseLength) / impulseRate : 0.0;
 }
 
 int SimpleSynthProcessor::getNumPrograms()
 {
-    return 1;
+    // Hosts expect at least one, even without a bank
+    return juce::jmax(1, static_cast<int>(presetBank_->bank.GetNumPresets()));
 }
 
 int SimpleSynthProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram_;
 }
 
 void SimpleSynthProcessor::setCurrentProgram(int index)
 {
-    juce::ignoreUnused(index);
+    const auto& bank = presetBank_->bank;
+    if (index < 0 || index >= static_cast<int>(bank.GetNumPresets()))
+        return;
+
+    // Straight out of the mapped record: no parsing, no allocation
+    std::array<float, SimpleSynth::Control::kNumParameters> defaults {}, values {};
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+        defaults[i] = getDefaultParameterValue(i);
+    bank.GetValues(static_cast<size_t>(index), values.data(), defaults.data());
+
+    const juce::ScopedLock lock(stateLock_);
+    applyStateParameters(values);
+    currentProgram_ = index;
 }
 
 const juce::String SimpleSynthProcessor::getProgramName(int index)
 {
-    juce::ignoreUnused(index);
-    return {};
+    const auto& bank = presetBank_->bank;
+    if (index < 0 || index >= static_cast<int>(bank.GetNumPresets()))
+        return {};
+
+    const auto name = bank.GetName(static_cast<size_t>(index));
+    return juce::String::fromUTF8(name.data(), static_cast<int>(name.size()));
 }
 
 void SimpleSynthProcessor::changeProgramName(int index, const juce::String& newName)
 {
+    // The bank is read-only
     juce::ignoreUnused(index, newName);
 }
 
+//==============================================================================
+juce::File SimpleSynthProcessor::getNewRecordingFile(const juce::String& extension)
+{
+    const auto directory = juce::File::getSpecialLocation(juce::File::userMusicDirectory).getChildFile("Dub Siren");
+    const auto name = "Dub Siren " + juce::Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S");
+    return directory.getNonexistentChildFile(name, extension, false);
+}
+
+bool SimpleSynthProcessor::startRecording(const juce::File& file)
+{
+    return recorder_.start(file, hostSampleRate_);
+}
+
+void SimpleSynthProcessor::stopRecording()
+{
+    recorder_.stop();
+}
+
 //==============================================================================
 void SimpleSynthProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    DUBSIREN_TRACE_SCOPE("prepareToPlay");
     juce::ignoreUnused(samplesPerBlock);
 
+    hostSampleRate_ = sampleRate;
+
     // Initialize DSP modules
     dubOscillator_.Init(static_cast<float>(sampleRate));
+    filter_.Init(static_cast<float>(sampleRate));
     lfo1_.Init(static_cast<float>(sampleRate));
     lfo2_.Init(static_cast<float>(sampleRate));
     dubDelay_.Init(static_cast<float>(sampleRate), 2.0f);
+    spring_.Init(springImpulse_->getKernel(sampleRate));
+    reverb_.Init(static_cast<float>(sampleRate));
     envelope_.Init(static_cast<float>(sampleRate));
+    analysisTap_.Init(static_cast<float>(sampleRate));
 
+    // Render buffers are sized for the largest oversampling factor, so
+    // switching modes in processBlock never allocates
+    oversampler_.Init(SimpleSynth::DSP::kMaxBlockSize);
+    envelopeBuffer_.assign(SimpleSynth::DSP::kMaxBlockSize * SimpleSynth::DSP::Oversampler::kMaxFactor, 0.0f);
+
+    governor_.Reset();
+
+    // Control events before this point have no timeline to land on
+    previousBlockStartTicks_ = 0;
+    diveGlide_.Reset(diveGlide_.GetTarget());
+    noteGlide_.Reset(noteGlide_.GetTarget());
+    pitchMultiplier_ = diveGlide_.GetValue() * noteGlide_.GetValue();
+    modulationNoise_.SetSeed(0);    // Same noise modulation every render
+
+    receiveStateSnapshot();
     updateDSPFromParameters();
+    applyQualitySettings(resolveQualitySettings(readQualityChoice()));
+
+    // The same at every oversampling factor, so quality changes (and the
+    // governor) never move it
+    setLatencySamples(static_cast<int>(oversampler_.GetLatencySamples()));
 }
 
 void SimpleSynthProcessor::releaseResources()
@@ -148,178 +442,1603 @@ bool SimpleSynthProcessor::isBusesLayoutSupported(const BusesLayout& layouts) co
 
 void SimpleSynthProcessor::updateDSPFromParameters()
 {
-    // Get parameter values
-    float vcoRate = parameters_.getRawParameterValue("vcoRate")->load();
-    float vcoLevel = parameters_.getRawParameterValue("vcoLevel")->load();
+    // Snapshot parameter values once per block; the sample loop reads blockParams_
+    blockParams_.vcoRate = loadParameter(ParamIndex::VcoRate);
+    blockParams_.vcoLevel = loadParameter(ParamIndex::VcoLevel);
+
+    blockParams_.delayTime = loadParameter(ParamIndex::DelayTime);
+    blockParams_.delayFeedback = loadParameter(ParamIndex::DelayFeedback);
+    blockParams_.delayWetDry = loadParameter(ParamIndex::DelayWetDry);
+    blockParams_.delayHeads = static_cast<size_t>(loadParameter(ParamIndex::DelayHeads));
+    blockParams_.delayTape = loadParameter(ParamIndex::DelayTape) > 0.5f;
+
+    blockParams_.lfo1Rate = loadParameter(ParamIndex::Lfo1Rate);
+    blockParams_.lfo1Amount = loadParameter(ParamIndex::Lfo1Amount);
+
+    blockParams_.lfo2Rate = loadParameter(ParamIndex::Lfo2Rate);
+    blockParams_.lfo2Amount = loadParameter(ParamIndex::Lfo2Amount);
+    updateLfoTargetSlots();
+
+    blockParams_.keyTrack = loadParameter(ParamIndex::KeyTrack) > 0.5f;
+    blockParams_.glide = loadParameter(ParamIndex::Glide);
+    blockParams_.morph = loadParameter(ParamIndex::Morph);
 
-    float delayTime = parameters_.getRawParameterValue("delayTime")->load();
-    float delayFeedback = parameters_.getRawParameterValue("delayFeedback")->load();
-    float delayWetDry = parameters_.getRawParameterValue("delayWetDry")->load();
+    blockParams_.reverbMix = loadParameter(ParamIndex::ReverbMix);
+    blockParams_.reverbDecay = loadParameter(ParamIndex::ReverbDecay);
+    blockParams_.reverbDamping = loadParameter(ParamIndex::ReverbDamping);
+    blockParams_.reverbSize = loadParameter(ParamIndex::ReverbSize);
+    blockParams_.springMix = loadParameter(ParamIndex::SpringMix);
 
-    float lfo1Rate = parameters_.getRawParameterValue("lfo1Rate")->load();
-    float lfo1Amount = parameters_.getRawParameterValue("lfo1Amount")->load();
-    int lfo1TargetIndex = parameters_.getRawParameterValue("lfo1Target")->load();
+    blockParams_.filterMode = static_cast<SimpleSynth::DSP::ResonantFilter::Mode>(
+        juce::jlimit(0, 2, static_cast<int>(loadParameter(ParamIndex::FilterMode))));
+    blockParams_.filterCutoff = loadParameter(ParamIndex::FilterCutoff);
+    blockParams_.filterResonance = loadParameter(ParamIndex::FilterResonance);
 
-    float lfo2Rate = parameters_.getRawParameterValue("lfo2Rate")->load();
-    float lfo2Amount = parameters_.getRawParameterValue("lfo2Amount")->load();
-    int lfo2TargetIndex = parameters_.getRawParameterValue("lfo2Target")->load();
+    // Scene values replace the parameters' own; controllers and gestures
+    // below still win
+    updateMorph();
 
+    // Key tracking off: back to VCO Rate, however the last note was tuned
+    if (! blockParams_.keyTrack && trackedNote_ >= 0)
+    {
+        trackedNote_ = -1;
+        noteGlide_.Reset(1.0f);
+        pitchMultiplier_ = diveGlide_.GetValue();
+    }
+
+    // A mapped controller drives its parameter until the parameter's own
+    // value moves (knob, automation); the timer's echo of it doesn't count
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+    {
+        auto& controller = controllers_[i];
+        if (! controller.active)
+            continue;
+
+        const float raw = blockParameterValues_[i];
+        if (raw != controller.lastRawValue)
+        {
+            const float echo = controller.publishedValue.load(std::memory_order_relaxed);
+            controller.lastRawValue = raw;
+
+            if (std::abs(raw - echo) > 1.0e-6f * (1.0f + std::abs(echo)))
+            {
+                controller.active = false;
+                controller.pendingNormalised.store(-1.0f, std::memory_order_relaxed);
+                smoothingMask_ &= ~(1u << i);
+                continue;
+            }
+        }
+
+        setBlockParameter(SimpleSynth::Control::ToParamIndex(i), controller.smoother.GetValue());
+    }
+
+    // Held gestures win over the parameter's own value and controllers
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+        if (overrideActive_[i])
+            setBlockParameter(SimpleSynth::Control::ToParamIndex(i), parameterOverrides_[i]);
+
+    applyBlockParameters();
+}
+
+void SimpleSynthProcessor::applyBlockParameters()
+{
     // Set LFO base rates (will be processed per-sample in processBlock)
-    lfo2_.SetRate(lfo2Rate);
-    lfo2_.SetAmount(lfo2Amount);
-    lfo1_.SetRate(lfo1Rate);
-    lfo1_.SetAmount(lfo1Amount);
+    lfo2_.SetRate(blockParams_.lfo2Rate);
+    lfo2_.SetAmount(blockParams_.lfo2Amount);
+    lfo1_.SetRate(blockParams_.lfo1Rate);
+    lfo1_.SetAmount(blockParams_.lfo1Amount);
 
     // Update DSP modules with modulated values
-    dubOscillator_.SetFrequency(vcoRate);
-    dubOscillator_.SetLevel(vcoLevel);
+    dubOscillator_.SetFrequency(blockParams_.vcoRate * pitchMultiplier_);
+    dubOscillator_.SetLevel(blockParams_.vcoLevel);
+    noteGlide_.SetTime(blockParams_.glide);
+    morphPosition_.SetTarget(blockParams_.morph);
+
+    dubDelay_.SetNumTaps(blockParams_.delayHeads);
+    updateDelayHeads(blockParams_.delayTime, blockParams_.delayFeedback);
+    dubDelay_.SetWetDry(blockParams_.delayWetDry);
+    dubDelay_.SetTapeEnabled(blockParams_.delayTape);
+
+    reverb_.SetMix(blockParams_.reverbMix);
+    reverb_.SetDecay(blockParams_.reverbDecay);
+    reverb_.SetDamping(blockParams_.reverbDamping);
+    reverb_.SetSize(blockParams_.reverbSize);
+    spring_.SetMix(blockParams_.springMix);
+
+    // Off skips the per-tick targets, so switching on starts from the knobs
+    if (blockParams_.filterMode != filter_.GetMode())
+        filter_.SetTarget(blockParams_.filterCutoff, blockParams_.filterResonance, 0);
+    filter_.SetMode(blockParams_.filterMode);
+}
+
+float SimpleSynthProcessor::getBlockParameter(ParamIndex index) const
+{
+    switch (index)
+    {
+        case ParamIndex::VcoRate:       return blockParams_.vcoRate;
+        case ParamIndex::VcoLevel:      return blockParams_.vcoLevel;
+        case ParamIndex::DelayTime:     return blockParams_.delayTime;
+        case ParamIndex::DelayFeedback: return blockParams_.delayFeedback;
+        case ParamIndex::DelayWetDry:   return blockParams_.delayWetDry;
+        case ParamIndex::Lfo1Rate:      return blockParams_.lfo1Rate;
+        case ParamIndex::Lfo1Amount:    return blockParams_.lfo1Amount;
+        case ParamIndex::Lfo2Rate:      return blockParams_.lfo2Rate;
+        case ParamIndex::Lfo2Amount:    return blockParams_.lfo2Amount;
+        case ParamIndex::Glide:         return blockParams_.glide;
+        case ParamIndex::Morph:         return blockParams_.morph;
+        case ParamIndex::ReverbMix:     return blockParams_.reverbMix;
+        case ParamIndex::ReverbDecay:   return blockParams_.reverbDecay;
+        case ParamIndex::ReverbDamping: return blockParams_.reverbDamping;
+        case ParamIndex::SpringMix:     return blockParams_.springMix;
+        case ParamIndex::FilterCutoff:  return blockParams_.filterCutoff;
+        case ParamIndex::FilterResonance: return blockParams_.filterResonance;
+
+        case ParamIndex::DelayHeads:
+        case ParamIndex::DelayTape:
+        case ParamIndex::Lfo1Target:
+        case ParamIndex::Lfo2Target:
+        case ParamIndex::Oversampling:
+        case ParamIndex::Quality:
+        case ParamIndex::KeyTrack:
+        case ParamIndex::MorphA:
+        case ParamIndex::MorphB:
+        case ParamIndex::ReverbSize:
+        case ParamIndex::FilterMode:
+        case ParamIndex::Count:
+            break;
+    }
+
+    jassertfalse;
+    return 0.0f;
+}
+
+void SimpleSynthProcessor::applyParameter(ParamIndex index)
+{
+    // Push one block parameter to its module (modulation may override it
+    // at the next control tick, as with applyBlockParameters)
+    switch (index)
+    {
+        case ParamIndex::VcoRate:       dubOscillator_.SetFrequency(blockParams_.vcoRate * pitchMultiplier_); break;
+        case ParamIndex::VcoLevel:      dubOscillator_.SetLevel(blockParams_.vcoLevel); break;
+        case ParamIndex::DelayTime:
+        case ParamIndex::DelayFeedback: updateDelayHeads(blockParams_.delayTime, blockParams_.delayFeedback); break;
+        case ParamIndex::DelayWetDry:   dubDelay_.SetWetDry(blockParams_.delayWetDry); break;
+        case ParamIndex::Lfo1Rate:      lfo1_.SetRate(blockParams_.lfo1Rate); break;
+        case ParamIndex::Lfo1Amount:    lfo1_.SetAmount(blockParams_.lfo1Amount); break;
+        case ParamIndex::Lfo2Rate:      lfo2_.SetRate(blockParams_.lfo2Rate); break;
+        case ParamIndex::Lfo2Amount:    lfo2_.SetAmount(blockParams_.lfo2Amount); break;
+        case ParamIndex::Glide:         noteGlide_.SetTime(blockParams_.glide); break;
+        case ParamIndex::Morph:         morphPosition_.SetTarget(blockParams_.morph); break;
+        case ParamIndex::ReverbMix:     reverb_.SetMix(blockParams_.reverbMix); break;
+        case ParamIndex::ReverbDecay:   reverb_.SetDecay(blockParams_.reverbDecay); break;
+        case ParamIndex::ReverbDamping: reverb_.SetDamping(blockParams_.reverbDamping); break;
+        case ParamIndex::SpringMix:     spring_.SetMix(blockParams_.springMix); break;
+
+        // Read at every control tick, by updateFilterTarget()
+        case ParamIndex::FilterCutoff:
+        case ParamIndex::FilterResonance:
+            break;
+
+        case ParamIndex::DelayHeads:
+        case ParamIndex::DelayTape:
+        case ParamIndex::Lfo1Target:
+        case ParamIndex::Lfo2Target:
+        case ParamIndex::Oversampling:
+        case ParamIndex::Quality:
+        case ParamIndex::KeyTrack:
+        case ParamIndex::MorphA:
+        case ParamIndex::MorphB:
+        case ParamIndex::ReverbSize:
+        case ParamIndex::FilterMode:
+        case ParamIndex::Count:
+            jassertfalse;
+            break;
+    }
+}
+
+void SimpleSynthProcessor::setBlockParameter(ParamIndex index, float value)
+{
+    switch (index)
+    {
+        case ParamIndex::VcoRate:       blockParams_.vcoRate = value; break;
+        case ParamIndex::VcoLevel:      blockParams_.vcoLevel = value; break;
+        case ParamIndex::DelayTime:     blockParams_.delayTime = value; break;
+        case ParamIndex::DelayFeedback: blockParams_.delayFeedback = value; break;
+        case ParamIndex::DelayWetDry:   blockParams_.delayWetDry = value; break;
+        case ParamIndex::Lfo1Rate:      blockParams_.lfo1Rate = value; break;
+        case ParamIndex::Lfo1Amount:    blockParams_.lfo1Amount = value; break;
+        case ParamIndex::Lfo2Rate:      blockParams_.lfo2Rate = value; break;
+        case ParamIndex::Lfo2Amount:    blockParams_.lfo2Amount = value; break;
+        case ParamIndex::Glide:         blockParams_.glide = value; break;
+        case ParamIndex::Morph:         blockParams_.morph = value; break;
+        case ParamIndex::ReverbMix:     blockParams_.reverbMix = value; break;
+        case ParamIndex::ReverbDecay:   blockParams_.reverbDecay = value; break;
+        case ParamIndex::ReverbDamping: blockParams_.reverbDamping = value; break;
+        case ParamIndex::SpringMix:     blockParams_.springMix = value; break;
+        case ParamIndex::FilterCutoff:  blockParams_.filterCutoff = value; break;
+        case ParamIndex::FilterResonance: blockParams_.filterResonance = value; break;
+
+        // Discrete parameters only change between blocks
+        case ParamIndex::DelayHeads:
+        case ParamIndex::DelayTape:
+        case ParamIndex::Lfo1Target:
+        case ParamIndex::Lfo2Target:
+        case ParamIndex::Oversampling:
+        case ParamIndex::Quality:
+        case ParamIndex::KeyTrack:
+        case ParamIndex::MorphA:
+        case ParamIndex::MorphB:
+        case ParamIndex::ReverbSize:
+        case ParamIndex::FilterMode:
+        case ParamIndex::Count:
+            jassertfalse;
+            break;
+    }
+}
 
+void SimpleSynthProcessor::updateDelayHeads(float delayTime, float delayFeedback)
+{
     dubDelay_.SetDelayTime(delayTime);
     dubDelay_.SetFeedback(delayFeedback);
-    dubDelay_.SetWetDry(delayWetDry);
+
+    const size_t numHeads = dubDelay_.GetNumTaps();
+    if (numHeads == 1)
+        return;
+
+    // Evenly spaced heads like a tape echo: the delay time sets the tape
+    // path length (last head), the feedback amount is shared between heads.
+    const float headGain = 1.0f / std::sqrt(static_cast<float>(numHeads));
+    const float headFeedback = delayFeedback / static_cast<float>(numHeads);
+
+    for (size_t head = 0; head < numHeads; ++head)
+    {
+        float headTime = delayTime * static_cast<float>(head + 1) / static_cast<float>(numHeads);
+        dubDelay_.SetTap(head, headTime, headGain, headFeedback);
+    }
 }
 
-void SimpleSynthProcessor::processBlock(juce::AudioBuffer<float>& buffer,
-                                        juce::MidiBuffer& midiMessages)
+SimpleSynthProcessor::QualityChoice SimpleSynthProcessor::readQualityChoice() const
 {
-    juce::ScopedNoDenormals noDenormals;
-    // Prepare
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
+    return static_cast<QualityChoice>(
+        static_cast<int>(loadParameter(ParamIndex::Quality)));
+}
 
-    // Clear output
-    buffer.clear();
+SimpleSynth::DSP::QualitySettings SimpleSynthProcessor::resolveQualitySettings(QualityChoice choice)
+{
+    using SimpleSynth::DSP::QualityTier;
 
-    const int numSamples = buffer.getNumSamples();
-    float* outputData = buffer.getWritePointer(0);
+    if (choice == QualityChoice::Custom)
+    {
+        activeQualityTier_.store(-1, std::memory_order_relaxed);
 
-    // Update static DSP params (LFOs/Delay) before sample loop
-    updateDSPFromParameters();
+        // Custom: classic per-sample paths plus the Oversampling parameter
+        const auto mode = static_cast<OversamplingMode>(
+            static_cast<int>(loadParameter(ParamIndex::Oversampling)));
 
-    // Iterate MIDI events with timing and render sample-by-sample so synth only
-    // produces audio while a MIDI note is held.
-    juce::MidiBuffer::Iterator it(midiMessages);
-    juce::MidiMessage msg;
-    int samplePos;
-    bool hasMsg = it.getNextEvent(msg, samplePos);
-
-    for (int i = 0; i < numSamples; ++i) {
-        // process all messages that occur at this sample
-        while (hasMsg && samplePos == i) {
-            if (msg.isNoteOn()) {
-                currentMidiNote_ = msg.getNoteNumber();
-                isNoteOn_ = true;
-                currentNoteVelocity_ = msg.getFloatVelocity();
-                // set oscillator frequency
-                float freq = SimpleSynth::DSP::MidiNoteToFrequency(currentMidiNote_);
-                dubOscillator_.SetFrequency(freq);
-                // scale base level by velocity (final amplitude will be multiplied by envelope)
-                float baseLevel = parameters_.getRawParameterValue("vcoLevel")->load();
-                dubOscillator_.SetLevel(baseLevel * currentNoteVelocity_);
-                // trigger envelope
-                envelope_.NoteOn();
-            }
-            else if (msg.isNoteOff() || (msg.isNoteOn() && msg.getVelocity() == 0)) {
-                int note = msg.getNoteNumber();
-                if (note == currentMidiNote_) {
-                    isNoteOn_ = false; // note state
-                    currentMidiNote_ = -1;
-                    // release envelope (allow smooth release tail)
-                    envelope_.NoteOff();
-                }
-            }
+        SimpleSynth::DSP::QualitySettings settings{ 1, false, SimpleSynth::DSP::DubDelay::Interpolation::None, false, 1 };
+        settings.oversampleVcoOnly = (mode == OversamplingMode::TwoXVcoOnly
+                                      || mode == OversamplingMode::FourXVcoOnly);
+        settings.oversamplingFactor = (mode == OversamplingMode::Off) ? 1
+                                    : (mode == OversamplingMode::TwoX || mode == OversamplingMode::TwoXVcoOnly) ? 2
+                                    : 4;
+        return settings;
+    }
 
-            hasMsg = it.getNextEvent(msg, samplePos);
-        }
+    QualityTier tier = QualityTier::Live;
+    switch (choice)
+    {
+        // Offline bounces get the expensive paths, live playback the cheap ones
+        case QualityChoice::Auto:   tier = isNonRealtime() ? QualityTier::Studio : QualityTier::Live; break;
+        case QualityChoice::Eco:    tier = QualityTier::Eco; break;
+        case QualityChoice::Live:   tier = QualityTier::Live; break;
+        case QualityChoice::Studio: tier = QualityTier::Studio; break;
+        case QualityChoice::Custom: break;
+    }
 
-        // Process LFOs per-sample for fast modulation
-        float lfo2Value = lfo2_.ProcessSample();
-        float lfo1Value = lfo1_.ProcessSample();
-        
-        // Get parameter values
-        float baseVCORate = parameters_.getRawParameterValue("vcoRate")->load();
-        float baseDelayTime = parameters_.getRawParameterValue("delayTime")->load();
-        float baseDelayFeedback = parameters_.getRawParameterValue("delayFeedback")->load();
-        float baseDelayWetDry = parameters_.getRawParameterValue("delayWetDry")->load();
-        int lfo1TargetIndex = parameters_.getRawParameterValue("lfo1Target")->load();
-        int lfo2TargetIndex = parameters_.getRawParameterValue("lfo2Target")->load();
-        float lfo1Amount = parameters_.getRawParameterValue("lfo1Amount")->load();
-        float lfo2Amount = parameters_.getRawParameterValue("lfo2Amount")->load();
-        float baseLFO1Rate = parameters_.getRawParameterValue("lfo1Rate")->load();
-        
-        float lfo2Mod = lfo2Value * lfo2Amount;
-        float currentLFO1Rate = baseLFO1Rate;
-        float currentLFO1Amount = lfo1Amount;
-        
-        // Apply LFO2 modulation
-        LFO2Target lfo2Target = static_cast<LFO2Target>(lfo2TargetIndex);
-        if (lfo2Target == LFO2Target::LFO1Rate) {
-            float modulatedLFO1Rate = baseLFO1Rate * (1.0f + lfo2Mod * 3.0f);
-            currentLFO1Rate = juce::jlimit(0.1f, 80.0f, modulatedLFO1Rate);
-            lfo1_.SetRate(currentLFO1Rate);
-        } else if (lfo2Target == LFO2Target::LFO1Amount) {
-            currentLFO1Amount = juce::jlimit(0.0f, 1.0f, lfo1Amount + lfo2Mod * 0.5f);
-        } else if (lfo2Target == LFO2Target::DelayWetDry) {
-            baseDelayWetDry = juce::jlimit(0.0f, 1.0f, baseDelayWetDry + lfo2Mod * 0.3f);
-        }
-        
-        float lfo1Mod = lfo1Value * currentLFO1Amount;
-        
-        // Apply LFO1 modulation
-        LFO1Target lfo1Target = static_cast<LFO1Target>(lfo1TargetIndex);
-        if (lfo1Target == LFO1Target::VCORate) {
-            float modulatedVCORate = baseVCORate * (1.0f + lfo1Mod * 4.0f);
-            dubOscillator_.SetFrequency(juce::jlimit(20.0f, 2000.0f, modulatedVCORate));
-        } else if (lfo1Target == LFO1Target::DelayTime) {
-            float modulatedDelayTime = baseDelayTime * (1.0f + lfo1Mod * 0.5f);
-            dubDelay_.SetDelayTime(juce::jlimit(0.001f, 2.0f, modulatedDelayTime));
-        } else if (lfo1Target == LFO1Target::DelayFeedback) {
-            dubDelay_.SetFeedback(juce::jlimit(0.0f, 0.95f, baseDelayFeedback + lfo1Mod * 0.3f));
-        }
-        
-        dubDelay_.SetWetDry(baseDelayWetDry);
-        
-        float outSample = 0.0f;
-        // Process envelope per-sample
-        float envVal = envelope_.ProcessSample();
-
-        // Only generate oscillator while envelope is active (attack/sustain/decay/release)
-        if (envVal > 0.0f) {
-            outSample = dubOscillator_.ProcessSample() * envVal;
-        }
+    // In realtime the governor may hold us below the chosen tier;
+    // offline there is no deadline, so always render the chosen tier
+    if (! isNonRealtime())
+    {
+        governor_.SetCeiling(static_cast<size_t>(tier));
+        tier = static_cast<QualityTier>(governor_.GetTier());
+    }
+
+    activeQualityTier_.store(static_cast<int>(tier), std::memory_order_relaxed);
+    return SimpleSynth::DSP::GetQualitySettings(tier);
+}
+
+void SimpleSynthProcessor::applyQualitySettings(const SimpleSynth::DSP::QualitySettings& settings)
+{
+    activeQuality_ = settings;
 
-        outputData[i] = outSample;
+    const size_t factor = settings.oversamplingFactor;
+    oversampler_.SetFactor(factor);
+
+    // Retune modules in place so a held note survives the switch
+    const float coreRate = static_cast<float>(hostSampleRate_ * static_cast<double>(factor));
+    const float modulationRate = settings.oversampleVcoOnly ? static_cast<float>(hostSampleRate_) : coreRate;
+
+    dubOscillator_.SetSampleRate(coreRate);
+    tuning_.SetSampleRate(coreRate);
+    lfo1_.SetSampleRate(modulationRate);
+    lfo2_.SetSampleRate(modulationRate);
+    envelope_.SetSampleRate(modulationRate);
+    modulationSampleRate_ = modulationRate;
+    diveGlide_.SetSampleRate(modulationRate);
+    noteGlide_.SetSampleRate(modulationRate);
+    for (auto& controller : controllers_)
+        controller.smoother.SetSampleRate(modulationRate);
+    morphPosition_.SetSampleRate(modulationRate);
+
+    dubOscillator_.SetBandLimited(settings.bandLimitedVco);
+    dubDelay_.SetInterpolation(settings.delayInterpolation);
+
+    // Next sample starts a fresh control period
+    controlCountdown_ = 0;
+}
+
+void SimpleSynthProcessor::timerCallback()
+{
+    publishControllerValues();
+
+    {
+        const juce::ScopedLock lock(tuningLock_);
+        pushPendingTuning();
     }
 
-    // Apply delay effect to the generated audio (delay will produce tails)
-    dubDelay_.Process(outputData, static_cast<size_t>(numSamples));
+    {
+        const juce::ScopedLock lock(modSlotLock_);
+        pushPendingModulationSlots();
+    }
+
+    {
+        const juce::ScopedLock lock(snapshotLock_);
+        pushPendingSnapshots();
+    }
 }
 
-//==============================================================================
-bool SimpleSynthProcessor::hasEditor() const
+bool SimpleSynthProcessor::loadTuningScale(const juce::String& sclText, const juce::String& name)
+{
+    const juce::ScopedLock lock(tuningLock_);
+
+    if (sclText.isEmpty())
+        editTuning_.ResetScale();
+    else if (! editTuning_.LoadScala(sclText.toStdString()))
+        return false;
+
+    scaleText_ = sclText;
+    scaleName_ = sclText.isEmpty() ? juce::String() : name;
+    tuningPending_ = true;
+    pushPendingTuning();
+    return true;
+}
+
+bool SimpleSynthProcessor::loadTuningMapping(const juce::String& kbmText, const juce::String& name)
 {
+    const juce::ScopedLock lock(tuningLock_);
+
+    if (kbmText.isEmpty())
+        editTuning_.ResetKeyboardMapping();
+    else if (! editTuning_.LoadKeyboardMapping(kbmText.toStdString()))
+        return false;
+
+    mappingText_ = kbmText;
+    mappingName_ = kbmText.isEmpty() ? juce::String() : name;
+    tuningPending_ = true;
+    pushPendingTuning();
     return true;
 }
 
-juce::AudioProcessorEditor* SimpleSynthProcessor::createEditor()
+juce::String SimpleSynthProcessor::getTuningName() const
 {
-    return new SimpleSynthEditor(*this);
+    const juce::ScopedLock lock(tuningLock_);
+
+    const auto scale = scaleName_.isNotEmpty() ? scaleName_ : juce::String("12-TET");
+    return mappingName_.isNotEmpty() ? scale + " / " + mappingName_ : scale;
 }
 
-//==============================================================================
-void SimpleSynthProcessor::getStateInformation(juce::MemoryBlock& destData)
+void SimpleSynthProcessor::pushPendingTuning()
 {
-    auto state = parameters_.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    // A full ring (audio not running) keeps it pending; the timer retries
+    if (tuningPending_ && tuningUpdates_.Push(editTuning_))
+        tuningPending_ = false;
 }
 
-void SimpleSynthProcessor::setStateInformation(const void* data, int sizeInBytes)
+void SimpleSynthProcessor::receiveTuning()
 {
-    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
+    // Fixed-size copy out of the ring; only the latest tuning matters
+    bool received = false;
+    while (tuningUpdates_.Pop(tuning_))
+        received = true;
 
-    if (xmlState.get() != nullptr)
-        if (xmlState->hasTagName(parameters_.state.getType()))
-            parameters_.replaceState(juce::ValueTree::fromXml(*xmlState));
+    if (! received)
+        return;
+
+    tuning_.SetSampleRate(static_cast<float>(hostSampleRate_ * static_cast<double>(activeQuality_.oversamplingFactor)));
+
+    // A held key-tracked note moves to its pitch in the new tuning
+    if (blockParams_.keyTrack && trackedNote_ >= 0)
+        retuneToNote(trackedNote_);
+}
+
+void SimpleSynthProcessor::retuneToNote(int midiNote)
+{
+    const float ratio = tuning_.GetFrequency(midiNote) / tuning_.GetReferenceFrequency();
+
+    // Portamento runs from the previous note; the first tracked note jumps
+    if (trackedNote_ < 0)
+        noteGlide_.Reset(ratio);
+    else
+        noteGlide_.SetTarget(ratio);
+
+    trackedNote_ = midiNote;
+    if (! noteGlide_.IsGliding())
+        applyPitch();
+}
+
+void SimpleSynthProcessor::applyPitch()
+{
+    // Immediate pitch change between control ticks; glides and LFO take
+    // over again at the next tick
+    pitchMultiplier_ = diveGlide_.GetValue() * noteGlide_.GetValue();
+    dubOscillator_.SetFrequency(blockParams_.vcoRate * pitchMultiplier_);
+}
+
+void SimpleSynthProcessor::updateLfoTargetSlots()
+{
+    using Destination = ModMatrix::Destination;
+
+    // The LFO target parameters predate the matrix; their choices, in order
+    static constexpr Destination lfo1Targets[] = {
+        Destination::None, Destination::VcoRate, Destination::DelayTime, Destination::DelayFeedback
+    };
+    static constexpr Destination lfo2Targets[] = {
+        Destination::None, Destination::Lfo1Rate, Destination::Lfo1Amount, Destination::DelayWetDry
+    };
+
+    const auto lfo1Choice = juce::jlimit(0, 3, static_cast<int>(loadParameter(ParamIndex::Lfo1Target)));
+    const auto lfo2Choice = juce::jlimit(0, 3, static_cast<int>(loadParameter(ParamIndex::Lfo2Target)));
+
+    // Unchanged slots don't recompile
+    modMatrix_.SetSlot(0, { ModMatrix::Source::Lfo1, lfo1Targets[lfo1Choice], 1.0f });
+    modMatrix_.SetSlot(1, { ModMatrix::Source::Lfo2, lfo2Targets[lfo2Choice], 1.0f });
+}
+
+void SimpleSynthProcessor::setModulationSlot(size_t index, const ModMatrix::Slot& slot)
+{
+    jassert(index < kNumUserModSlots);
+    const juce::ScopedLock lock(modSlotLock_);
+
+    editModSlots_[index] = slot;
+    editModSlots_[index].depth = juce::jlimit(-1.0f, 1.0f, slot.depth);
+    modSlotsPending_ = true;
+    pushPendingModulationSlots();
+}
+
+SimpleSynthProcessor::ModMatrix::Slot SimpleSynthProcessor::getModulationSlot(size_t index) const
+{
+    jassert(index < kNumUserModSlots);
+    const juce::ScopedLock lock(modSlotLock_);
+    return editModSlots_[index];
+}
+
+void SimpleSynthProcessor::pushPendingModulationSlots()
+{
+    // A full ring (audio not running) keeps them pending; the timer retries
+    if (modSlotsPending_ && modSlotUpdates_.Push(editModSlots_))
+        modSlotsPending_ = false;
+}
+
+void SimpleSynthProcessor::receiveModulationSlots()
+{
+    // Only the latest set matters; SetSlot() recompiles in place
+    ModSlots slots;
+    bool received = false;
+    while (modSlotUpdates_.Pop(slots))
+        received = true;
+
+    if (received)
+        for (size_t i = 0; i < kNumUserModSlots; ++i)
+            modMatrix_.SetSlot(i + 2, slots[i]);
+}
+
+void SimpleSynthProcessor::captureSnapshot(size_t slot)
+{
+    jassert(slot < kNumSnapshots);
+    const juce::ScopedLock lock(snapshotLock_);
+
+    // The parameters' own values (knobs, automation)
+    auto& snapshot = editSnapshots_.slots[slot];
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+        snapshot.values[i] = rawParams_[i]->load();
+    snapshot.captured = true;
+
+    snapshotsPending_ = true;
+    pushPendingSnapshots();
+}
+
+void SimpleSynthProcessor::clearSnapshot(size_t slot)
+{
+    jassert(slot < kNumSnapshots);
+    const juce::ScopedLock lock(snapshotLock_);
+
+    editSnapshots_.slots[slot] = {};
+    snapshotsPending_ = true;
+    pushPendingSnapshots();
+}
+
+bool SimpleSynthProcessor::hasSnapshot(size_t slot) const
+{
+    jassert(slot < kNumSnapshots);
+    const juce::ScopedLock lock(snapshotLock_);
+    return editSnapshots_.slots[slot].captured;
+}
+
+bool SimpleSynthProcessor::getSnapshotValues(size_t slot, std::array<float, SimpleSynth::Control::kNumParameters>& values) const
+{
+    // Real values by ParamIndex, as captured; false for an empty slot
+    jassert(slot < kNumSnapshots);
+    const juce::ScopedLock lock(snapshotLock_);
+
+    const auto& snapshot = editSnapshots_.slots[slot];
+    if (! snapshot.captured)
+        return false;
+
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+        values[i] = snapshot.values[i];
+    return true;
+}
+
+void SimpleSynthProcessor::pushPendingSnapshots()
+{
+    // A full ring (audio not running) keeps the bank pending; the timer retries
+    if (snapshotsPending_ && snapshotUpdates_.Push(editSnapshots_))
+        snapshotsPending_ = false;
+}
+
+void SimpleSynthProcessor::receiveSnapshots()
+{
+    // Fixed-size copy out of the ring; only the latest bank matters
+    while (snapshotUpdates_.Pop(snapshots_))
+        snapshotsChanged_ = true;
+}
+
+void SimpleSynthProcessor::updateMorph()
+{
+    const int slotA = static_cast<int>(loadParameter(ParamIndex::MorphA));
+    const int slotB = static_cast<int>(loadParameter(ParamIndex::MorphB));
+
+    // Endpoints recompile only when the scene selection or bank changes
+    if (slotA != morphSlotA_ || slotB != morphSlotB_ || snapshotsChanged_)
+    {
+        morphSlotA_ = slotA;
+        morphSlotB_ = slotB;
+        snapshotsChanged_ = false;
+
+        const bool ready = slotA > 0 && slotB > 0
+                        && snapshots_.slots[static_cast<size_t>(slotA - 1)].captured
+                        && snapshots_.slots[static_cast<size_t>(slotB - 1)].captured;
+        if (ready)
+        {
+            const bool wasActive = snapshotMorph_.IsActive();
+            snapshotMorph_.SetEndpoints(snapshots_.slots[static_cast<size_t>(slotA - 1)],
+                                        snapshots_.slots[static_cast<size_t>(slotB - 1)]);
+
+            // A fresh morph starts where the Morph knob is
+            if (! wasActive)
+                morphPosition_.Reset(blockParams_.morph);
+        }
+        else
+        {
+            snapshotMorph_.Clear();
+        }
+    }
+
+    if (! snapshotMorph_.IsActive())
+        return;
+
+    snapshotMorph_.Blend(morphPosition_.GetValue());
+    for (size_t i = 0; i < snapshotMorph_.GetNumMorphable(); ++i)
+    {
+        const auto index = snapshotMorph_.GetMorphable(i);
+        setBlockParameter(index, snapshotMorph_.GetValue(static_cast<size_t>(index)));
+    }
+}
+
+void SimpleSynthProcessor::advanceMorph(size_t numSamples)
+{
+    snapshotMorph_.Blend(morphPosition_.Advance(numSamples));
+
+    // Only parameters the two scenes disagree on move; controllers and
+    // held gestures keep theirs
+    for (size_t i = 0; i < snapshotMorph_.GetNumMoving(); ++i)
+    {
+        const auto index = snapshotMorph_.GetMoving(i);
+        const auto p = static_cast<size_t>(index);
+        if (overrideActive_[p] || controllers_[p].active)
+            continue;
+
+        setBlockParameter(index, snapshotMorph_.GetValue(p));
+        applyParameter(index);
+    }
+}
+
+void SimpleSynthProcessor::publishControllerValues()
+{
+    // Controller moves reach the host (automation, knobs) from here;
+    // setValueNotifyingHost isn't safe on the audio thread
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+    {
+        auto& controller = controllers_[i];
+        const float normalised = controller.pendingNormalised.exchange(-1.0f, std::memory_order_relaxed);
+        if (normalised < 0.0f)
+            continue;
+
+        // Recorded first, so the audio thread recognises the echo
+        controller.publishedValue.store(parameterRanges_[i].convertFrom0to1(normalised), std::memory_order_relaxed);
+
+        if (auto* parameter = parameters_.getParameter(SimpleSynth::Control::kParameterInfo[i].id))
+            parameter->setValueNotifyingHost(normalised);
+    }
+}
+
+void SimpleSynthProcessor::handleMidiEvent(const juce::MidiMessage& msg)
+{
+    if (msg.isNoteOn()) {
+        // Keys the tuning leaves unmapped are silent when key tracking
+        if (blockParams_.keyTrack && ! tuning_.IsMapped(msg.getNoteNumber()))
+            return;
+
+        currentMidiNote_ = msg.getNoteNumber();
+        isNoteOn_ = true;
+        currentNoteVelocity_ = msg.getFloatVelocity();
+        // Key tracking transposes VCO Rate by the note's distance from the
+        // tuning's reference note
+        if (blockParams_.keyTrack)
+            retuneToNote(currentMidiNote_);
+        // scale base level by velocity (final amplitude will be multiplied by envelope)
+        dubOscillator_.SetLevel(blockParams_.vcoLevel * currentNoteVelocity_);
+        // trigger envelope
+        envelope_.NoteOn();
+    }
+    else if (msg.isNoteOff() || (msg.isNoteOn() && msg.getVelocity() == 0)) {
+        int note = msg.getNoteNumber();
+        if (note == currentMidiNote_) {
+            isNoteOn_ = false; // note state
+            currentMidiNote_ = -1;
+            // release envelope (allow smooth release tail)
+            releaseGateIfIdle();
+        }
+    }
+    else if (msg.isController()) {
+        if (msg.getControllerNumber() == 1)
+            modWheel_ = static_cast<float>(msg.getControllerValue()) / 127.0f;
+
+        handleControllerEvent(static_cast<size_t>(msg.getControllerNumber()),
+                              static_cast<float>(msg.getControllerValue()) / 127.0f);
+    }
+    else if (msg.isPitchWheel()) {
+        handleControllerEvent(SimpleSynth::Control::MidiMapping::kPitchBendSource,
+                              static_cast<float>(msg.getPitchWheelValue()) / 16383.0f);
+    }
+    else if (msg.isChannelPressure()) {
+        handleControllerEvent(SimpleSynth::Control::MidiMapping::kChannelPressureSource,
+                              static_cast<float>(msg.getChannelPressureValue()) / 127.0f);
+    }
+    else if (msg.isAftertouch()) {
+        // Mono synth: polyphonic aftertouch acts as channel pressure
+        handleControllerEvent(SimpleSynth::Control::MidiMapping::kChannelPressureSource,
+                              static_cast<float>(msg.getAfterTouchValue()) / 127.0f);
+    }
+}
+
+void SimpleSynthProcessor::handleControllerEvent(size_t source, float normalisedValue)
+{
+    // A pending MIDI learn takes the first controller that moves
+    midiMapping_.Learn(source);
+
+    // Only moves targets; the glide itself runs at control rate
+    midiMapping_.ForEachDestination(source, [this, normalisedValue](ParamIndex index) {
+        const auto i = static_cast<size_t>(index);
+        auto& controller = controllers_[i];
+
+        if (! controller.active)
+        {
+            // Glide from wherever the parameter is now
+            controller.smoother.Reset(getBlockParameter(index));
+            controller.lastRawValue = blockParameterValues_[i];
+            controller.active = true;
+        }
+
+        controller.smoother.SetTarget(parameterRanges_[i].convertFrom0to1(normalisedValue));
+        controller.pendingNormalised.store(normalisedValue, std::memory_order_relaxed);
+        smoothingMask_ |= 1u << i;
+    });
+}
+
+void SimpleSynthProcessor::advanceControllerSmoothing(size_t numSamples)
+{
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+    {
+        if ((smoothingMask_ & (1u << i)) == 0)
+            continue;
+
+        auto& smoother = controllers_[i].smoother;
+        const float value = smoother.Advance(numSamples);
+        if (! smoother.IsSmoothing())
+            smoothingMask_ &= ~(1u << i);
+
+        // Held gestures still win
+        if (overrideActive_[i])
+            continue;
+
+        const auto index = SimpleSynth::Control::ToParamIndex(i);
+        setBlockParameter(index, value);
+        applyParameter(index);
+    }
+}
+
+bool SimpleSynthProcessor::pushControlEvent(ControlEvent event)
+{
+    event.timestampTicks = juce::Time::getHighResolutionTicks();
+    return controlEvents_.Push(event);
+}
+
+int SimpleSynthProcessor::drainControlEvents(int numSamples, juce::int64 blockStartTicks)
+{
+    // Events stamped during the previous block land at the same offset in
+    // this one: a block of latency buys jitter-free spacing. Offline, or
+    // before the first block, there is no timeline to map onto.
+    const bool mapTimestamps = ! isNonRealtime() && previousBlockStartTicks_ != 0;
+    const double samplesPerTick = hostSampleRate_ / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+    const int lastSample = juce::jmax(0, numSamples - 1);
+
+    int numEvents = 0;
+    ControlEvent event;
+
+    while (numEvents < static_cast<int>(pendingControlEvents_.size()) && controlEvents_.Pop(event))
+    {
+        int position = 0;
+        if (mapTimestamps)
+        {
+            const double offset = static_cast<double>(event.timestampTicks - previousBlockStartTicks_) * samplesPerTick;
+            position = static_cast<int>(juce::jlimit(0.0, static_cast<double>(lastSample), offset));
+        }
+
+        // Queue order wins if the clock disagrees
+        if (numEvents > 0)
+            position = juce::jmax(position, pendingControlEvents_[static_cast<size_t>(numEvents - 1)].samplePosition);
+
+        pendingControlEvents_[static_cast<size_t>(numEvents)] = { event, position };
+        ++numEvents;
+    }
+
+    previousBlockStartTicks_ = blockStartTicks;
+    return numEvents;
+}
+
+void SimpleSynthProcessor::handleControlEvent(const ControlEvent& event)
+{
+    switch (event.type)
+    {
+        case ControlEvent::Type::TriggerOn:
+            triggerDown_ = true;
+            currentNoteVelocity_ = juce::jlimit(0.0f, 1.0f, event.value);
+            dubOscillator_.SetLevel(blockParams_.vcoLevel * currentNoteVelocity_);
+            envelope_.NoteOn();
+            break;
+
+        case ControlEvent::Type::TriggerOff:
+            triggerDown_ = false;
+            releaseGateIfIdle();
+            break;
+
+        case ControlEvent::Type::HoldOn:
+            holdOn_ = true;
+            break;
+
+        case ControlEvent::Type::HoldOff:
+            holdOn_ = false;
+            releaseGateIfIdle();
+            break;
+
+        case ControlEvent::Type::PitchDive:
+            // Stepped by applyModulation() at control rate
+            diveGlide_.SetTime(juce::jmax(0.0f, event.duration));
+            diveGlide_.SetTarget(std::exp2(event.value));
+            if (! diveGlide_.IsGliding())
+                applyPitch();
+            break;
+
+        case ControlEvent::Type::SetParameter:
+        case ControlEvent::Type::ReleaseParameter:
+        {
+            const auto index = static_cast<size_t>(event.parameter);
+            if (index >= SimpleSynth::Control::kNumParameters || ! SimpleSynth::Control::kParameterInfo[index].continuous)
+                break;
+
+            overrideActive_[index] = (event.type == ControlEvent::Type::SetParameter);
+            parameterOverrides_[index] = parameterRanges_[index].snapToLegalValue(event.value);
+
+            // Released: back to the controller's value, else the parameter's own
+            const float released = controllers_[index].active ? controllers_[index].smoother.GetValue()
+                                                              : loadParameter(event.parameter);
+            setBlockParameter(event.parameter, overrideActive_[index] ? parameterOverrides_[index] : released);
+            applyParameter(event.parameter);
+            break;
+        }
+    }
+}
+
+void SimpleSynthProcessor::releaseGateIfIdle()
+{
+    // Release only once no note, trigger or hold keeps the gate open
+    if (! isNoteOn_ && ! triggerDown_ && ! holdOn_)
+        envelope_.NoteOff();
+}
+
+void SimpleSynthProcessor::tickModulation(float envelopeLevel)
+{
+    // Modulation runs once per control interval (1 = every sample)
+    if (controlCountdown_ == 0)
+    {
+        applyModulation(activeQuality_.controlInterval, envelopeLevel);
+        controlCountdown_ = activeQuality_.controlInterval;
+    }
+    --controlCountdown_;
+    ++modulationPosition_;
+}
+
+void SimpleSynthProcessor::applyModulation(size_t numSamples, float envelopeLevel)
+{
+    using Source = ModMatrix::Source;
+    using Destination = ModMatrix::Destination;
+
+    // Controller glides step once per control tick; dense CC streams only move targets
+    if (smoothingMask_ != 0)
+        advanceControllerSmoothing(numSamples);
+
+    // Scene morphs blend once per tick, and only while the position moves
+    if (snapshotMorph_.IsActive() && morphPosition_.IsSmoothing())
+        advanceMorph(numSamples);
+
+    // Pitch dive and portamento glide in the log domain so sweeps sound
+    // even across the range (a multiply per tick, no exp2)
+    const bool gliding = diveGlide_.IsGliding() || noteGlide_.IsGliding();
+    if (gliding)
+        pitchMultiplier_ = diveGlide_.Advance(numSamples) * noteGlide_.Advance(numSamples);
+
+    // Step LFOs across the whole control interval
+    const float lfo2Value = lfo2_.Advance(numSamples);
+    const float lfo1Value = lfo1_.Advance(numSamples);
+
+    if (! modMatrix_.HasRoutes())
+    {
+        if (gliding)
+            dubOscillator_.SetFrequency(juce::jlimit(20.0f, 2000.0f, blockParams_.vcoRate * pitchMultiplier_));
+        updateFilterTarget(0.0f, 0.0f);
+        return;
+    }
+
+    // Sources are a load each; noise only advances when something reads it
+    auto& sources = modSources_;
+    sources[ModMatrix::SourceIndex(Source::Lfo1)] = lfo1Value * blockParams_.lfo1Amount;
+    sources[ModMatrix::SourceIndex(Source::Lfo2)] = lfo2Value * blockParams_.lfo2Amount;
+    sources[ModMatrix::SourceIndex(Source::Envelope)] = envelopeLevel;
+    sources[ModMatrix::SourceIndex(Source::Velocity)] = currentNoteVelocity_;
+    sources[ModMatrix::SourceIndex(Source::ModWheel)] = modWheel_;
+    if (modMatrix_.UsesSource(Source::Noise))
+        sources[ModMatrix::SourceIndex(Source::Noise)] = modulationNoise_.NextBipolar();
+
+    auto& outputs = modOutputs_;
+    modMatrix_.Process(sources.data(), outputs.data());
+
+    auto output = [&outputs](Destination destination) { return outputs[ModMatrix::DestinationIndex(destination)]; };
+
+    // Modulated LFO amounts scale their LFO's routes in this same tick:
+    // a second pass with the rescaled LFO sources (one level deep, so an
+    // LFO modulating its own amount sees the base amount)
+    const float lfo1Amount = ModMatrix::Apply(Destination::Lfo1Amount, blockParams_.lfo1Amount, output(Destination::Lfo1Amount));
+    const float lfo2Amount = ModMatrix::Apply(Destination::Lfo2Amount, blockParams_.lfo2Amount, output(Destination::Lfo2Amount));
+    if (lfo1Amount != blockParams_.lfo1Amount || lfo2Amount != blockParams_.lfo2Amount)
+    {
+        sources[ModMatrix::SourceIndex(Source::Lfo1)] = lfo1Value * lfo1Amount;
+        sources[ModMatrix::SourceIndex(Source::Lfo2)] = lfo2Value * lfo2Amount;
+        modMatrix_.Process(sources.data(), outputs.data());
+    }
+
+    // Unrouted destinations keep their block values (set every block)
+    bool vcoRateRouted = false;
+    bool delayRouted = false;
+
+    for (size_t i = 0; i < modMatrix_.GetNumActiveDestinations(); ++i)
+    {
+        const auto destination = modMatrix_.GetActiveDestination(i);
+        const float modulation = output(destination);
+
+        switch (destination)
+        {
+            case Destination::VcoRate:
+                // Range applies to the glided pitch, as the VCO Rate knob's
+                dubOscillator_.SetFrequency(ModMatrix::Apply(destination, blockParams_.vcoRate * pitchMultiplier_, modulation));
+                vcoRateRouted = true;
+                break;
+
+            case Destination::VcoLevel:
+                dubOscillator_.SetLevel(ModMatrix::Apply(destination, blockParams_.vcoLevel, modulation));
+                break;
+
+            case Destination::DelayTime:
+            case Destination::DelayFeedback:
+                delayRouted = true;
+                break;
+
+            case Destination::DelayWetDry:
+                dubDelay_.SetWetDry(ModMatrix::Apply(destination, blockParams_.delayWetDry, modulation));
+                break;
+
+            case Destination::Lfo1Rate:
+                lfo1_.SetRate(ModMatrix::Apply(destination, blockParams_.lfo1Rate, modulation));
+                break;
+
+            case Destination::Lfo2Rate:
+                lfo2_.SetRate(ModMatrix::Apply(destination, blockParams_.lfo2Rate, modulation));
+                break;
+
+            // Set together below
+            case Destination::FilterCutoff:
+            case Destination::FilterResonance:
+                break;
+
+            // Already folded into the LFO sources above
+            case Destination::Lfo1Amount:
+            case Destination::Lfo2Amount:
+            case Destination::None:
+            case Destination::Count:
+                break;
+        }
+    }
+
+    if (! vcoRateRouted && gliding)
+        dubOscillator_.SetFrequency(juce::jlimit(20.0f, 2000.0f, blockParams_.vcoRate * pitchMultiplier_));
+
+    // Head layout depends on both, so they update together
+    if (delayRouted)
+        updateDelayHeads(ModMatrix::Apply(Destination::DelayTime, blockParams_.delayTime, output(Destination::DelayTime)),
+                         ModMatrix::Apply(Destination::DelayFeedback, blockParams_.delayFeedback, output(Destination::DelayFeedback)));
+
+    // Unrouted outputs read zero, leaving the knob values
+    updateFilterTarget(output(Destination::FilterCutoff), output(Destination::FilterResonance));
+}
+
+void SimpleSynthProcessor::updateFilterTarget(float cutoffModulation, float resonanceModulation)
+{
+    using Destination = ModMatrix::Destination;
+
+    if (blockParams_.filterMode == SimpleSynth::DSP::ResonantFilter::Mode::Off)
+        return;
+
+    // The filter runs on the host-rate segment after renderSiren(); this
+    // tick's values are reached by the end of its control interval, so
+    // the coefficients ramp across it (unchanged values cost nothing)
+    const size_t decimation = activeQuality_.oversampleVcoOnly ? 1 : activeQuality_.oversamplingFactor;
+    const size_t offset = (modulationPosition_ + activeQuality_.controlInterval) / decimation;
+
+    filter_.SetTarget(ModMatrix::Apply(Destination::FilterCutoff, blockParams_.filterCutoff, cutoffModulation),
+                      ModMatrix::Apply(Destination::FilterResonance, blockParams_.filterResonance, resonanceModulation),
+                      offset);
+}
+
+void SimpleSynthProcessor::renderEnvelope(int numSamples)
+{
+    DUBSIREN_TRACE_SCOPE("Envelope");
+
+    // The envelope doesn't depend on modulation, so it runs as its own pass
+    for (int i = 0; i < numSamples; ++i)
+        envelopeBuffer_[static_cast<size_t>(i)] = envelope_.ProcessSample();
+}
+
+void SimpleSynthProcessor::renderSiren(float* output, int numSamples)
+{
+    jassert(numSamples <= static_cast<int>(SimpleSynth::DSP::kMaxBlockSize));
+
+    const int factor = static_cast<int>(oversampler_.GetFactor());
+    const float* envelope = envelopeBuffer_.data();
+    float* oversampled = oversampler_.GetBuffer();
+    modulationPosition_ = 0;
+
+    // Control-rate modulation ticks are interleaved with the VCO (they
+    // retune it mid-segment), so the oscillator span includes them. Every
+    // factor, 1x included, goes through the oversampler, which delays
+    // each to the same latency.
+    if (activeQuality_.oversampleVcoOnly)
+    {
+        // Modulation and envelope at host rate, only the VCO at the high
+        // rate; the envelope is applied before decimation so it is
+        // delayed with the VCO
+        renderEnvelope(numSamples);
+
+        DUBSIREN_TRACE_SCOPE("Oscillator");
+        for (int i = 0; i < numSamples; ++i)
+        {
+            tickModulation(envelope[i]);
+
+            const float envVal = envelope[i];
+            float* vcoFrame = oversampled + i * factor;
+            for (int k = 0; k < factor; ++k)
+                vcoFrame[k] = (envVal > 0.0f) ? dubOscillator_.ProcessSample() * envVal : 0.0f;
+        }
+    }
+    else
+    {
+        // Whole core (modulation, envelope, VCO) at the core rate
+        const int numOversampled = numSamples * factor;
+        renderEnvelope(numOversampled);
+
+        DUBSIREN_TRACE_SCOPE("Oscillator");
+        for (int i = 0; i < numOversampled; ++i)
+        {
+            tickModulation(envelope[i]);
+
+            // Only generate oscillator while envelope is active (attack/sustain/decay/release)
+            const float envVal = envelope[i];
+            oversampled[i] = (envVal > 0.0f) ? dubOscillator_.ProcessSample() * envVal : 0.0f;
+        }
+    }
+
+    DUBSIREN_TRACE_SCOPE("Oversampler");
+    oversampler_.Downsample(output, static_cast<size_t>(numSamples));
+}
+
+void SimpleSynthProcessor::processBlock(juce::AudioBuffer<float>& buffer,
+                                        juce::MidiBuffer& midiMessages)
+{
+    DUBSIREN_REALTIME_SECTION();
+    DUBSIREN_TRACE_SCOPE("processBlock");
+    juce::ScopedNoDenormals noDenormals;
+    const auto blockStartTicks = juce::Time::getHighResolutionTicks();
+
+    // Clear output
+    buffer.clear();
+
+    const int numSamples = buffer.getNumSamples();
+    float* outputData = buffer.getWritePointer(0);
+
+    // A state load lands here whole (before anything reads a parameter);
+    // tunings, routes and scenes it pushed are already in their rings
+    receiveStateSnapshot();
+
+    // Update static DSP params (LFOs/Delay) before sample loop
+    const auto qualityChoice = readQualityChoice();
+    {
+        DUBSIREN_TRACE_SCOPE("Parameters");
+        receiveTuning();
+        receiveModulationSlots();
+        receiveSnapshots();
+        updateDSPFromParameters();
+
+        // Tier switches (including the host toggling offline rendering) only
+        // retune preallocated modules, nothing here allocates
+        const auto requestedQuality = resolveQualitySettings(qualityChoice);
+        if (requestedQuality != activeQuality_)
+            applyQualitySettings(requestedQuality);
+    }
+
+    // Editor gestures queued since the last block, placed on this block's timeline
+    const int numControlEvents = drainControlEvents(numSamples, blockStartTicks);
+    int controlIndex = 0;
+
+    // Render in segments between MIDI and control events so note on/off stay
+    // sample-accurate and the synth only produces audio while a note is held.
+    const int maxSegment = static_cast<int>(SimpleSynth::DSP::kMaxBlockSize);
+    auto midiIterator = midiMessages.cbegin();
+    int position = 0;
+
+    auto midiDue = [&] { return midiIterator != midiMessages.cend() && (*midiIterator).samplePosition <= position; };
+    auto controlDue = [&] { return controlIndex < numControlEvents
+                                   && pendingControlEvents_[static_cast<size_t>(controlIndex)].samplePosition <= position; };
+
+    while (position < numSamples)
+    {
+        // process all events that occur at this sample, host MIDI first
+        if (midiDue() || controlDue())
+        {
+            DUBSIREN_TRACE_SCOPE("Events");
+            for (; midiDue(); ++midiIterator)
+                handleMidiEvent((*midiIterator).getMessage());
+
+            for (; controlDue(); ++controlIndex)
+                handleControlEvent(pendingControlEvents_[static_cast<size_t>(controlIndex)].event);
+        }
+
+        int segmentEnd = numSamples;
+        if (midiIterator != midiMessages.cend())
+            segmentEnd = juce::jmin(segmentEnd, (*midiIterator).samplePosition);
+        if (controlIndex < numControlEvents)
+            segmentEnd = juce::jmin(segmentEnd, pendingControlEvents_[static_cast<size_t>(controlIndex)].samplePosition);
+
+        const int segmentLength = juce::jmin(segmentEnd - position, maxSegment);
+        renderSiren(outputData + position, segmentLength);
+
+        {
+            DUBSIREN_TRACE_SCOPE("Filter");
+            filter_.Process(outputData + position, static_cast<size_t>(segmentLength));
+        }
+        position += segmentLength;
+    }
+
+    // An empty block still applies its gestures
+    for (; controlIndex < numControlEvents; ++controlIndex)
+        handleControlEvent(pendingControlEvents_[static_cast<size_t>(controlIndex)].event);
+
+    // Apply delay effect to the generated audio (delay will produce tails)
+    {
+        DUBSIREN_TRACE_SCOPE("Delay");
+        dubDelay_.Process(outputData, static_cast<size_t>(numSamples));
+    }
+
+    {
+        DUBSIREN_TRACE_SCOPE("Spring");
+        spring_.Process(outputData, static_cast<size_t>(numSamples));
+    }
+
+    {
+        DUBSIREN_TRACE_SCOPE("Reverb");
+        reverb_.Process(outputData, static_cast<size_t>(numSamples));
+    }
+
+    // Scope and spectrum feed; one flag check while the editor is closed
+    analysisTap_.Process(outputData, static_cast<size_t>(numSamples));
+
+    // Record mode: a copy into the recorder's ring, the file is written elsewhere
+    recorder_.process(outputData, numSamples);
+
+    if (numSamples == 0)
+        return;
+
+    // This block's share of its deadline feeds the governor and the editor
+    const auto elapsedSeconds = juce::Time::highResolutionTicksToSeconds(
+        juce::Time::getHighResolutionTicks() - blockStartTicks);
+    const double deadlineSeconds = numSamples / hostSampleRate_;
+    const auto loadFraction = static_cast<float>(elapsedSeconds / deadlineSeconds);
+
+    if (! isNonRealtime() && qualityChoice != QualityChoice::Custom)
+        governor_.Update(loadFraction);
+
+    if constexpr (SimpleSynth::Perf::BlockTelemetry::kEnabled)
+    {
+        SimpleSynth::Perf::BlockStats stats;
+        stats.durationMicroseconds = static_cast<float>(elapsedSeconds * 1.0e6);
+        stats.numSamples = static_cast<uint32_t>(numSamples);
+        stats.loadFraction = loadFraction;
+        stats.activeVoices = envelope_.IsActive() ? 1u : 0u;
+        telemetry_.Push(stats);
+    }
+}
+
+//==============================================================================
+bool SimpleSynthProcessor::hasEditor() const
+{
+    return true;
+}
+
+juce::AudioProcessorEditor* SimpleSynthProcessor::createEditor()
+{
+    return new SimpleSynthEditor(*this);
+}
+
+//==============================================================================
+void SimpleSynthProcessor::getStateInformation(juce::MemoryBlock& destData)
+{
+    namespace StateFormat = SimpleSynth::Control::StateFormat;
+    using Section = StateFormat::Section;
+
+    // Binary state (Control/StateFormat.h): hashed parameter ids and raw
+    // floats instead of an XML document per instance
+    std::vector<uint8_t> blob;
+    blob.reserve(1024);
+    StateFormat::Writer writer(blob);
+    writer.WriteHeader(5);
+
+    std::array<float, SimpleSynth::Control::kNumParameters> values;
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = rawParams_[i]->load();
+
+    auto section = writer.BeginSection(Section::Parameters);
+    writer.WriteParameterTable(values.data());
+    writer.EndSection(section);
+
+    auto writeTree = [&writer](Section tag, const juce::ValueTree& tree) {
+        juce::MemoryOutputStream stream;
+        tree.writeToStream(stream);
+        const auto treeSection = writer.BeginSection(tag);
+        writer.WriteBytes(stream.getData(), stream.getDataSize());
+        writer.EndSection(treeSection);
+    };
+
+    writeTree(Section::MidiMappings, saveMidiMappings());
+    writeTree(Section::Tuning, saveTuning());
+    writeTree(Section::ModMatrix, saveModulationSlots());
+
+    {
+        const juce::ScopedLock lock(snapshotLock_);
+
+        uint32_t numCaptured = 0;
+        for (const auto& snapshot : editSnapshots_.slots)
+            numCaptured += snapshot.captured ? 1u : 0u;
+
+        section = writer.BeginSection(Section::Snapshots);
+        writer.WriteU32(numCaptured);
+        for (size_t slot = 0; slot < kNumSnapshots; ++slot)
+        {
+            if (! editSnapshots_.slots[slot].captured)
+                continue;
+
+            writer.WriteU8(static_cast<uint8_t>(slot));
+            writer.WriteParameterTable(editSnapshots_.slots[slot].values.data());
+        }
+        writer.EndSection(section);
+    }
+
+    destData.replaceAll(blob.data(), blob.size());
+}
+
+void SimpleSynthProcessor::setStateInformation(const void* data, int sizeInBytes)
+{
+    DUBSIREN_TRACE_SCOPE("setStateInformation");
+
+    // Sessions saved before the binary format hold XML
+    if (SimpleSynth::Control::StateFormat::IsBinaryState(data, static_cast<size_t>(juce::jmax(0, sizeInBytes))))
+        loadBinaryState(data, sizeInBytes);
+    else
+        loadXmlState(data, sizeInBytes);
+}
+
+void SimpleSynthProcessor::loadBinaryState(const void* data, int sizeInBytes)
+{
+    namespace StateFormat = SimpleSynth::Control::StateFormat;
+    using Section = StateFormat::Section;
+    constexpr size_t numParameters = SimpleSynth::Control::kNumParameters;
+
+    StateFormat::Reader reader(data, static_cast<size_t>(sizeInBytes));
+    const int numSections = reader.ReadHeader();
+    if (numSections < 0)
+        return;     // From a newer, incompatible build: keep the current state
+
+    // Everything is parsed before anything is applied, so a damaged blob
+    // changes nothing. Parameters or sections it lacks take their
+    // defaults, as in XML state.
+    std::array<float, numParameters> values {};
+    std::array<bool, numParameters> found {};
+    juce::ValueTree mappings, tuning, modulation;
+    SimpleSynth::Control::SnapshotBank bank;
+
+    for (int n = 0; n < numSections; ++n)
+    {
+        Section tag = Section::Parameters;
+        StateFormat::Reader payload(nullptr, 0);
+        if (! reader.NextSection(tag, payload))
+            return;
+
+        switch (tag)
+        {
+            case Section::Parameters:
+                if (! payload.ReadParameterTable(values.data(), found.data()))
+                    return;
+                break;
+
+            case Section::MidiMappings:
+                mappings = juce::ValueTree::readFromData(payload.GetData(), payload.Remaining());
+                break;
+
+            case Section::Tuning:
+                tuning = juce::ValueTree::readFromData(payload.GetData(), payload.Remaining());
+                break;
+
+            case Section::ModMatrix:
+                modulation = juce::ValueTree::readFromData(payload.GetData(), payload.Remaining());
+                break;
+
+            case Section::Snapshots:
+            {
+                const uint32_t numSnapshots = payload.ReadU32();
+                for (uint32_t s = 0; s < numSnapshots && payload.IsValid(); ++s)
+                {
+                    const size_t slot = payload.ReadU8();
+                    SimpleSynth::Control::Snapshot snapshot;
+                    std::array<bool, numParameters> stored {};
+                    for (size_t i = 0; i < numParameters; ++i)
+                        snapshot.values[i] = getDefaultParameterValue(i);
+
+                    if (! payload.ReadParameterTable(snapshot.values.data(), stored.data()))
+                        return;
+
+                    snapshot.captured = true;
+                    if (slot < kNumSnapshots)
+                        bank.slots[slot] = snapshot;
+                }
+                break;
+            }
+
+            default:
+                break;      // Newer section this build doesn't know
+        }
+    }
+
+    for (size_t i = 0; i < numParameters; ++i)
+        if (! found[i])
+            values[i] = getDefaultParameterValue(i);
+
+    const juce::ScopedLock lock(stateLock_);
+
+    loadMidiMappings(mappings);
+    loadTuning(tuning);
+    loadModulationSlots(modulation);
+    setSnapshotBank(bank);
+    applyStateParameters(values);
+}
+
+void SimpleSynthProcessor::loadXmlState(const void* data, int sizeInBytes)
+{
+    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
+
+    if (xmlState.get() != nullptr)
+        if (xmlState->hasTagName(parameters_.state.getType()))
+        {
+            auto state = juce::ValueTree::fromXml(*xmlState);
+            const auto mappings = state.getChildWithName("MIDI_MAPPINGS");
+            loadMidiMappings(mappings);
+            state.removeChild(mappings, nullptr);
+
+            const auto tuning = state.getChildWithName("TUNING");
+            loadTuning(tuning);
+            state.removeChild(tuning, nullptr);
+
+            const auto modulation = state.getChildWithName("MOD_MATRIX");
+            loadModulationSlots(modulation);
+            state.removeChild(modulation, nullptr);
+
+            const auto snapshots = state.getChildWithName("SNAPSHOTS");
+            loadSnapshots(snapshots);
+            state.removeChild(snapshots, nullptr);
+
+            // A parameter the state lacks takes its default, as in binary
+            // state. replaceState() would keep its current value, so the
+            // default is written into the tree too.
+            std::array<float, SimpleSynth::Control::kNumParameters> values {};
+            for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+            {
+                const auto* id = SimpleSynth::Control::kParameterInfo[i].id;
+                auto param = state.getChildWithProperty("id", id);
+
+                if (param.hasProperty("value"))
+                {
+                    values[i] = parameterRanges_[i].convertFrom0to1(parameterObjects_[i]->convertTo0to1(param.getProperty("value")));
+                    continue;
+                }
+
+                values[i] = getDefaultParameterValue(i);
+                if (! param.isValid())
+                {
+                    param = juce::ValueTree("PARAM");
+                    param.setProperty("id", id, nullptr);
+                    state.appendChild(param, nullptr);
+                }
+                param.setProperty("value", values[i], nullptr);
+            }
+
+            const juce::ScopedLock lock(stateLock_);
+            const auto generation = publishStateSnapshot(values);
+            parameters_.replaceState(state);
+            stateLoadsApplied_.store(generation, std::memory_order_release);
+        }
+}
+
+void SimpleSynthProcessor::applyStateParameters(std::array<float, SimpleSynth::Control::kNumParameters> values)
+{
+    // Snapped to what the parameters will hold, so moving from the
+    // snapshot back to the parameters is seamless. Caller holds stateLock_.
+    std::array<float, SimpleSynth::Control::kNumParameters> normalised {};
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+    {
+        normalised[i] = parameterObjects_[i]->convertTo0to1(values[i]);
+        values[i] = parameterRanges_[i].convertFrom0to1(normalised[i]);
+    }
+
+    const auto generation = publishStateSnapshot(values);
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+        parameterObjects_[i]->setValueNotifyingHost(normalised[i]);
+    stateLoadsApplied_.store(generation, std::memory_order_release);
+}
+
+uint32_t SimpleSynthProcessor::publishStateSnapshot(const std::array<float, SimpleSynth::Control::kNumParameters>& values)
+{
+    // Filled in a preallocated slot and published with one pointer swap;
+    // slots the audio thread has moved past are reclaimed here
+    auto* state = stateSnapshots_.BeginWrite();
+    jassert(state != nullptr); // Only if a load left a slot unpublished
+    if (state == nullptr)
+        return stateGeneration_;
+
+    state->values = values;
+    state->generation = ++stateGeneration_;
+    stateSnapshots_.Publish(state);
+    return stateGeneration_;
+}
+
+void SimpleSynthProcessor::receiveStateSnapshot()
+{
+    // Read the loaded values until the message thread has written them all
+    // to the parameters, then go back to the parameters (knobs, automation)
+    stateSnapshots_.Acquire();
+
+    const auto* state = stateSnapshots_.GetCurrent();
+    if (state != nullptr
+        && static_cast<int32_t>(stateLoadsApplied_.load(std::memory_order_acquire) - state->generation) >= 0)
+    {
+        stateSnapshots_.Release();
+        state = nullptr;
+    }
+
+    // Either way the block reads one copy, taken here
+    if (state != nullptr)
+    {
+        blockParameterValues_ = state->values;
+        return;
+    }
+
+    for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+        blockParameterValues_[i] = rawParams_[i]->load();
+
+    // A load is published before it writes any parameter, so one that
+    // began during the copy is waiting now: take its values, not the mix
+    if (const auto* loaded = stateSnapshots_.Acquire())
+        blockParameterValues_ = loaded->values;
+}
+
+juce::ValueTree SimpleSynthProcessor::saveMidiMappings() const
+{
+    using SimpleSynth::Control::MidiMapping;
+
+    juce::ValueTree mappings("MIDI_MAPPINGS");
+    for (size_t source = 0; source < MidiMapping::kNumSources; ++source)
+        for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+            if (midiMapping_.IsMapped(source, SimpleSynth::Control::ToParamIndex(i)))
+                mappings.appendChild(juce::ValueTree("MAP", { { "source", static_cast<int>(source) },
+                                                              { "param", SimpleSynth::Control::kParameterInfo[i].id } }),
+                                     nullptr);
+    return mappings;
+}
+
+void SimpleSynthProcessor::loadMidiMappings(const juce::ValueTree& mappings)
+{
+    using SimpleSynth::Control::MidiMapping;
+
+    // State without mappings (older sessions) clears them too
+    midiMapping_.ClearAll();
+
+    for (const auto& map : mappings)
+    {
+        const int source = map.getProperty("source", -1);
+        const auto id = map.getProperty("param").toString();
+
+        for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+            if (id == SimpleSynth::Control::kParameterInfo[i].id
+                && SimpleSynth::Control::kParameterInfo[i].continuous
+                && source >= 0 && source < static_cast<int>(MidiMapping::kNumSources))
+                midiMapping_.Map(static_cast<size_t>(source), SimpleSynth::Control::ToParamIndex(i));
+    }
+}
+
+juce::ValueTree SimpleSynthProcessor::saveTuning() const
+{
+    const juce::ScopedLock lock(tuningLock_);
+
+    // File contents, not paths: the session recalls the tuning on any machine
+    juce::ValueTree tuning("TUNING");
+    tuning.setProperty("scale", scaleText_, nullptr);
+    tuning.setProperty("scaleName", scaleName_, nullptr);
+    tuning.setProperty("mapping", mappingText_, nullptr);
+    tuning.setProperty("mappingName", mappingName_, nullptr);
+    return tuning;
+}
+
+void SimpleSynthProcessor::loadTuning(const juce::ValueTree& tuning)
+{
+    // State without a tuning (older sessions) resets to 12-TET; text that
+    // no longer parses falls back the same way
+    if (! loadTuningScale(tuning.getProperty("scale").toString(), tuning.getProperty("scaleName").toString()))
+        loadTuningScale({}, {});
+
+    if (! loadTuningMapping(tuning.getProperty("mapping").toString(), tuning.getProperty("mappingName").toString()))
+        loadTuningMapping({}, {});
+}
+
+juce::ValueTree SimpleSynthProcessor::saveModulationSlots() const
+{
+    const juce::ScopedLock lock(modSlotLock_);
+
+    // Stable ids, not enum values, so routes survive reordering
+    juce::ValueTree modulation("MOD_MATRIX");
+    for (size_t i = 0; i < kNumUserModSlots; ++i)
+    {
+        const auto& slot = editModSlots_[i];
+        if (! slot.IsActive())
+            continue;
+
+        modulation.appendChild(juce::ValueTree("SLOT", { { "index", static_cast<int>(i) },
+                                                         { "source", ModMatrix::GetSourceInfo(slot.source).id },
+                                                         { "destination", ModMatrix::GetDestinationInfo(slot.destination).id },
+                                                         { "depth", slot.depth } }),
+                               nullptr);
+    }
+    return modulation;
+}
+
+void SimpleSynthProcessor::loadModulationSlots(const juce::ValueTree& modulation)
+{
+    // State without a matrix (older sessions) clears the user slots;
+    // unknown ids (newer sessions) leave theirs empty
+    ModSlots slots {};
+
+    for (const auto& entry : modulation)
+    {
+        const int index = entry.getProperty("index", -1);
+        if (index < 0 || index >= static_cast<int>(kNumUserModSlots))
+            continue;
+
+        const auto sourceId = entry.getProperty("source").toString();
+        const auto destinationId = entry.getProperty("destination").toString();
+        auto& slot = slots[static_cast<size_t>(index)];
+
+        for (size_t s = 1; s < static_cast<size_t>(ModMatrix::Source::Count); ++s)
+            if (sourceId == ModMatrix::GetSourceInfo(static_cast<ModMatrix::Source>(s)).id)
+                slot.source = static_cast<ModMatrix::Source>(s);
+
+        for (size_t d = 1; d < static_cast<size_t>(ModMatrix::Destination::Count); ++d)
+            if (destinationId == ModMatrix::GetDestinationInfo(static_cast<ModMatrix::Destination>(d)).id)
+                slot.destination = static_cast<ModMatrix::Destination>(d);
+
+        slot.depth = static_cast<float>(entry.getProperty("depth", 0.0f));
+    }
+
+    for (size_t i = 0; i < kNumUserModSlots; ++i)
+        setModulationSlot(i, slots[i]);
+}
+
+void SimpleSynthProcessor::loadSnapshots(const juce::ValueTree& snapshots)
+{
+    // State without snapshots (older sessions) clears the bank; parameters
+    // a snapshot predates take their defaults
+    SimpleSynth::Control::SnapshotBank bank;
+
+    for (const auto& entry : snapshots)
+    {
+        const int slot = entry.getProperty("slot", -1);
+        if (slot < 0 || slot >= static_cast<int>(kNumSnapshots))
+            continue;
+
+        auto& snapshot = bank.slots[static_cast<size_t>(slot)];
+        for (size_t i = 0; i < SimpleSynth::Control::kNumParameters; ++i)
+            snapshot.values[i] = static_cast<float>(entry.getProperty(SimpleSynth::Control::kParameterInfo[i].id,
+                                                                      getDefaultParameterValue(i)));
+        snapshot.captured = true;
+    }
+
+    setSnapshotBank(bank);
+}
+
+void SimpleSynthProcessor::setSnapshotBank(const SimpleSynth::Control::SnapshotBank& bank)
+{
+    const juce::ScopedLock lock(snapshotLock_);
+    editSnapshots_ = bank;
+    snapshotsPending_ = true;
+    pushPendingSnapshots();
+}
+
+float SimpleSynthProcessor::getDefaultParameterValue(size_t index) const
+{
+    return parameterRanges_[index].convertFrom0to1(parameterObjects_[index]->getDefaultValue());
 }
 
 //==============================================================================
@@ -2,19 +2,64 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "DSP/DubOscillator.h"
+#include "DSP/ResonantFilter.h"
 #include "DSP/LFO.h"
 #include "DSP/DubDelay.h"
+#include "DSP/FdnReverb.h"
+#include "DSP/PartitionedConvolver.h"
 #include "DSP/Envelope.h"
+#include "DSP/Oversampler.h"
+#include "DSP/QualityTier.h"
+#include "Perf/CpuGovernor.h"
+#include "Perf/BlockTelemetry.h"
+#include "Perf/TraceRecorder.h"
+#include "Perf/RealtimeChecker.h"
+#include "Control/ParameterTable.h"
+#include "Control/ControlEventQueue.h"
+#include "Control/MidiMapping.h"
+#include "Control/SnapshotMorph.h"
+#include "Control/StateFormat.h"
+#include "Control/PresetBank.h"
+#include "DSP/ParameterSmoother.h"
+#include "DSP/PitchGlide.h"
+#include "DSP/Tuning.h"
+#include "DSP/ModMatrix.h"
+#include "DSP/AnalysisTap.h"
+#include "Util/SpscRing.h"
+#include "Util/SnapshotPublisher.h"
+#include "EditorResources.h"
+#include "OutputRecorder.h"
+#include <array>
+#include <atomic>
+#include <vector>
 
 /**
  * Dub Siren VST Processor
  *
  * Classic dub siren synthesizer with:
  * - Gritty square wave VCO
- * - Dub-style delay effect
- * - Two LFOs for modulation routing
+ * - Resonant low-pass/band-pass filter between the VCO and the delay,
+ *   its cutoff swept at control rate (off by default)
+ * - Dub-style delay effect (up to 4 tape heads on one delay line)
+ * - Spring tank convolution after the delay, from a sampled impulse
+ *   response (off at mix 0 or without an IR file)
+ * - Feedback-delay-network reverb after the delay (off at mix 0)
+ * - Modulation matrix: LFOs, envelope, velocity, mod wheel and noise
+ *   routed to the VCO, filter, delay and LFOs (the LFO target parameters are
+ *   its first two slots)
+ * - Optional 2x/4x oversampling of the siren core (see README for cost)
+ * - Quality tiers: Auto picks Studio for offline bounces, Live otherwise
+ * - CPU governor stepping tiers down before the block deadline is missed
+ * - On-screen triggers, hold, pitch dive and parameter gestures merged
+ *   sample-accurately with host MIDI
+ * - MIDI learn for CCs, pitch bend and aftertouch, smoothed at control rate
+ * - Optional key tracking through a Scala tuning, with log-domain glide
+ * - Scene snapshots, morphed at control rate
+ * - Decimated output feed for the editor's scope and spectrum
+ * - Record mode streaming the output to a WAV or FLAC file
  */
-class SimpleSynthProcessor : public juce::AudioProcessor
+class SimpleSynthProcessor : public juce::AudioProcessor,
+                             private juce::Timer
 {
 public:
     SimpleSynthProcessor();
@@ -41,6 +86,13 @@ public:
     double getTailLengthSeconds() const override;
 
     //==============================================================================
+    // Programs are the presets of the bank file, mapped once per process
+    // and shared by every instance; without a bank there is one program
+    static juce::File getPresetBankFile();
+
+    // Spring impulse response (a WAV file), read once per process and
+    // shared by every instance; without the file the spring is silent
+    static juce::File getSpringImpulseFile();
     int getNumPrograms() override;
     int getCurrentProgram() override;
     void setCurrentProgram(int index) override;
@@ -54,38 +106,333 @@ public:
     // Parameter access
     juce::AudioProcessorValueTreeState& getParameters() { return parameters_; }
 
-    // LFO routing enums
-    enum class LFO1Target {
-        None = 0,
-        VCORate,
-        DelayTime,
-        DelayFeedback
+    // Quality tier in use (DSP::QualityTier index, -1 = Custom). Any thread.
+    int getActiveQualityTier() const { return activeQualityTier_.load(std::memory_order_relaxed); }
+
+    // Moving average of block time / block deadline. Any thread.
+    float getCpuLoad() const { return governor_.GetAverageLoad(); }
+
+    // Per-block timing for the editor's load meter (editor drains it)
+    SimpleSynth::Perf::BlockTelemetry& getTelemetry() { return telemetry_; }
+
+    // Output feed for the editor's scope and spectrum; the editor enables
+    // it while open and drains it
+    SimpleSynth::DSP::AnalysisTap& getAnalysisTap() { return analysisTap_; }
+
+    // Record mode: the output is streamed to file (.wav or .flac) by a
+    // writer thread while playing. Message thread. getNewRecordingFile()
+    // names a fresh file in <user music>/Dub Siren.
+    static juce::File getNewRecordingFile(const juce::String& extension);
+    bool startRecording(const juce::File& file);
+    void stopRecording();
+    const OutputRecorder& getRecorder() const { return recorder_; }
+
+    // Performance gestures (message thread). Returns false when the queue
+    // is full; the queue's statistics count such overflows.
+    bool pushControlEvent(SimpleSynth::Control::ControlEvent event);
+    const SimpleSynth::Control::ControlEventQueue& getControlEvents() const { return controlEvents_; }
+
+    // MIDI controller mappings and learn (message thread edits, audio thread reads)
+    SimpleSynth::Control::MidiMapping& getMidiMapping() { return midiMapping_; }
+
+    // Tuning for key tracking, from .scl/.kbm file contents (empty text
+    // resets to 12-TET / the default mapping). Returns false and keeps the
+    // current tuning if the text doesn't parse. Message thread.
+    bool loadTuningScale(const juce::String& sclText, const juce::String& name);
+    bool loadTuningMapping(const juce::String& kbmText, const juce::String& name);
+    juce::String getTuningName() const;
+
+    // Modulation matrix slots beyond the two owned by the LFO target
+    // parameters. Message thread; saved with the state.
+    static constexpr size_t kNumUserModSlots = SimpleSynth::DSP::ModMatrix::kMaxSlots - 2;
+    void setModulationSlot(size_t index, const SimpleSynth::DSP::ModMatrix::Slot& slot);
+    SimpleSynth::DSP::ModMatrix::Slot getModulationSlot(size_t index) const;
+
+    // Scene snapshots: every parameter's current value, morphed between by
+    // the morph/morphA/morphB parameters. Message thread; saved with the state.
+    static constexpr size_t kNumSnapshots = SimpleSynth::Control::SnapshotBank::kNumSlots;
+    void captureSnapshot(size_t slot);
+    void clearSnapshot(size_t slot);
+    bool hasSnapshot(size_t slot) const;
+    bool getSnapshotValues(size_t slot, std::array<float, SimpleSynth::Control::kNumParameters>& values) const;
+
+    // Seed for the VCO's noise; takes effect on the next prepareToPlay()
+    void setNoiseSeed(uint32_t seed) { dubOscillator_.SetNoiseSeed(seed); }
+
+    // Oversampling of the siren core (VCO, envelope, LFO modulation)
+    enum class OversamplingMode {
+        Off = 0,
+        TwoX,
+        FourX,
+        TwoXVcoOnly,    // Modulation/envelope at host rate, VCO oversampled
+        FourXVcoOnly
     };
 
-    enum class LFO2Target {
-        None = 0,
-        LFO1Rate,
-        LFO1Amount,
-        DelayWetDry
+    // Quality parameter choices (tiers map to DSP::QualityTier presets)
+    enum class QualityChoice {
+        Auto = 0,   // Studio when isNonRealtime(), Live otherwise
+        Eco,
+        Live,
+        Studio,
+        Custom      // Classic paths + Oversampling parameter
     };
 
 private:
+    using ParamIndex = SimpleSynth::Control::ParamIndex;
+    using ControlEvent = SimpleSynth::Control::ControlEvent;
+    using ModMatrix = SimpleSynth::DSP::ModMatrix;
+    using ModSlots = std::array<ModMatrix::Slot, kNumUserModSlots>;
+
+    // Parameter values read once per block for the sample loop
+    struct BlockParameters {
+        float vcoRate = 440.0f;
+        float vcoLevel = 0.8f;
+        float delayTime = 0.375f;
+        float delayFeedback = 0.6f;
+        float delayWetDry = 0.4f;
+        float lfo1Rate = 2.0f;
+        float lfo1Amount = 0.5f;
+        float lfo2Rate = 0.5f;
+        float lfo2Amount = 0.3f;
+        float glide = 0.0f;
+        float morph = 0.0f;
+        float reverbMix = 0.0f;
+        float reverbDecay = 2.0f;
+        float reverbDamping = 0.4f;
+        float reverbSize = 0.5f;
+        float springMix = 0.0f;
+        float filterCutoff = 2000.0f;
+        float filterResonance = 0.2f;
+        SimpleSynth::DSP::ResonantFilter::Mode filterMode = SimpleSynth::DSP::ResonantFilter::Mode::Off;
+        size_t delayHeads = 1;
+        bool delayTape = false;
+        bool keyTrack = false;
+    };
+
+    // A loaded state's parameter values (real, as the raw atomics hold
+    // them), swapped in whole at a block boundary
+    struct StateSnapshot {
+        std::array<float, SimpleSynth::Control::kNumParameters> values {};
+        uint32_t generation = 0;
+    };
+
+    // A control event drained from the queue, placed in the current block
+    struct PendingControlEvent {
+        ControlEvent event;
+        int samplePosition = 0;
+    };
+
+    // This block's copy, taken once by receiveStateSnapshot()
+    float loadParameter(ParamIndex index) const
+    {
+        return blockParameterValues_[static_cast<size_t>(index)];
+    }
+
     void updateDSPFromParameters();
+    void applyBlockParameters();
+    void setBlockParameter(ParamIndex index, float value);
+    float getBlockParameter(ParamIndex index) const;
+    void applyParameter(ParamIndex index);
+    void updateDelayHeads(float delayTime, float delayFeedback);
+    QualityChoice readQualityChoice() const;
+    SimpleSynth::DSP::QualitySettings resolveQualitySettings(QualityChoice choice);
+    void applyQualitySettings(const SimpleSynth::DSP::QualitySettings& settings);
+    void handleMidiEvent(const juce::MidiMessage& msg);
+    int drainControlEvents(int numSamples, juce::int64 blockStartTicks);
+    void handleControlEvent(const ControlEvent& event);
+    void releaseGateIfIdle();
+    void retuneToNote(int midiNote);
+    void applyPitch();
+    void pushPendingTuning();
+    void receiveTuning();
+    juce::ValueTree saveTuning() const;
+    void loadTuning(const juce::ValueTree& tuning);
+    void handleControllerEvent(size_t source, float normalisedValue);
+    void advanceControllerSmoothing(size_t numSamples);
+    void publishControllerValues();
+    juce::ValueTree saveMidiMappings() const;
+    void loadMidiMappings(const juce::ValueTree& mappings);
+    void updateLfoTargetSlots();
+    void pushPendingModulationSlots();
+    void receiveModulationSlots();
+    juce::ValueTree saveModulationSlots() const;
+    void loadModulationSlots(const juce::ValueTree& slots);
+    void pushPendingSnapshots();
+    void receiveSnapshots();
+    void updateMorph();
+    void advanceMorph(size_t numSamples);
+    void loadSnapshots(const juce::ValueTree& snapshots);
+    void setSnapshotBank(const SimpleSynth::Control::SnapshotBank& bank);
+    float getDefaultParameterValue(size_t index) const;
+    void loadBinaryState(const void* data, int sizeInBytes);
+    void loadXmlState(const void* data, int sizeInBytes);
+    void applyStateParameters(std::array<float, SimpleSynth::Control::kNumParameters> values);
+    uint32_t publishStateSnapshot(const std::array<float, SimpleSynth::Control::kNumParameters>& values);
+    void receiveStateSnapshot();
+    void tickModulation(float envelopeLevel);
+    void applyModulation(size_t numSamples, float envelopeLevel);
+    void updateFilterTarget(float cutoffModulation, float resonanceModulation);
+    void timerCallback() override;
+    void renderEnvelope(int numSamples);
+    void renderSiren(float* output, int numSamples);
 
     // DSP modules
     SimpleSynth::DSP::DubOscillator dubOscillator_;
+    SimpleSynth::DSP::ResonantFilter filter_;
     SimpleSynth::DSP::LFO lfo1_;
     SimpleSynth::DSP::LFO lfo2_;
     SimpleSynth::DSP::DubDelay dubDelay_;
+    SimpleSynth::DSP::PartitionedConvolver spring_;
+    SimpleSynth::DSP::FdnReverb reverb_;
     SimpleSynth::DSP::Envelope envelope_;
+    SimpleSynth::DSP::Oversampler oversampler_;
+
+    // Envelope pass for the current segment, at the core rate (preallocated)
+    std::vector<float> envelopeBuffer_;
+    SimpleSynth::DSP::QualitySettings activeQuality_ =
+        SimpleSynth::DSP::GetQualitySettings(SimpleSynth::DSP::QualityTier::Live);
+    size_t controlCountdown_ = 0;
+    size_t modulationPosition_ = 0;    // Core samples into the current segment
+
+    // Adaptive quality under CPU pressure (realtime only)
+    SimpleSynth::Perf::CpuGovernor governor_;
+    std::atomic<int> activeQualityTier_ { static_cast<int>(SimpleSynth::DSP::QualityTier::Live) };
 
-    // Parameter management
+    SimpleSynth::Perf::BlockTelemetry telemetry_;
+    SimpleSynth::DSP::AnalysisTap analysisTap_;
+    OutputRecorder recorder_;
+
+    double hostSampleRate_ = 44100.0;
+    BlockParameters blockParams_;
+
+    // Parameter management. Raw value pointers are looked up once in the
+    // constructor; looking up by ID builds a juce::String, which allocates.
     juce::AudioProcessorValueTreeState parameters_;
+    std::array<std::atomic<float>*, SimpleSynth::Control::kNumParameters> rawParams_ {};
+    std::array<juce::NormalisableRange<float>, SimpleSynth::Control::kNumParameters> parameterRanges_;
+    std::array<juce::RangedAudioParameter*, SimpleSynth::Control::kNumParameters> parameterObjects_ {};
+
+    // State loads: the loaded values are published as one snapshot before
+    // the parameters are written one by one, and the audio thread reads
+    // the snapshot until stateLoadsApplied_ reaches its generation. Each
+    // block copies every parameter once, from the snapshot or the atomics,
+    // and reads only that copy, so a preset switches whole at one block
+    // boundary
+    SimpleSynth::Util::SnapshotPublisher<StateSnapshot> stateSnapshots_;
+    juce::CriticalSection stateLock_;   // Message side only, as tuningLock_
+    uint32_t stateGeneration_ = 0;
+    std::atomic<uint32_t> stateLoadsApplied_ { 0 };
+    std::array<float, SimpleSynth::Control::kNumParameters> blockParameterValues_ {};
+
+    // Preset bank: read-only and immutable once opened, so instances
+    // share it without locking
+    struct SharedPresetBank {
+        SharedPresetBank();
+        std::unique_ptr<juce::MemoryMappedFile> file;
+        SimpleSynth::Control::PresetBank bank;
+    };
+
+    juce::SharedResourcePointer<SharedPresetBank> presetBank_;
+    int currentProgram_ = 0;
+
+    // Spring impulse response, shared by the instances in one process.
+    // The file is decoded into a kernel per sample rate on first use
+    // (prepareToPlay); the decoded samples aren't kept. Kernels live as
+    // long as the resource, so convolvers can point into them.
+    struct SharedSpringImpulse {
+        static constexpr double kMaxLengthSeconds = 10.0;
+
+        SharedSpringImpulse();
+        const SimpleSynth::DSP::ConvolutionKernel* getKernel(double sampleRate);
+        double getLengthSeconds() const;
+
+        static std::unique_ptr<juce::MemoryMappedAudioFormatReader> openImpulse();
+
+        double impulseRate = 0.0;       // From the header; immutable once constructed
+        int impulseLength = 0;
+        juce::CriticalSection kernelLock;
+        std::vector<std::pair<double, std::unique_ptr<SimpleSynth::DSP::ConvolutionKernel>>> kernels;
+    };
+
+    juce::SharedResourcePointer<SharedSpringImpulse> springImpulse_;
+
+    // Held so the editor's panel decodes in the background from plugin
+    // load, not when the editor first opens
+    juce::SharedResourcePointer<EditorResources> editorResources_;
 
     // MIDI state
     int currentMidiNote_ = -1;
     bool isNoteOn_ = false;
-    float currentNoteVelocity_ = 1.0f;
+    float currentNoteVelocity_ = 1.0f;  // Of the note or trigger that last opened the gate
+    float modWheel_ = 0.0f;             // CC 1, 0..1
+
+    // Control surface state (audio thread). Events are placed one block
+    // late on the producer's clock, so their spacing survives jitter.
+    SimpleSynth::Control::ControlEventQueue controlEvents_;
+    std::array<PendingControlEvent, SimpleSynth::Control::ControlEventQueue::kCapacity> pendingControlEvents_;
+    juce::int64 previousBlockStartTicks_ = 0;
+    bool triggerDown_ = false;
+    bool holdOn_ = false;
+
+    // Parameter gestures override the parameter's own value until released
+    std::array<float, SimpleSynth::Control::kNumParameters> parameterOverrides_ {};
+    std::array<bool, SimpleSynth::Control::kNumParameters> overrideActive_ {};
+
+    // Pitch dive and key-tracked portamento, as frequency ratios stepped
+    // at control rate; pitchMultiplier_ is their product
+    float modulationSampleRate_ = 44100.0f;
+    SimpleSynth::DSP::PitchGlide diveGlide_;
+    SimpleSynth::DSP::PitchGlide noteGlide_;
+    float pitchMultiplier_ = 1.0f;
+    int trackedNote_ = -1;              // Last key-tracked note, -1 = none
+
+    // Tuning tables: the audio thread's copy, and the message thread's
+    // working copy handed over through a ring (a Tuning is fixed-size)
+    SimpleSynth::DSP::Tuning tuning_;
+    SimpleSynth::Util::SpscRing<SimpleSynth::DSP::Tuning, 4> tuningUpdates_;
+    juce::CriticalSection tuningLock_;  // Message side only; hosts may load state off the message thread
+    SimpleSynth::DSP::Tuning editTuning_;
+    bool tuningPending_ = false;
+    juce::String scaleText_, scaleName_, mappingText_, mappingName_;
+
+    // Modulation matrix (audio thread). Slots 0 and 1 follow the LFO
+    // target parameters; the user slots arrive through a ring like tunings.
+    ModMatrix modMatrix_;
+    alignas(16) std::array<float, ModMatrix::kNumSources> modSources_ {};
+    alignas(64) std::array<float, ModMatrix::kDestinationStride> modOutputs_ {};
+    SimpleSynth::DSP::XorShift32 modulationNoise_;
+    SimpleSynth::Util::SpscRing<ModSlots, 4> modSlotUpdates_;
+    juce::CriticalSection modSlotLock_;  // Message side only, as tuningLock_
+    ModSlots editModSlots_ {};
+    bool modSlotsPending_ = false;
+
+    // Scene morph (audio thread): endpoints compiled when the slots or the
+    // bank change, blended once per control tick while the position glides.
+    // The bank arrives through a ring like tunings.
+    SimpleSynth::Control::SnapshotBank snapshots_;
+    SimpleSynth::Control::SnapshotMorph snapshotMorph_;
+    SimpleSynth::DSP::ParameterSmoother morphPosition_;
+    int morphSlotA_ = 0, morphSlotB_ = 0;   // 1-based, 0 = none
+    bool snapshotsChanged_ = false;
+    SimpleSynth::Util::SpscRing<SimpleSynth::Control::SnapshotBank, 4> snapshotUpdates_;
+    juce::CriticalSection snapshotLock_;    // Message side only, as tuningLock_
+    SimpleSynth::Control::SnapshotBank editSnapshots_;
+    bool snapshotsPending_ = false;
+
+    // MIDI controller layer: a mapped controller drives its parameters
+    // (smoothed at control rate) until their own value moves
+    struct ControllerState {
+        SimpleSynth::DSP::ParameterSmoother smoother;
+        bool active = false;
+        float lastRawValue = 0.0f;
+        std::atomic<float> pendingNormalised { -1.0f };   // Sent to the host by the timer
+        std::atomic<float> publishedValue { -1.0f };      // Last value the timer sent
+    };
+
+    SimpleSynth::Control::MidiMapping midiMapping_;
+    std::array<ControllerState, SimpleSynth::Control::kNumParameters> controllers_;
+    uint32_t smoothingMask_ = 0;    // Bit per parameter still gliding
+    static_assert(SimpleSynth::Control::kNumParameters <= 32, "smoothingMask_ holds one bit per parameter");
 
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
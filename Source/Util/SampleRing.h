@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+namespace SimpleSynth {
+namespace Util {
+
+/**
+ * Single-Producer Single-Consumer Sample FIFO
+ *
+ * A lock-free ring of floats for streaming audio off the audio thread.
+ * The producer appends whole blocks (a block that doesn't fit is refused,
+ * never split, so the stream has gaps only at block boundaries). The
+ * consumer reads the queued samples in place, as at most two contiguous
+ * regions, hands them straight to whatever writes them out and then
+ * releases them with Consume(): no copy on its side.
+ *
+ * Indices run freely and are masked on access, so all Capacity samples
+ * are usable. Storage lives inside the object (Capacity floats; allocate
+ * large rings on the heap). Capacity must be a power of two.
+ *
+ * Threading: exactly one thread may call Write(), exactly one other
+ * thread may call GetReadRegions()/Consume().
+ */
+template <size_t Capacity>
+class SampleRing {
+public:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+    // Queued samples in FIFO order: first, then second (after wraparound)
+    struct Regions {
+        const float* first = nullptr;
+        size_t firstSize = 0;
+        const float* second = nullptr;
+        size_t secondSize = 0;
+
+        size_t GetSize() const { return firstSize + secondSize; }
+    };
+
+    SampleRing() : writeIndex_(0), readIndex_(0) {}
+
+    /**
+     * Producer: append a block. Returns false (and drops all of it) when
+     * it doesn't fit. Wait-free.
+     */
+    bool Write(const float* samples, size_t numSamples) {
+        const size_t write = writeIndex_.load(std::memory_order_relaxed);
+        const size_t read = readIndex_.load(std::memory_order_acquire);
+
+        if (numSamples > Capacity - (write - read)) {
+            return false;
+        }
+
+        const size_t offset = write & kMask;
+        const size_t firstSize = std::min(numSamples, Capacity - offset);
+        std::memcpy(samples_.data() + offset, samples, firstSize * sizeof(float));
+        std::memcpy(samples_.data(), samples + firstSize, (numSamples - firstSize) * sizeof(float));
+
+        writeIndex_.store(write + numSamples, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer: everything queued, in place. Valid until Consume().
+     */
+    Regions GetReadRegions() const {
+        const size_t read = readIndex_.load(std::memory_order_relaxed);
+        const size_t write = writeIndex_.load(std::memory_order_acquire);
+        const size_t numReady = write - read;
+        const size_t offset = read & kMask;
+
+        Regions regions;
+        regions.first = samples_.data() + offset;
+        regions.firstSize = std::min(numReady, Capacity - offset);
+        regions.second = samples_.data();
+        regions.secondSize = numReady - regions.firstSize;
+        return regions;
+    }
+
+    /**
+     * Consumer: release the oldest numSamples (at most what was read).
+     */
+    void Consume(size_t numSamples) {
+        const size_t read = readIndex_.load(std::memory_order_relaxed);
+        readIndex_.store(read + numSamples, std::memory_order_release);
+    }
+
+    /**
+     * Approximate number of samples waiting (exact from either end's own thread).
+     */
+    size_t GetNumReady() const {
+        const size_t write = writeIndex_.load(std::memory_order_acquire);
+        const size_t read = readIndex_.load(std::memory_order_acquire);
+        return write - read;
+    }
+
+    static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    std::array<float, Capacity> samples_;
+
+    // Separate cache lines so producer and consumer don't false-share
+    alignas(64) std::atomic<size_t> writeIndex_;
+    alignas(64) std::atomic<size_t> readIndex_;
+};
+
+} // namespace Util
+} // namespace SimpleSynth
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace SimpleSynth {
+namespace Util {
+
+/**
+ * Snapshot Publisher (RCU-style)
+ *
+ * Hands whole immutable objects from a writer thread to a reader thread
+ * with a single atomic pointer swap. The writer fills a slot from a
+ * preallocated pool and publishes it; the reader picks up the latest one
+ * at a point of its choosing (the audio thread: a block boundary) and
+ * sees every field of it at once, never a mix of old and new.
+ *
+ * Slots the reader has moved past are marked retired; the writer
+ * reclaims them on its next BeginWrite(), so nothing is freed or
+ * allocated on the reader's side and neither side takes a lock. A
+ * publish the reader never picked up is reclaimed when replaced.
+ *
+ * Four slots suffice for one writer: one held by the reader, one it
+ * has just retired, one published but unread, and one being written.
+ *
+ * Threading: exactly one thread may call BeginWrite()/Publish(),
+ * exactly one other thread may call Acquire()/Release().
+ */
+template <typename T, size_t NumSlots = 4>
+class SnapshotPublisher {
+public:
+    static_assert(NumSlots >= 4, "One writer needs four slots");
+
+    SnapshotPublisher() {
+        for (auto& state : states_) {
+            state.store(kFree, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Writer: a free slot to fill, or nullptr if none (only possible if
+     * an earlier BeginWrite() was never published).
+     */
+    T* BeginWrite() {
+        // Retired slots come back to the pool here, on the writer's thread
+        for (auto& state : states_) {
+            if (state.load(std::memory_order_acquire) == kRetired) {
+                state.store(kFree, std::memory_order_relaxed);
+            }
+        }
+
+        for (size_t i = 0; i < NumSlots; ++i) {
+            if (states_[i].load(std::memory_order_relaxed) == kFree) {
+                states_[i].store(kWriting, std::memory_order_relaxed);
+                return &slots_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Writer: make a filled slot the latest. It must not be touched again.
+     */
+    void Publish(T* slot) {
+        const size_t index = IndexOf(slot);
+        assert(states_[index].load(std::memory_order_relaxed) == kWriting && "Publish a slot from BeginWrite()");
+
+        states_[index].store(kPublished, std::memory_order_relaxed);
+        const int previous = pending_.exchange(static_cast<int>(index), std::memory_order_acq_rel);
+
+        // Replaced before the reader saw it: back to the pool
+        if (previous >= 0) {
+            states_[static_cast<size_t>(previous)].store(kFree, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Reader: the newly published object, or nullptr if nothing new. The
+     * previous one is retired; the new one stays valid until the next
+     * Acquire() that returns non-null, or Release().
+     */
+    const T* Acquire() {
+        const int index = pending_.exchange(-1, std::memory_order_acq_rel);
+        if (index < 0) {
+            return nullptr;
+        }
+
+        Release();
+        current_ = index;
+        states_[static_cast<size_t>(index)].store(kInUse, std::memory_order_relaxed);
+        return &slots_[static_cast<size_t>(index)];
+    }
+
+    /**
+     * Reader: the object from the last Acquire(), or nullptr after Release().
+     */
+    const T* GetCurrent() const {
+        return current_ >= 0 ? &slots_[static_cast<size_t>(current_)] : nullptr;
+    }
+
+    /**
+     * Reader: done with the current object; the writer may reuse it.
+     */
+    void Release() {
+        if (current_ >= 0) {
+            states_[static_cast<size_t>(current_)].store(kRetired, std::memory_order_release);
+            current_ = -1;
+        }
+    }
+
+private:
+    enum : uint8_t { kFree, kWriting, kPublished, kInUse, kRetired };
+
+    size_t IndexOf(const T* slot) const {
+        const auto index = static_cast<size_t>(slot - slots_.data());
+        assert(index < NumSlots && "Not a slot of this publisher");
+        return index;
+    }
+
+    std::array<T, NumSlots> slots_ {};
+    std::array<std::atomic<uint8_t>, NumSlots> states_;
+
+    // Reader-only
+    int current_ = -1;
+
+    // Index of the published, not yet acquired slot (-1 = none)
+    alignas(64) std::atomic<int> pending_ { -1 };
+};
+
+} // namespace Util
+} // namespace SimpleSynth
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace SimpleSynth {
+namespace Util {
+
+/**
+ * Single-Producer Single-Consumer Ring Buffer
+ *
+ * Fixed-capacity lock-free FIFO for handing values from one thread to
+ * another (typically audio thread -> message thread). Push() and Pop()
+ * are wait-free: a full ring drops the new value instead of blocking,
+ * and an empty ring returns false.
+ *
+ * Storage lives inside the object, so nothing allocates after
+ * construction. Capacity must be a power of two; one slot is kept free
+ * to tell full from empty.
+ *
+ * Threading: exactly one thread may call Push(), exactly one other
+ * thread may call Pop(). T should be trivially copyable.
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+public:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+    SpscRing() : writeIndex_(0), readIndex_(0) {}
+
+    /**
+     * Producer: append a value. Returns false (and drops it) when full.
+     */
+    bool Push(const T& value) {
+        const size_t write = writeIndex_.load(std::memory_order_relaxed);
+        const size_t next = (write + 1) & kMask;
+
+        if (next == readIndex_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        slots_[write] = value;
+        writeIndex_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer: take the oldest value. Returns false when empty.
+     */
+    bool Pop(T& value) {
+        const size_t read = readIndex_.load(std::memory_order_relaxed);
+
+        if (read == writeIndex_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = slots_[read];
+        readIndex_.store((read + 1) & kMask, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Approximate number of values waiting (exact from either end's own thread).
+     */
+    size_t GetNumReady() const {
+        const size_t write = writeIndex_.load(std::memory_order_acquire);
+        const size_t read = readIndex_.load(std::memory_order_acquire);
+        return (write - read) & kMask;
+    }
+
+    static constexpr size_t GetCapacity() { return Capacity - 1; }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    std::array<T, Capacity> slots_;
+
+    // Separate cache lines so producer and consumer don't false-share
+    alignas(64) std::atomic<size_t> writeIndex_;
+    alignas(64) std::atomic<size_t> readIndex_;
+};
+
+} // namespace Util
+} // namespace SimpleSynth
@@ -0,0 +1,57 @@
+# Helpers for the cmake -P scripts that build this project as it was at
+# an earlier commit (RenderGoldenBaseline, CompareEditorBaseline). The
+# commit is checked out as a detached git worktree that shares this
+# tree's JUCE; nothing here touches the main checkout.
+
+find_package(Git REQUIRED)
+
+function(run_checked)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        string(REPLACE ";" " " command "${ARGN}")
+        message(FATAL_ERROR "'${command}' failed (${result})")
+    endif()
+endfunction()
+
+# A fresh worktree of <ref> at <worktree>, so stale sources never leak in
+function(baseline_worktree_add source_dir worktree ref)
+    if(EXISTS "${worktree}")
+        execute_process(COMMAND "${GIT_EXECUTABLE}" -C "${source_dir}" worktree remove --force "${worktree}")
+        file(REMOVE_RECURSE "${worktree}")
+    endif()
+    execute_process(COMMAND "${GIT_EXECUTABLE}" -C "${source_dir}" worktree prune)
+
+    execute_process(COMMAND "${GIT_EXECUTABLE}" -C "${source_dir}" rev-parse --verify --quiet "${ref}^{commit}"
+                    RESULT_VARIABLE result OUTPUT_QUIET)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "No commit '${ref}': tag it first (see README.md)")
+    endif()
+
+    run_checked("${GIT_EXECUTABLE}" -C "${source_dir}" worktree add --detach "${worktree}" "${ref}")
+
+    # The submodule isn't checked out in a worktree; point it at ours
+    file(REMOVE_RECURSE "${worktree}/libs/JUCE")
+    file(MAKE_DIRECTORY "${worktree}/libs")
+    file(CREATE_LINK "${source_dir}/libs/JUCE" "${worktree}/libs/JUCE" SYMBOLIC)
+endfunction()
+
+function(baseline_worktree_remove source_dir worktree)
+    execute_process(COMMAND "${GIT_EXECUTABLE}" -C "${source_dir}" worktree remove --force "${worktree}")
+endfunction()
+
+# Configures <source> into <build> and builds one target
+function(baseline_build source build config target)
+    run_checked("${CMAKE_COMMAND}" -S "${source}" -B "${build}" "-DCMAKE_BUILD_TYPE=${config}")
+    run_checked("${CMAKE_COMMAND}" --build "${build}" --config "${config}" --target "${target}")
+endfunction()
+
+# Path of a built executable anywhere under <build> (generators differ)
+function(baseline_find_executable build name out_var)
+    file(GLOB_RECURSE candidates "${build}/*${name}" "${build}/*${name}.exe")
+    list(FILTER candidates EXCLUDE REGEX "CMakeFiles")
+    if(NOT candidates)
+        message(FATAL_ERROR "No ${name} in ${build}")
+    endif()
+    list(GET candidates 0 executable)
+    set(${out_var} "${executable}" PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SimpleSynth {
+namespace Bench {
+
+/**
+ * DSP Benchmark
+ *
+ * Base class for hot-path benchmarks. Instances register themselves
+ * on construction (same pattern as juce::UnitTest) and are run by
+ * bench_Main.cpp, which reports nanoseconds per sample.
+ *
+ * Benchmarks are defined in separate files as static instances:
+ *     static MyBenchmark myBenchmark;
+ */
+class Benchmark {
+public:
+    explicit Benchmark(const std::string& name)
+        : name_(name)
+    {
+        GetRegistry().push_back(this);
+    }
+
+    virtual ~Benchmark() = default;
+
+    /**
+     * Allocate and initialize everything the benchmark needs.
+     * Called once before timing starts.
+     */
+    virtual void Prepare(float sampleRate, size_t blockSize) = 0;
+
+    /**
+     * Process one block in place. This is the timed call.
+     * buffer holds input noise on entry.
+     */
+    virtual void ProcessBlock(float* buffer, size_t numSamples) = 0;
+
+    /**
+     * Comparison benchmarks (JUCE's equivalents, slower variants) are
+     * reported but not gated: the perf gate covers this repo's hot paths.
+     */
+    virtual bool IsGated() const { return true; }
+
+    const std::string& GetName() const { return name_; }
+
+    static std::vector<Benchmark*>& GetRegistry() {
+        static std::vector<Benchmark*> registry;
+        return registry;
+    }
+
+private:
+    std::string name_;
+};
+
+} // namespace Bench
+} // namespace SimpleSynth
@@ -0,0 +1,51 @@
+# Times opening the editor as it was at a baseline ref and as it is
+# now, with the same benchmark, one after the other. Run through the
+# compare_editor_baseline target, or directly:
+#
+#     cmake -DSOURCE_DIR=<repo> -DWORK_DIR=<scratch> -DBASELINE_REF=<tag or commit>
+#           -DCURRENT_BENCHMARK=<path to DubSiren_EditorBenchmark>
+#           [-DOPENS=50] [-DBUILD_CONFIG=Release] -P Tests/CompareEditorBaseline.cmake
+#
+# The baseline predates bench_Editor.cpp, so this tree's copy is added to
+# it and built with DUBSIREN_EDITOR_BASELINE=1 (create + first paint only).
+
+foreach(required SOURCE_DIR WORK_DIR BASELINE_REF CURRENT_BENCHMARK)
+    if(NOT DEFINED ${required})
+        message(FATAL_ERROR "CompareEditorBaseline: ${required} is not set")
+    endif()
+endforeach()
+
+if(NOT DEFINED BUILD_CONFIG)
+    set(BUILD_CONFIG Release)
+endif()
+if(NOT DEFINED OPENS)
+    set(OPENS 50)
+endif()
+
+include("${CMAKE_CURRENT_LIST_DIR}/BaselineWorktree.cmake")
+
+set(worktree "${WORK_DIR}/source")
+set(build "${WORK_DIR}/build")
+
+baseline_worktree_add("${SOURCE_DIR}" "${worktree}" "${BASELINE_REF}")
+
+file(COPY "${SOURCE_DIR}/Tests/bench_Editor.cpp" DESTINATION "${worktree}/Tests")
+file(APPEND "${worktree}/Tests/CMakeLists.txt" "
+add_executable(DubSiren_EditorBenchmark bench_Editor.cpp \${DUBSIREN_PROCESSOR_SOURCES})
+target_compile_definitions(DubSiren_EditorBenchmark PRIVATE
+    JucePlugin_Name=\"Dub Siren\" JUCE_WEB_BROWSER=0 JUCE_USE_CURL=0 DUBSIREN_EDITOR_BASELINE=1)
+target_link_libraries(DubSiren_EditorBenchmark PRIVATE
+    juce::juce_audio_utils juce::juce_dsp DubSirenResources)
+target_compile_features(DubSiren_EditorBenchmark PRIVATE cxx_std_17)
+target_include_directories(DubSiren_EditorBenchmark PRIVATE ../Source)
+")
+
+baseline_build("${worktree}" "${build}" "${BUILD_CONFIG}" DubSiren_EditorBenchmark)
+baseline_find_executable("${build}" DubSiren_EditorBenchmark baselineBenchmark)
+
+message(STATUS "Baseline editor (${BASELINE_REF}):")
+run_checked("${baselineBenchmark}" ${OPENS})
+message(STATUS "Current editor:")
+run_checked("${CURRENT_BENCHMARK}" ${OPENS})
+
+baseline_worktree_remove("${SOURCE_DIR}" "${worktree}")
@@ -0,0 +1,41 @@
+# Renders the golden WAVs with the processor as it was at a baseline
+# commit, so the goldens pin the pre-optimisation sound rather than
+# whatever the current tree renders. Run through the
+# render_baseline_goldens target, or directly:
+#
+#     cmake -DSOURCE_DIR=<repo> -DWORK_DIR=<scratch> -DBASELINE_REF=<commit>
+#           [-DBUILD_CONFIG=Release] -P Tests/RenderGoldenBaseline.cmake
+#
+# The baseline's own DubSiren_GoldenTests renders the scripts it has.
+# Those WAVs are copied into Tests/golden; scripts added after the
+# baseline are left for update_golden_renders.
+
+foreach(required SOURCE_DIR WORK_DIR BASELINE_REF)
+    if(NOT DEFINED ${required})
+        message(FATAL_ERROR "RenderGoldenBaseline: ${required} is not set")
+    endif()
+endforeach()
+
+if(NOT DEFINED BUILD_CONFIG)
+    set(BUILD_CONFIG Release)
+endif()
+
+include("${CMAKE_CURRENT_LIST_DIR}/BaselineWorktree.cmake")
+
+set(worktree "${WORK_DIR}/source")
+set(build "${WORK_DIR}/build")
+
+baseline_worktree_add("${SOURCE_DIR}" "${worktree}" "${BASELINE_REF}")
+baseline_build("${worktree}" "${build}" "${BUILD_CONFIG}" DubSiren_GoldenTests)
+baseline_find_executable("${build}" DubSiren_GoldenTests renderer)
+
+run_checked("${renderer}" --update "${worktree}/Tests/golden")
+
+file(GLOB goldens "${worktree}/Tests/golden/*.wav")
+file(COPY ${goldens} DESTINATION "${SOURCE_DIR}/Tests/golden")
+foreach(golden ${goldens})
+    get_filename_component(name "${golden}" NAME)
+    message(STATUS "Baseline golden (${BASELINE_REF}): Tests/golden/${name}")
+endforeach()
+
+baseline_worktree_remove("${SOURCE_DIR}" "${worktree}")
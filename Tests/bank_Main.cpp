@@ -0,0 +1,204 @@
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProcessor.h"
+#include "Control/PresetBank.h"
+#include <iostream>
+#include <set>
+#include <vector>
+
+/**
+ * Preset Bank Builder
+ *
+ * Builds a preset bank (Control/PresetBank.h) for the program list from
+ * files, in the order given:
+ *     <name>.dspb     an existing bank: all of its presets, in order
+ *     <name>.txt      one "<parameter id> <value>" per line, real units
+ *                     ('#' starts a comment); others take their defaults
+ *     anything else   plugin state, as saved by getStateInformation()
+ *                     (binary or legacy XML)
+ *
+ * Text and state files are loaded into a fresh processor, so values are
+ * snapped to their parameters' ranges and steps as a session load would.
+ * Each becomes one preset named after the file. With --scenes, a state's
+ * captured scenes follow it as "<name> Scene <n>".
+ *
+ * Names are cut to PresetBank::kNameSize bytes; a duplicate name (after
+ * cutting) is an error, as program lookup by name would be ambiguous.
+ * The output is replaced in one step, so a running plugin that has the
+ * old bank mapped keeps reading it.
+ *
+ * Usage:
+ *     DubSiren_BankBuilder [--scenes] <output.dspb> <input>...
+ */
+
+namespace {
+
+using SimpleSynth::Control::PresetBank;
+using SimpleSynth::Control::kNumParameters;
+using SimpleSynth::Control::kParameterInfo;
+
+bool LoadBank(const juce::File& file, std::vector<PresetBank::Preset>& presets, juce::String& error)
+{
+    juce::MemoryBlock data;
+    PresetBank bank;
+    if (! file.loadFileAsData(data) || ! bank.Open(data.getData(), data.getSize()))
+    {
+        error = "not a readable preset bank";
+        return false;
+    }
+
+    // Columns this build has but the bank lacks take their defaults
+    SimpleSynthProcessor processor;
+    float defaults[kNumParameters];
+    for (size_t i = 0; i < kNumParameters; ++i)
+        defaults[i] = processor.getParameters().getRawParameterValue(kParameterInfo[i].id)->load();
+
+    for (size_t n = 0; n < bank.GetNumPresets(); ++n)
+    {
+        PresetBank::Preset preset;
+        preset.name = std::string(bank.GetName(n));
+        bank.GetValues(n, preset.values.data(), defaults);
+        presets.push_back(preset);
+    }
+    return true;
+}
+
+bool LoadText(const juce::File& file, SimpleSynthProcessor& processor, juce::String& error)
+{
+    juce::StringArray lines;
+    file.readLines(lines);
+
+    for (int lineNumber = 0; lineNumber < lines.size(); ++lineNumber)
+    {
+        const auto line = lines[lineNumber].upToFirstOccurrenceOf("#", false, false).trim();
+        if (line.isEmpty())
+            continue;
+
+        auto tokens = juce::StringArray::fromTokens(line, " \t", "");
+        tokens.removeEmptyStrings();
+
+        auto* parameter = processor.getParameters().getParameter(tokens[0]);
+        if (tokens.size() != 2 || parameter == nullptr)
+        {
+            error = "line " + juce::String(lineNumber + 1) + ": can't parse '" + line + "'";
+            return false;
+        }
+
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(tokens[1].getFloatValue()));
+    }
+    return true;
+}
+
+PresetBank::Preset MakePreset(const juce::String& name, SimpleSynthProcessor& processor)
+{
+    PresetBank::Preset preset;
+    preset.name = name.toStdString();
+    for (size_t i = 0; i < kNumParameters; ++i)
+        preset.values[i] = processor.getParameters().getRawParameterValue(kParameterInfo[i].id)->load();
+    return preset;
+}
+
+bool LoadInput(const juce::File& file, bool withScenes, std::vector<PresetBank::Preset>& presets, juce::String& error)
+{
+    if (! file.existsAsFile())
+    {
+        error = "no such file";
+        return false;
+    }
+
+    if (file.hasFileExtension("dspb"))
+        return LoadBank(file, presets, error);
+
+    SimpleSynthProcessor processor;
+    const auto name = file.getFileNameWithoutExtension();
+
+    if (file.hasFileExtension("txt"))
+    {
+        if (! LoadText(file, processor, error))
+            return false;
+
+        presets.push_back(MakePreset(name, processor));
+        return true;
+    }
+
+    juce::MemoryBlock state;
+    if (! file.loadFileAsData(state) || state.getSize() == 0)
+    {
+        error = "can't read state";
+        return false;
+    }
+
+    processor.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+    presets.push_back(MakePreset(name, processor));
+
+    for (size_t slot = 0; withScenes && slot < SimpleSynthProcessor::kNumSnapshots; ++slot)
+    {
+        PresetBank::Preset scene;
+        if (processor.getSnapshotValues(slot, scene.values))
+        {
+            scene.name = (name + " Scene " + juce::String(static_cast<int>(slot) + 1)).toStdString();
+            presets.push_back(scene);
+        }
+    }
+    return true;
+}
+
+int Usage()
+{
+    std::cerr << "Usage: DubSiren_BankBuilder [--scenes] <output.dspb> <input>...\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int first = 1;
+    const bool withScenes = (argc > 1 && juce::String(argv[1]) == "--scenes");
+    if (withScenes)
+        ++first;
+
+    if (argc - first < 2)
+        return Usage();
+
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const auto workingDirectory = juce::File::getCurrentWorkingDirectory();
+    const auto output = workingDirectory.getChildFile(argv[first]);
+
+    std::vector<PresetBank::Preset> presets;
+    for (int i = first + 1; i < argc; ++i)
+    {
+        const auto input = workingDirectory.getChildFile(argv[i]);
+        juce::String error;
+        if (! LoadInput(input, withScenes, presets, error))
+        {
+            std::cerr << input.getFullPathName() << ": " << error << "\n";
+            return 1;
+        }
+    }
+
+    std::set<std::string> names;
+    for (const auto& preset : presets)
+    {
+        const auto name = preset.name.substr(0, PresetBank::kNameSize);
+        if (! names.insert(name).second)
+        {
+            std::cerr << "Duplicate preset name '" << name << "'\n";
+            return 1;
+        }
+        if (name.size() < preset.name.size())
+            std::cout << "Name cut to '" << name << "'\n";
+    }
+
+    std::vector<uint8_t> data;
+    PresetBank::Write(data, presets);
+
+    if (! output.replaceWithData(data.data(), data.size()))
+    {
+        std::cerr << "Could not write " << output.getFullPathName() << "\n";
+        return 1;
+    }
+
+    std::cout << presets.size() << " preset(s) written to " << output.getFullPathName() << "\n";
+    return 0;
+}
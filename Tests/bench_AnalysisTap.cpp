@@ -0,0 +1,49 @@
+#include <juce_core/juce_core.h>
+#include "Benchmark.h"
+#include "DSP/AnalysisTap.h"
+
+using namespace SimpleSynth::DSP;
+using SimpleSynth::Bench::Benchmark;
+
+/**
+ * Analysis Tap Benchmarks
+ *
+ * Covers the audio thread's share of the editor's scope/spectrum feed:
+ * - Editor closed: the disabled tap (one flag check per block)
+ * - Editor open: decimation and chunk pushes. The ring is drained inside
+ *   the timed block, as the editor's timer would, so the pushes never
+ *   take the cheaper full-ring path; the figure is an upper bound.
+ */
+
+namespace {
+
+class AnalysisTapBenchmark : public Benchmark {
+public:
+    AnalysisTapBenchmark(const std::string& name, bool enabled)
+        : Benchmark(name), enabled_(enabled) {}
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        tap_.Init(sampleRate);
+        tap_.SetEnabled(enabled_);
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        tap_.Process(buffer, numSamples);
+
+        AnalysisTap::Chunk chunk;
+        while (tap_.Pop(chunk)) {
+            lastSample_ = chunk.samples[AnalysisTap::kChunkSize - 1];
+        }
+    }
+
+private:
+    AnalysisTap tap_;
+    bool enabled_;
+    float lastSample_ = 0.0f;
+};
+
+AnalysisTapBenchmark closedBenchmark("AnalysisTap/EditorClosed", false);
+AnalysisTapBenchmark openBenchmark("AnalysisTap/EditorOpen", true);
+
+} // namespace
@@ -0,0 +1,119 @@
+#include <juce_dsp/juce_dsp.h>
+#include "Benchmark.h"
+#include "DSP/DubDelay.h"
+#include "DSP/TapeFeedback.h"
+
+using namespace SimpleSynth::DSP;
+using SimpleSynth::Bench::Benchmark;
+
+/**
+ * Dub Delay Benchmarks
+ *
+ * Covers:
+ * - Single head vs four heads on the shared delay line
+ * - Tape feedback chain inside the loop
+ * - TapeFeedback standalone vs the equivalent juce::dsp chain
+ *   (two first-order TPT filters + std::tanh waveshaper)
+ */
+
+namespace {
+
+constexpr float kLowCut = 120.0f;
+constexpr float kHighCut = 3500.0f;
+constexpr float kDrive = 2.0f;
+
+class DubDelayBenchmark : public Benchmark {
+public:
+    DubDelayBenchmark(const std::string& name, size_t numHeads, bool tape)
+        : Benchmark(name), numHeads_(numHeads), tape_(tape) {}
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        delay_.Init(sampleRate, 2.0f);
+        delay_.SetWetDry(0.5f);
+        delay_.SetDelayTime(0.375f);
+        delay_.SetFeedback(0.6f);
+        delay_.SetNumTaps(numHeads_);
+
+        for (size_t head = 0; head < numHeads_; ++head) {
+            float headTime = 0.375f * static_cast<float>(head + 1) / static_cast<float>(numHeads_);
+            delay_.SetTap(head, headTime, 0.5f, 0.6f / static_cast<float>(numHeads_));
+        }
+
+        delay_.SetTapeEnabled(tape_);
+        delay_.SetTapeTone(kLowCut, kHighCut);
+        delay_.SetTapeDrive(kDrive);
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        delay_.Process(buffer, numSamples);
+    }
+
+private:
+    DubDelay delay_;
+    size_t numHeads_;
+    bool tape_;
+};
+
+class TapeFeedbackBenchmark : public Benchmark {
+public:
+    TapeFeedbackBenchmark() : Benchmark("TapeFeedback/Chain") {}
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        tape_.Init(sampleRate);
+        tape_.SetLowCut(kLowCut);
+        tape_.SetHighCut(kHighCut);
+        tape_.SetDrive(kDrive);
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        tape_.Process(buffer, numSamples);
+    }
+
+private:
+    TapeFeedback tape_;
+};
+
+class JuceTapeChainBenchmark : public Benchmark {
+public:
+    JuceTapeChainBenchmark() : Benchmark("JuceDsp/TapeChain") {}
+
+    bool IsGated() const override { return false; }
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::dsp::ProcessSpec spec{ sampleRate, static_cast<juce::uint32>(blockSize), 1 };
+
+        auto& lowCut = chain_.get<0>();
+        lowCut.setType(juce::dsp::FirstOrderTPTFilterType::highpass);
+        lowCut.setCutoffFrequency(kLowCut);
+
+        auto& highCut = chain_.get<1>();
+        highCut.setType(juce::dsp::FirstOrderTPTFilterType::lowpass);
+        highCut.setCutoffFrequency(kHighCut);
+
+        chain_.get<2>().functionToUse = [](float x) { return std::tanh(x * kDrive) / kDrive; };
+
+        chain_.prepare(spec);
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        float* channels[] = { buffer };
+        juce::dsp::AudioBlock<float> block(channels, 1, numSamples);
+        chain_.process(juce::dsp::ProcessContextReplacing<float>(block));
+    }
+
+private:
+    juce::dsp::ProcessorChain<juce::dsp::FirstOrderTPTFilter<float>,
+                              juce::dsp::FirstOrderTPTFilter<float>,
+                              juce::dsp::WaveShaper<float>> chain_;
+};
+
+DubDelayBenchmark singleHeadBenchmark("DubDelay/SingleHead", 1, false);
+DubDelayBenchmark fourHeadBenchmark("DubDelay/FourHeads", 4, false);
+DubDelayBenchmark singleHeadTapeBenchmark("DubDelay/SingleHeadTape", 1, true);
+DubDelayBenchmark fourHeadTapeBenchmark("DubDelay/FourHeadsTape", 4, true);
+TapeFeedbackBenchmark tapeFeedbackBenchmark;
+JuceTapeChainBenchmark juceTapeChainBenchmark;
+
+} // namespace
@@ -0,0 +1,100 @@
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+#include <BinaryData.h>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+/**
+ * Editor Open Benchmark
+ *
+ * Times opening the editor: construction plus its first full paint
+ * (rendered offscreen), with the shared resources already in place as
+ * they are once the plugin has loaded. For comparison it also times the
+ * work each open used to do inline: a synchronous panel decode and nine
+ * knob look-and-feels, and reports how long the background decode took.
+ *
+ * Built with DUBSIREN_EDITOR_BASELINE=1 it only times the open, so the
+ * same file builds against the editor from before the shared resources;
+ * the compare_editor_baseline target does that and runs both.
+ *
+ * Separate from DubSiren_Benchmarks (which reports ns/sample) and not
+ * part of the perf gate. Needs a display on Linux.
+ *
+ * Usage:
+ *     DubSiren_EditorBenchmark [opens]     default 50
+ */
+
+namespace {
+
+constexpr int kNumRuns = 5;
+
+template <typename Function>
+double BestMilliseconds(int count, Function&& function) {
+    double best = 0.0;
+    for (int run = 0; run < kNumRuns; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i)
+            function();
+        const auto end = std::chrono::steady_clock::now();
+
+        const double milliseconds = std::chrono::duration<double, std::milli>(end - start).count()
+                                  / static_cast<double>(count);
+        if (run == 0 || milliseconds < best)
+            best = milliseconds;
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const int numOpens = argc > 1 ? juce::jmax(1, juce::String(argv[1]).getIntValue()) : 50;
+
+    SimpleSynthProcessor processor;
+#if ! DUBSIREN_EDITOR_BASELINE
+    // Plugin load starts the panel decode; wait for it as a host would
+    // have by the time a user opens the editor
+    juce::SharedResourcePointer<EditorResources> resources;
+    while (! resources->isPanelDecoded())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+
+    const double openMilliseconds = BestMilliseconds(numOpens, [&processor] {
+        std::unique_ptr<juce::AudioProcessorEditor> editor(processor.createEditor());
+        const auto snapshot = editor->createComponentSnapshot(editor->getLocalBounds());
+        juce::ignoreUnused(snapshot);
+    });
+
+#if DUBSIREN_EDITOR_BASELINE
+    std::cout << std::fixed << std::setprecision(2)
+              << "Editor/Open              " << std::setw(8) << openMilliseconds << " ms  (create + first paint, baseline editor)\n"
+              << numOpens << " opens, best of " << kNumRuns << " runs\n";
+#else
+
+    // What every cold open did before the resources were shared
+    const double inlineMilliseconds = BestMilliseconds(numOpens, [] {
+        const auto panel = juce::ImageFileFormat::loadFrom(BinaryData::panel_jpg, BinaryData::panel_jpgSize);
+        std::array<std::unique_ptr<juce::LookAndFeel_V4>, 9> lookAndFeels;
+        for (auto& lookAndFeel : lookAndFeels)
+            lookAndFeel = std::make_unique<juce::LookAndFeel_V4>();
+        juce::ignoreUnused(panel);
+    });
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Editor/Open              " << std::setw(8) << openMilliseconds << " ms  (create + first paint)\n"
+              << "Editor/InlineDecodeLnF   " << std::setw(8) << inlineMilliseconds << " ms  (previously per cold open)\n"
+              << "Editor/BackgroundDecode  " << std::setw(8) << resources->getPanelDecodeMilliseconds()
+              << " ms  (once per process, off the message thread)\n"
+              << numOpens << " opens, best of " << kNumRuns << " runs\n";
+#endif
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "Benchmark.h"
+#include "DSP/FdnReverb.h"
+
+using namespace SimpleSynth::DSP;
+using SimpleSynth::Bench::Benchmark;
+
+/**
+ * FDN Reverb Benchmarks
+ *
+ * Covers:
+ * - The eight-line network at the smallest and largest size (the
+ *   budget: below SirenCore/1x, the oscillator path it follows)
+ * - Mix 0, the default: the bypass check alone
+ * - juce::Reverb (Freeverb: eight combs + four allpasses) in mono, for
+ *   reference
+ */
+
+namespace {
+
+class FdnReverbBenchmark : public Benchmark {
+public:
+    FdnReverbBenchmark(const std::string& name, float size, float mix)
+        : Benchmark(name), size_(size), mix_(mix) {}
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        reverb_.Init(sampleRate);
+        reverb_.SetSize(size_);
+        reverb_.SetDecay(2.0f);
+        reverb_.SetDamping(0.4f);
+        reverb_.SetMix(mix_);
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        reverb_.Process(buffer, numSamples);
+    }
+
+private:
+    FdnReverb reverb_;
+    float size_;
+    float mix_;
+};
+
+class JuceReverbBenchmark : public Benchmark {
+public:
+    JuceReverbBenchmark() : Benchmark("JuceDsp/Reverb") {}
+
+    bool IsGated() const override { return false; }
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        juce::Reverb::Parameters parameters;
+        parameters.roomSize = 0.5f;
+        parameters.damping = 0.4f;
+        parameters.wetLevel = 0.3f;
+        parameters.dryLevel = 0.7f;
+        reverb_.setParameters(parameters);
+        reverb_.setSampleRate(sampleRate);
+        reverb_.reset();
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        reverb_.processMono(buffer, static_cast<int>(numSamples));
+    }
+
+private:
+    juce::Reverb reverb_;
+};
+
+FdnReverbBenchmark smallReverbBenchmark("FdnReverb/Size0", 0.0f, 0.3f);
+FdnReverbBenchmark largeReverbBenchmark("FdnReverb/Size1", 1.0f, 0.3f);
+FdnReverbBenchmark bypassedReverbBenchmark("FdnReverb/Bypassed", 0.5f, 0.0f);
+JuceReverbBenchmark juceReverbBenchmark;
+
+} // namespace
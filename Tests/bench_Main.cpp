@@ -0,0 +1,351 @@
+#include <juce_core/juce_core.h>
+#include "Benchmark.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * Benchmark Runner Main
+ *
+ * Runs every registered Benchmark and prints ns/sample per benchmark.
+ * Each benchmark renders one second of audio in host-sized blocks;
+ * the best of several runs is reported to filter scheduler noise.
+ *
+ * Benchmarks are defined in separate files:
+ * - bench_DubDelay.cpp
+ * - bench_SirenCore.cpp
+ * - bench_AnalysisTap.cpp
+ * - bench_FdnReverb.cpp
+ * - bench_PartitionedConvolver.cpp
+ * - bench_ResonantFilter.cpp
+ *
+ * Each benchmark is also reported relative to a fixed reference workload
+ * (a biquad cascade, plain scalar float code like most of the DSP)
+ * timed in runs interleaved with its own. The ratio cancels most of the
+ * machine's speed and clock scaling, so baselines hold ratios and the
+ * gate isn't tied to one machine.
+ *
+ * Usage:
+ *     DubSiren_Benchmarks [name-filter]
+ *     DubSiren_Benchmarks --check <baselines> [--tolerance 0.5] [name-filter]
+ *     DubSiren_Benchmarks --update <baselines> [name-filter]
+ *
+ * --check fails (exit 1) when a benchmark's ratio exceeds its baseline by
+ * more than the tolerance (a fraction, 0.5 = 50%) in each of three
+ * measurements, so one noisy process doesn't fail the gate. A benchmark
+ * missing from the baselines fails it too, so new benchmarks can't slip
+ * past the gate unmeasured. --update rewrites the measured entries of
+ * the baseline file with the median of three measurements. Comparison benchmarks (Benchmark::IsGated()) are reported
+ * only. Timings of unoptimised code mean nothing, so without NDEBUG
+ * --check and --update exit 77 (skipped).
+ */
+
+using SimpleSynth::Bench::Benchmark;
+
+namespace {
+
+constexpr float kSampleRate = 48000.0f;
+constexpr size_t kBlockSize = 256;
+constexpr size_t kBlocksPerRun = 188; // ~1 second at 48 kHz
+constexpr int kNumRuns = 7;
+constexpr size_t kNumMeasurements = 3;
+constexpr double kDefaultTolerance = 0.5;
+constexpr int kSkipReturnCode = 77;
+
+enum class Mode { Report, Check, Update };
+
+// The yardstick: four cascaded biquads (direct form I), which no
+// optimisation in this repo touches. Registered like the others, but
+// measured with each of them rather than on its own.
+class ReferenceBenchmark : public Benchmark {
+public:
+    ReferenceBenchmark() : Benchmark("Reference/Biquads") {}
+
+    bool IsGated() const override { return false; }
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(sampleRate, blockSize);
+        state_ = {};
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        // 1 kHz low-pass, Q 0.7, at 48 kHz
+        const float b0 = 0.0036f, b1 = 0.0072f, b2 = 0.0036f, a1 = -1.8227f, a2 = 0.8372f;
+        for (auto& stage : state_) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                const float x = buffer[i];
+                const float y = b0 * x + b1 * stage[0] + b2 * stage[1] - a1 * stage[2] - a2 * stage[3];
+                stage[1] = stage[0];
+                stage[0] = x;
+                stage[3] = stage[2];
+                stage[2] = y;
+                buffer[i] = y;
+            }
+        }
+    }
+
+private:
+    std::array<std::array<float, 4>, 4> state_ {};   // x1, x2, y1, y2 per stage
+};
+
+ReferenceBenchmark referenceBenchmark;
+
+// One run: a second of audio in host-sized blocks, as ns/sample
+double TimeRun(Benchmark& benchmark, const std::vector<float>& noise, std::vector<float>& block) {
+    double elapsedNs = 0.0;
+
+    for (size_t b = 0; b < kBlocksPerRun; ++b) {
+        std::copy(noise.begin(), noise.end(), block.begin());
+
+        auto start = std::chrono::steady_clock::now();
+        benchmark.ProcessBlock(block.data(), kBlockSize);
+        auto end = std::chrono::steady_clock::now();
+
+        elapsedNs += std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    return elapsedNs / static_cast<double>(kBlocksPerRun * kBlockSize);
+}
+
+// Best ns/sample of the benchmark and of the reference, their runs
+// interleaved so both see the same clock speed and machine load
+double MeasureRatio(Benchmark& benchmark, const std::vector<float>& noise, double& nsPerSample) {
+    benchmark.Prepare(kSampleRate, kBlockSize);
+    referenceBenchmark.Prepare(kSampleRate, kBlockSize);
+
+    std::vector<float> block(kBlockSize);
+    double bestNsPerSample = 0.0;
+    double bestReferenceNsPerSample = 0.0;
+
+    for (int run = 0; run < kNumRuns; ++run) {
+        const double referenceNsPerSample = TimeRun(referenceBenchmark, noise, block);
+        const double runNsPerSample = TimeRun(benchmark, noise, block);
+
+        // First run is warm-up (caches, page faults)
+        if (run == 1 || (run > 1 && runNsPerSample < bestNsPerSample))
+            bestNsPerSample = runNsPerSample;
+        if (run == 1 || (run > 1 && referenceNsPerSample < bestReferenceNsPerSample))
+            bestReferenceNsPerSample = referenceNsPerSample;
+    }
+
+    nsPerSample = bestNsPerSample;
+    return bestNsPerSample / bestReferenceNsPerSample;
+}
+
+// Baseline file: "<name> <ratio to reference>" per line, '#' starts a comment
+std::map<std::string, double> LoadBaselines(const std::string& path) {
+    std::map<std::string, double> baselines;
+    std::ifstream file(path);
+    std::string line;
+
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream fields(line);
+        std::string name;
+        double ratio = 0.0;
+        if (fields >> name >> ratio)
+            baselines[name] = ratio;
+    }
+
+    return baselines;
+}
+
+bool SaveBaselines(const std::string& path, const std::map<std::string, double>& baselines) {
+    std::ofstream file(path, std::ios::trunc);
+    if (! file.is_open())
+        return false;
+
+    file << "# DubSiren benchmark baselines: <name> <ns/sample as a multiple of\n"
+         << "# Reference/Biquads timed alongside it>, each the median of "
+         << kNumMeasurements << "\n# measurements (best of " << kNumRuns << " runs each).\n"
+         << "# Refresh (Release build) after an intended change in cost with:\n"
+         << "#     cmake --build <build> --config Release --target update_perf_baselines\n";
+
+    for (const auto& [name, ratio] : baselines)
+        file << name << " " << std::fixed << std::setprecision(4) << ratio << "\n";
+
+    return true;
+}
+
+int Usage() {
+    std::cerr << "Usage: DubSiren_Benchmarks [--check <baselines> [--tolerance <fraction>] | "
+                 "--update <baselines>] [name-filter]\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Mode mode = Mode::Report;
+    std::string baselinePath;
+    double tolerance = kDefaultTolerance;
+    juce::String filter;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg(argv[i]);
+
+        if ((arg == "--check" || arg == "--update") && i + 1 < argc)
+        {
+            mode = (arg == "--check") ? Mode::Check : Mode::Update;
+            baselinePath = argv[++i];
+        }
+        else if (arg == "--tolerance" && i + 1 < argc)
+        {
+            tolerance = std::atof(argv[++i]);
+        }
+        else if (arg.rfind("--", 0) == 0)
+        {
+            return Usage();
+        }
+        else
+        {
+            filter = juce::String(argv[i]);
+        }
+    }
+
+    // Fixed-seed noise so every run sees the same input
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    std::vector<float> noise(kBlockSize);
+    for (auto& sample : noise)
+        sample = dist(rng);
+
+#ifndef NDEBUG
+    if (mode != Mode::Report)
+    {
+        std::cout << "Unoptimised build: perf gate skipped (build in Release)\n";
+        return kSkipReturnCode;
+    }
+#endif
+
+    auto baselines = (mode == Mode::Report) ? std::map<std::string, double>() : LoadBaselines(baselinePath);
+
+    if (mode == Mode::Check && baselines.empty())
+    {
+        std::cerr << "No baselines in " << baselinePath << "\n";
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(40) << "Benchmark" << "ns/sample  x ref";
+    if (mode == Mode::Check)
+        std::cout << "   baseline   change";
+    std::cout << "\n-------------------------------------------------------";
+    if (mode == Mode::Check)
+        std::cout << "--------------------";
+    std::cout << "\n";
+
+    int numRegressions = 0;
+    int numMissing = 0;
+
+    for (auto* benchmark : Benchmark::GetRegistry())
+    {
+        if (benchmark == &referenceBenchmark)
+            continue;
+        if (filter.isNotEmpty() && ! juce::String(benchmark->GetName()).contains(filter))
+            continue;
+
+        const bool gated = benchmark->IsGated();
+        const auto baseline = baselines.find(benchmark->GetName());
+        const bool hasBaseline = (gated && mode == Mode::Check && baseline != baselines.end());
+        const double limit = hasBaseline ? baseline->second * (1.0 + tolerance) : 0.0;
+
+        double nsPerSample = 0.0;
+        double ratio = MeasureRatio(*benchmark, noise, nsPerSample);
+
+        // A baseline is the median of several measurements, not one lucky
+        // or unlucky process
+        if (mode == Mode::Update && gated)
+        {
+            std::array<std::pair<double, double>, kNumMeasurements> measurements;
+            measurements[0] = { ratio, nsPerSample };
+            for (size_t m = 1; m < measurements.size(); ++m)
+                measurements[m].first = MeasureRatio(*benchmark, noise, measurements[m].second);
+
+            std::sort(measurements.begin(), measurements.end());
+            std::tie(ratio, nsPerSample) = measurements[measurements.size() / 2];
+        }
+
+        // Confirm a regression with further measurements before failing
+        for (size_t m = 1; hasBaseline && ratio > limit && m < kNumMeasurements; ++m)
+        {
+            double retryNsPerSample = 0.0;
+            const double retryRatio = MeasureRatio(*benchmark, noise, retryNsPerSample);
+            if (retryRatio < ratio)
+            {
+                ratio = retryRatio;
+                nsPerSample = retryNsPerSample;
+            }
+        }
+
+        std::cout << std::left << std::setw(40) << benchmark->GetName()
+                  << std::fixed << std::setprecision(3) << std::setw(11) << nsPerSample
+                  << std::setw(8) << ratio;
+
+        if (mode == Mode::Update && gated)
+            baselines[benchmark->GetName()] = ratio;
+
+        if (mode != Mode::Report && ! gated)
+            std::cout << "   (comparison, not gated)";
+
+        if (mode == Mode::Check && gated && ! hasBaseline)
+        {
+            std::cout << "   NO BASELINE";
+            ++numMissing;
+        }
+
+        if (hasBaseline)
+        {
+            const double change = ratio / baseline->second - 1.0;
+            std::cout << "   " << std::setw(9) << baseline->second << std::right
+                      << std::showpos << std::setprecision(1) << std::setw(6) << change * 100.0
+                      << "%" << std::noshowpos;
+
+            if (ratio > limit)
+            {
+                std::cout << "  REGRESSION";
+                ++numRegressions;
+            }
+            else if (change < -tolerance)
+            {
+                std::cout << "  faster, consider refreshing baselines";
+            }
+        }
+
+        std::cout << "\n";
+    }
+
+    if (mode == Mode::Update)
+    {
+        if (! SaveBaselines(baselinePath, baselines))
+        {
+            std::cerr << "Could not write " << baselinePath << "\n";
+            return 1;
+        }
+        std::cout << "\nBaselines written to " << baselinePath << "\n";
+    }
+
+    if (mode == Mode::Check)
+    {
+        std::cout << "\n" << numRegressions << " regression(s) beyond "
+                  << std::setprecision(0) << tolerance * 100.0 << "% tolerance, "
+                  << numMissing << " benchmark(s) without a baseline\n";
+        return (numRegressions == 0 && numMissing == 0) ? 0 : 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <juce_core/juce_core.h>
+#include "Benchmark.h"
+#include "DSP/ResonantFilter.h"
+#include <cmath>
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+using SimpleSynth::Bench::Benchmark;
+
+/**
+ * Resonant Filter Benchmarks
+ *
+ * Covers:
+ * - A static cutoff: the filter alone, targets unchanged
+ * - An LFO-swept cutoff with a new target every 8 samples (the Live
+ *   tier's control interval): should cost about the same as static
+ * - The same sweep with tan() and the coefficients every sample, for
+ *   what the control-rate ramp saves
+ *
+ * The sweep is a precomputed table (one second, per sample), so the LFO
+ * itself isn't measured.
+ */
+
+namespace {
+
+constexpr size_t kControlInterval = 8;
+
+// One second of a 2 Hz sweep over +-2 octaves around 1 kHz
+std::vector<float> MakeSweep(float sampleRate) {
+    std::vector<float> sweep(static_cast<size_t>(sampleRate));
+    for (size_t i = 0; i < sweep.size(); ++i) {
+        sweep[i] = 1000.0f * std::exp2(2.0f * std::sin(kTwoPi * 2.0f * static_cast<float>(i) / sampleRate));
+    }
+    return sweep;
+}
+
+class FilterBenchmark : public Benchmark {
+public:
+    FilterBenchmark(const std::string& name, bool swept)
+        : Benchmark(name), swept_(swept) {}
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        filter_.Init(sampleRate);
+        filter_.SetMode(ResonantFilter::Mode::LowPass);
+        filter_.SetTarget(1000.0f, 0.7f, 0);
+        sweep_ = MakeSweep(sampleRate);
+        position_ = 0;
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        for (size_t offset = kControlInterval; swept_ && offset <= numSamples; offset += kControlInterval) {
+            filter_.SetTarget(sweep_[(position_ + offset) % sweep_.size()], 0.7f, offset);
+        }
+        position_ += numSamples;
+        filter_.Process(buffer, numSamples);
+    }
+
+private:
+    ResonantFilter filter_;
+    bool swept_;
+    std::vector<float> sweep_;
+    size_t position_ = 0;
+};
+
+// The same filter with exact coefficients every sample
+class PerSampleTanBenchmark : public Benchmark {
+public:
+    PerSampleTanBenchmark() : Benchmark("Filter/PerSampleTan") {}
+
+    bool IsGated() const override { return false; }
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        juce::ignoreUnused(blockSize);
+        sampleRate_ = sampleRate;
+        sweep_ = MakeSweep(sampleRate);
+        position_ = 0;
+        ic1_ = 0.0f;
+        ic2_ = 0.0f;
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        const float k = 2.0f - 1.9f * 0.7f;
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float cutoff = sweep_[(position_ + i) % sweep_.size()];
+            const float g = std::tan(kPi * cutoff / sampleRate_);
+            const float a1 = 1.0f / (1.0f + g * (g + k));
+            const float a2 = g * a1;
+            const float a3 = g * a2;
+
+            const float v3 = buffer[i] - ic2_;
+            const float v1 = a1 * ic1_ + a2 * v3;
+            const float v2 = ic2_ + a2 * ic1_ + a3 * v3;
+            ic1_ = 2.0f * v1 - ic1_;
+            ic2_ = 2.0f * v2 - ic2_;
+            buffer[i] = v2;
+        }
+        position_ += numSamples;
+    }
+
+private:
+    float sampleRate_ = 48000.0f;
+    std::vector<float> sweep_;
+    size_t position_ = 0;
+    float ic1_ = 0.0f;
+    float ic2_ = 0.0f;
+};
+
+FilterBenchmark staticFilterBenchmark("Filter/Static", false);
+FilterBenchmark sweptFilterBenchmark("Filter/Swept", true);
+PerSampleTanBenchmark perSampleTanBenchmark;
+
+} // namespace
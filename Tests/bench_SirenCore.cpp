@@ -0,0 +1,83 @@
+#include <juce_core/juce_core.h>
+#include "Benchmark.h"
+#include "DSP/DubOscillator.h"
+#include "DSP/Envelope.h"
+#include "DSP/LFO.h"
+#include "DSP/Oversampler.h"
+
+using namespace SimpleSynth::DSP;
+using SimpleSynth::Bench::Benchmark;
+
+/**
+ * Siren Core Benchmarks
+ *
+ * Renders the generation stage the way SimpleSynthProcessor::renderSiren
+ * does (LFO -> VCO rate, envelope, VCO) at each oversampling setting.
+ * ns/sample is per host-rate output sample, including decimation.
+ */
+
+namespace {
+
+class SirenCoreBenchmark : public Benchmark {
+public:
+    SirenCoreBenchmark(const std::string& name, size_t factor, bool vcoOnly)
+        : Benchmark(name), factor_(factor), vcoOnly_(vcoOnly) {}
+
+    void Prepare(float sampleRate, size_t blockSize) override {
+        const float coreRate = sampleRate * static_cast<float>(factor_);
+        const float modulationRate = vcoOnly_ ? sampleRate : coreRate;
+
+        oscillator_.Init(coreRate);
+        lfo_.Init(modulationRate);
+        envelope_.Init(modulationRate);
+        lfo_.SetRate(6.0f);
+        envelope_.NoteOn();
+
+        oversampler_.Init(blockSize);
+        oversampler_.SetFactor(factor_);
+    }
+
+    void ProcessBlock(float* buffer, size_t numSamples) override {
+        float* oversampled = oversampler_.GetBuffer();
+
+        if (vcoOnly_) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                Modulate();
+                const float envelope = envelope_.ProcessSample();
+                for (size_t k = 0; k < factor_; ++k) {
+                    oversampled[i * factor_ + k] = oscillator_.ProcessSample() * envelope;
+                }
+            }
+            oversampler_.Downsample(buffer, numSamples);
+            return;
+        }
+
+        const size_t numOversampled = numSamples * factor_;
+        for (size_t i = 0; i < numOversampled; ++i) {
+            Modulate();
+            oversampled[i] = oscillator_.ProcessSample() * envelope_.ProcessSample();
+        }
+        oversampler_.Downsample(buffer, numSamples);
+    }
+
+private:
+    void Modulate() {
+        float lfoValue = lfo_.ProcessSample();
+        oscillator_.SetFrequency(880.0f * (1.0f + lfoValue * 0.5f));
+    }
+
+    DubOscillator oscillator_;
+    LFO lfo_;
+    Envelope envelope_;
+    Oversampler oversampler_;
+    size_t factor_;
+    bool vcoOnly_;
+};
+
+SirenCoreBenchmark sirenCore1x("SirenCore/1x", 1, false);
+SirenCoreBenchmark sirenCore2x("SirenCore/2x", 2, false);
+SirenCoreBenchmark sirenCore4x("SirenCore/4x", 4, false);
+SirenCoreBenchmark sirenCore2xVco("SirenCore/2xVcoOnly", 2, true);
+SirenCoreBenchmark sirenCore4xVco("SirenCore/4xVcoOnly", 4, true);
+
+} // namespace
@@ -0,0 +1,164 @@
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProcessor.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/**
+ * Session Load Benchmark
+ *
+ * Compares the binary state format with the legacy XML state it
+ * replaced: blob size, and setStateInformation() time per instance when
+ * a session reopens many instances. Both blobs describe the same busy
+ * patch (moved knobs, MIDI mappings, a tuning, matrix routes, snapshots);
+ * the legacy one is built the way older builds wrote it, so this also
+ * checks that both load to identical parameters.
+ *
+ * Separate from DubSiren_Benchmarks (which reports ns/sample) and not
+ * part of the perf gate.
+ *
+ * Usage:
+ *     DubSiren_StateBenchmark [instances]     default 200
+ */
+
+namespace {
+
+constexpr int kNumRuns = 5;
+
+void SetParameter(SimpleSynthProcessor& processor, const char* id, float value) {
+    auto* parameter = processor.getParameters().getParameter(id);
+    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+}
+
+void MakeBusyPatch(SimpleSynthProcessor& processor) {
+    using SimpleSynth::DSP::ModMatrix;
+    using SimpleSynth::Control::ParamIndex;
+
+    SetParameter(processor, "vcoRate", 660.0f);
+    SetParameter(processor, "delayTime", 0.5f);
+    SetParameter(processor, "delayHeads", 3.0f);
+    SetParameter(processor, "lfo1Target", 1.0f);
+    SetParameter(processor, "glide", 0.1f);
+
+    processor.getMidiMapping().Map(1, ParamIndex::VcoRate);
+    processor.getMidiMapping().Map(74, ParamIndex::DelayFeedback);
+    processor.loadTuningScale("Pentatonic\n5\n9/8\n5/4\n3/2\n5/3\n2/1\n", "Pentatonic");
+    processor.setModulationSlot(0, { ModMatrix::Source::Envelope, ModMatrix::Destination::DelayWetDry, 0.5f });
+    processor.setModulationSlot(1, { ModMatrix::Source::ModWheel, ModMatrix::Destination::Lfo1Rate, -0.3f });
+
+    for (size_t slot = 0; slot < 4; ++slot) {
+        SetParameter(processor, "delayFeedback", 0.2f * static_cast<float>(slot));
+        processor.captureSnapshot(slot);
+    }
+}
+
+// The same patch as older builds saved it: the APVTS tree plus XML children.
+// Written out by hand to pin that format; the processor only reads it now.
+juce::MemoryBlock MakeLegacyBlob(SimpleSynthProcessor& processor) {
+    auto state = processor.getParameters().copyState();
+
+    juce::ValueTree mappings("MIDI_MAPPINGS");
+    mappings.appendChild(juce::ValueTree("MAP", { { "source", 1 }, { "param", "vcoRate" } }), nullptr);
+    mappings.appendChild(juce::ValueTree("MAP", { { "source", 74 }, { "param", "delayFeedback" } }), nullptr);
+    state.appendChild(mappings, nullptr);
+
+    juce::ValueTree tuning("TUNING");
+    tuning.setProperty("scale", "Pentatonic\n5\n9/8\n5/4\n3/2\n5/3\n2/1\n", nullptr);
+    tuning.setProperty("scaleName", "Pentatonic", nullptr);
+    state.appendChild(tuning, nullptr);
+
+    juce::ValueTree modulation("MOD_MATRIX");
+    modulation.appendChild(juce::ValueTree("SLOT", { { "index", 0 }, { "source", "envelope" },
+                                                     { "destination", "delayWetDry" }, { "depth", 0.5f } }), nullptr);
+    modulation.appendChild(juce::ValueTree("SLOT", { { "index", 1 }, { "source", "modWheel" },
+                                                     { "destination", "lfo1Rate" }, { "depth", -0.3f } }), nullptr);
+    state.appendChild(modulation, nullptr);
+
+    juce::ValueTree snapshots("SNAPSHOTS");
+    for (int slot = 0; slot < 4; ++slot) {
+        juce::ValueTree entry("SNAPSHOT");
+        entry.setProperty("slot", slot, nullptr);
+        for (const auto& info : SimpleSynth::Control::kParameterInfo)
+            entry.setProperty(info.id, processor.getParameters().getRawParameterValue(info.id)->load(), nullptr);
+        entry.setProperty("delayFeedback", 0.2f * static_cast<float>(slot), nullptr);
+        snapshots.appendChild(entry, nullptr);
+    }
+    state.appendChild(snapshots, nullptr);
+
+    juce::MemoryBlock blob;
+    std::unique_ptr<juce::XmlElement> xml(state.createXml());
+    juce::AudioProcessor::copyXmlToBinary(*xml, blob);
+    return blob;
+}
+
+// Best-of-runs microseconds per setStateInformation() call
+double MeasureLoad(const juce::MemoryBlock& blob, std::vector<std::unique_ptr<SimpleSynthProcessor>>& instances) {
+    double best = 0.0;
+
+    for (int run = 0; run < kNumRuns; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        for (auto& instance : instances)
+            instance->setStateInformation(blob.getData(), static_cast<int>(blob.getSize()));
+        const auto end = std::chrono::steady_clock::now();
+
+        const double microseconds = std::chrono::duration<double, std::micro>(end - start).count()
+                                  / static_cast<double>(instances.size());
+        if (run == 0 || microseconds < best)
+            best = microseconds;
+    }
+
+    return best;
+}
+
+bool SameParameters(SimpleSynthProcessor& a, SimpleSynthProcessor& b) {
+    for (const auto& info : SimpleSynth::Control::kParameterInfo)
+        if (a.getParameters().getRawParameterValue(info.id)->load() != b.getParameters().getRawParameterValue(info.id)->load()) {
+            std::cerr << "Mismatch in " << info.id << "\n";
+            return false;
+        }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const int numInstances = argc > 1 ? juce::jmax(1, juce::String(argv[1]).getIntValue()) : 200;
+
+    SimpleSynthProcessor source;
+    MakeBusyPatch(source);
+
+    juce::MemoryBlock binaryBlob;
+    source.getStateInformation(binaryBlob);
+    const auto legacyBlob = MakeLegacyBlob(source);
+
+    // Instances are built up front: only the state load is timed
+    std::vector<std::unique_ptr<SimpleSynthProcessor>> instances;
+    for (int i = 0; i < numInstances; ++i)
+        instances.push_back(std::make_unique<SimpleSynthProcessor>());
+
+    const double legacyMicroseconds = MeasureLoad(legacyBlob, instances);
+    SimpleSynthProcessor fromLegacy;
+    fromLegacy.setStateInformation(legacyBlob.getData(), static_cast<int>(legacyBlob.getSize()));
+
+    const double binaryMicroseconds = MeasureLoad(binaryBlob, instances);
+    SimpleSynthProcessor fromBinary;
+    fromBinary.setStateInformation(binaryBlob.getData(), static_cast<int>(binaryBlob.getSize()));
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "State/LegacyXml  " << std::setw(6) << legacyBlob.getSize() << " bytes  "
+              << std::setw(8) << legacyMicroseconds << " us/instance\n"
+              << "State/Binary     " << std::setw(6) << binaryBlob.getSize() << " bytes  "
+              << std::setw(8) << binaryMicroseconds << " us/instance\n"
+              << numInstances << " instances, best of " << kNumRuns << " runs\n";
+
+    if (! SameParameters(fromLegacy, fromBinary) || ! SameParameters(source, fromBinary))
+        return 1;
+
+    return 0;
+}
@@ -0,0 +1,442 @@
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_dsp/juce_dsp.h>
+#include "PluginProcessor.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/**
+ * Golden-Render Regression Harness
+ *
+ * Renders every Tests/golden/<name>.script through a full
+ * SimpleSynthProcessor and compares the result with <name>.wav.
+ * Renders are deterministic: offline mode (so the CPU governor never
+ * switches tiers), fixed block size, and the oscillator's seeded noise.
+ *
+ * Script format, one command per line ('#' starts a comment):
+ *     length <seconds>
+ *     seed <n>                        VCO noise seed (default: the oscillator's)
+ *     param <id> <value>              set before rendering (real units)
+ *     at <seconds> param <id> <value> automation, applied from that block on
+ *     at <seconds> noteOn <note> <velocity 0-1>
+ *     at <seconds> noteOff <note>
+ *     tolerance rmsErrorDb <dB>       override a default tolerance
+ *     tolerance spectralDb <dB>
+ *
+ * Metrics per script:
+ * - Max absolute sample error
+ * - RMS error relative to the golden's RMS, in dB
+ * - Log-spectral distance: RMS over STFT frames and bins of the dB
+ *   difference between magnitude spectra (bins within 100 dB of the
+ *   frame peak only)
+ *
+ * A render passes when both the RMS error and the spectral distance are
+ * within tolerance. Optimisations that only shift phase (control-rate
+ * modulation, different filter structures) show up as a large sample
+ * error but a small spectral distance; such scripts may relax
+ * rmsErrorDb and rely on spectralDb.
+ *
+ * Usage:
+ *     DubSiren_GoldenTests --check <golden-dir>
+ *     DubSiren_GoldenTests --update <golden-dir>   (re)write every <name>.wav
+ *
+ * --check fails (exit 1) when a render is out of tolerance or a script has
+ * no golden, so a new script can't pass without its reference render.
+ */
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kBlockSize = 128;
+
+constexpr double kDefaultRmsErrorDb = -60.0;
+constexpr double kDefaultSpectralDb = 1.0;
+
+constexpr int kFftOrder = 11;
+constexpr int kFftSize = 1 << kFftOrder;
+constexpr int kFftHop = kFftSize / 2;
+
+struct ScriptEvent {
+    int samplePosition = 0;
+    enum class Type { Param, NoteOn, NoteOff } type = Type::Param;
+    juce::String parameterId;
+    float value = 0.0f;
+    int note = 0;
+};
+
+struct Script {
+    juce::String name;
+    int numSamples = 0;
+    uint32_t noiseSeed = 0; // 0 = oscillator default
+    std::vector<ScriptEvent> events; // sorted by samplePosition
+    double rmsErrorDb = kDefaultRmsErrorDb;
+    double spectralDb = kDefaultSpectralDb;
+};
+
+struct Metrics {
+    double maxError = 0.0;
+    double rmsErrorDb = -200.0;
+    double spectralDb = 0.0;
+};
+
+int SecondsToSamples(double seconds)
+{
+    return juce::roundToInt(seconds * kSampleRate);
+}
+
+bool ParseScript(const juce::File& file, Script& script, juce::String& error)
+{
+    script.name = file.getFileNameWithoutExtension();
+
+    juce::StringArray lines;
+    file.readLines(lines);
+
+    for (int lineNumber = 0; lineNumber < lines.size(); ++lineNumber)
+    {
+        auto line = lines[lineNumber].upToFirstOccurrenceOf("#", false, false).trim();
+        if (line.isEmpty())
+            continue;
+
+        auto tokens = juce::StringArray::fromTokens(line, " \t", "");
+        tokens.removeEmptyStrings();
+
+        ScriptEvent event;
+        int first = 0;
+
+        if (tokens[0] == "length" && tokens.size() == 2)
+        {
+            script.numSamples = SecondsToSamples(tokens[1].getDoubleValue());
+            continue;
+        }
+
+        if (tokens[0] == "seed" && tokens.size() == 2)
+        {
+            script.noiseSeed = static_cast<uint32_t>(tokens[1].getLargeIntValue());
+            continue;
+        }
+
+        if (tokens[0] == "tolerance" && tokens.size() == 3)
+        {
+            if (tokens[1] == "rmsErrorDb")       script.rmsErrorDb = tokens[2].getDoubleValue();
+            else if (tokens[1] == "spectralDb")  script.spectralDb = tokens[2].getDoubleValue();
+            else { error = "unknown tolerance '" + tokens[1] + "'"; return false; }
+            continue;
+        }
+
+        if (tokens[0] == "at" && tokens.size() >= 3)
+        {
+            event.samplePosition = SecondsToSamples(tokens[1].getDoubleValue());
+            first = 2;
+        }
+
+        const auto command = tokens[first];
+        const int numArgs = tokens.size() - first - 1;
+
+        if (command == "param" && numArgs == 2)
+        {
+            event.type = ScriptEvent::Type::Param;
+            event.parameterId = tokens[first + 1];
+            event.value = tokens[first + 2].getFloatValue();
+        }
+        else if (command == "noteOn" && numArgs == 2)
+        {
+            event.type = ScriptEvent::Type::NoteOn;
+            event.note = tokens[first + 1].getIntValue();
+            event.value = tokens[first + 2].getFloatValue();
+        }
+        else if (command == "noteOff" && numArgs == 1)
+        {
+            event.type = ScriptEvent::Type::NoteOff;
+            event.note = tokens[first + 1].getIntValue();
+        }
+        else
+        {
+            error = "line " + juce::String(lineNumber + 1) + ": can't parse '" + line + "'";
+            return false;
+        }
+
+        script.events.push_back(event);
+    }
+
+    if (script.numSamples <= 0)
+    {
+        error = "missing 'length'";
+        return false;
+    }
+
+    std::stable_sort(script.events.begin(), script.events.end(),
+                     [](const ScriptEvent& a, const ScriptEvent& b) { return a.samplePosition < b.samplePosition; });
+    return true;
+}
+
+bool SetParameter(SimpleSynthProcessor& processor, const juce::String& id, float value)
+{
+    auto* parameter = processor.getParameters().getParameter(id);
+    if (parameter == nullptr)
+        return false;
+
+    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    return true;
+}
+
+bool Render(const Script& script, juce::AudioBuffer<float>& output, juce::String& error)
+{
+    SimpleSynthProcessor processor;
+    processor.setNonRealtime(true);
+
+    // Parameters at time zero are part of the initial state
+    auto event = script.events.begin();
+    for (; event != script.events.end() && event->samplePosition == 0
+           && event->type == ScriptEvent::Type::Param; ++event)
+    {
+        if (! SetParameter(processor, event->parameterId, event->value))
+        {
+            error = "unknown parameter '" + event->parameterId + "'";
+            return false;
+        }
+    }
+
+    if (script.noiseSeed != 0)
+        processor.setNoiseSeed(script.noiseSeed);
+
+    processor.prepareToPlay(kSampleRate, kBlockSize);
+
+    output.setSize(1, script.numSamples);
+    juce::AudioBuffer<float> block(1, kBlockSize);
+    juce::MidiBuffer midi;
+
+    for (int blockStart = 0; blockStart < script.numSamples; blockStart += kBlockSize)
+    {
+        const int blockLength = juce::jmin(kBlockSize, script.numSamples - blockStart);
+        const int blockEnd = blockStart + blockLength;
+        midi.clear();
+
+        for (; event != script.events.end() && event->samplePosition < blockEnd; ++event)
+        {
+            const int offset = juce::jmax(0, event->samplePosition - blockStart);
+
+            switch (event->type)
+            {
+                case ScriptEvent::Type::Param:
+                    // Parameters are read once per block
+                    if (! SetParameter(processor, event->parameterId, event->value))
+                    {
+                        error = "unknown parameter '" + event->parameterId + "'";
+                        return false;
+                    }
+                    break;
+
+                case ScriptEvent::Type::NoteOn:
+                    midi.addEvent(juce::MidiMessage::noteOn(1, event->note, event->value), offset);
+                    break;
+
+                case ScriptEvent::Type::NoteOff:
+                    midi.addEvent(juce::MidiMessage::noteOff(1, event->note), offset);
+                    break;
+            }
+        }
+
+        block.setSize(1, blockLength, false, false, true);
+        processor.processBlock(block, midi);
+        output.copyFrom(0, blockStart, block, 0, 0, blockLength);
+    }
+
+    processor.releaseResources();
+    return true;
+}
+
+// Magnitude spectra (dB) of Hann-windowed frames
+std::vector<std::vector<float>> Spectrogram(const float* samples, int numSamples)
+{
+    juce::dsp::FFT fft(kFftOrder);
+    juce::dsp::WindowingFunction<float> window(kFftSize, juce::dsp::WindowingFunction<float>::hann, false);
+    std::vector<float> frame(2 * kFftSize);
+    std::vector<std::vector<float>> frames;
+
+    for (int start = 0; start + kFftSize <= numSamples; start += kFftHop)
+    {
+        std::fill(frame.begin(), frame.end(), 0.0f);
+        std::copy(samples + start, samples + start + kFftSize, frame.begin());
+        window.multiplyWithWindowingTable(frame.data(), kFftSize);
+        fft.performFrequencyOnlyForwardTransform(frame.data());
+
+        std::vector<float> magnitudesDb(kFftSize / 2 + 1);
+        for (size_t bin = 0; bin < magnitudesDb.size(); ++bin)
+            magnitudesDb[bin] = juce::Decibels::gainToDecibels(frame[bin], -200.0f);
+
+        frames.push_back(std::move(magnitudesDb));
+    }
+
+    return frames;
+}
+
+Metrics Compare(const juce::AudioBuffer<float>& rendered, const juce::AudioBuffer<float>& golden)
+{
+    Metrics metrics;
+    const int numSamples = juce::jmin(rendered.getNumSamples(), golden.getNumSamples());
+    const float* a = rendered.getReadPointer(0);
+    const float* b = golden.getReadPointer(0);
+
+    double errorEnergy = 0.0;
+    double goldenEnergy = 0.0;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double error = static_cast<double>(a[i]) - static_cast<double>(b[i]);
+        metrics.maxError = std::max(metrics.maxError, std::abs(error));
+        errorEnergy += error * error;
+        goldenEnergy += static_cast<double>(b[i]) * static_cast<double>(b[i]);
+    }
+
+    // A length mismatch is an error over the whole missing tail
+    if (rendered.getNumSamples() != golden.getNumSamples())
+        errorEnergy += goldenEnergy + 1.0;
+
+    metrics.rmsErrorDb = 10.0 * std::log10((errorEnergy + 1e-20) / (goldenEnergy + 1e-20));
+
+    const auto framesA = Spectrogram(a, numSamples);
+    const auto framesB = Spectrogram(b, numSamples);
+    double squaredDifference = 0.0;
+    size_t numBins = 0;
+
+    for (size_t f = 0; f < framesA.size(); ++f)
+    {
+        const float peakDb = *std::max_element(framesB[f].begin(), framesB[f].end());
+
+        for (size_t bin = 0; bin < framesB[f].size(); ++bin)
+        {
+            if (framesB[f][bin] < peakDb - 100.0f || peakDb < -120.0f)
+                continue;
+
+            const double difference = framesA[f][bin] - framesB[f][bin];
+            squaredDifference += difference * difference;
+            ++numBins;
+        }
+    }
+
+    metrics.spectralDb = (numBins > 0) ? std::sqrt(squaredDifference / static_cast<double>(numBins)) : 0.0;
+    return metrics;
+}
+
+bool WriteWav(const juce::File& file, const juce::AudioBuffer<float>& buffer)
+{
+    file.deleteFile();
+    auto stream = std::make_unique<juce::FileOutputStream>(file);
+    if (stream->failedToOpen())
+        return false;
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wav.createWriterFor(stream.get(), kSampleRate, 1, 32, {}, 0));
+    if (writer == nullptr)
+        return false;
+
+    stream.release(); // owned by the writer now
+    return writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+}
+
+bool ReadWav(const juce::File& file, juce::AudioBuffer<float>& buffer)
+{
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+    std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+    if (reader == nullptr)
+        return false;
+
+    buffer.setSize(1, static_cast<int>(reader->lengthInSamples));
+    return reader->read(&buffer, 0, buffer.getNumSamples(), 0, true, false);
+}
+
+int Usage()
+{
+    std::cerr << "Usage: DubSiren_GoldenTests (--check | --update) <golden-dir>\n";
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+        return Usage();
+
+    const juce::String mode(argv[1]);
+    const bool update = (mode == "--update");
+    if (! update && mode != "--check")
+        return Usage();
+
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const juce::File goldenDir(juce::File::getCurrentWorkingDirectory().getChildFile(argv[2]));
+    auto scripts = goldenDir.findChildFiles(juce::File::findFiles, false, "*.script");
+    scripts.sort();
+
+    if (scripts.isEmpty())
+    {
+        std::cerr << "No scripts in " << goldenDir.getFullPathName() << "\n";
+        return 1;
+    }
+
+    int numChecked = 0;
+    int numFailed = 0;
+    int numMissing = 0;
+
+    std::cout << std::left << std::setw(28) << "Script"
+              << std::setw(14) << "max error" << std::setw(16) << "rms error dB"
+              << "spectral dB\n"
+              << "----------------------------------------------------------------------\n";
+
+    for (const auto& scriptFile : scripts)
+    {
+        Script script;
+        juce::String error;
+        juce::AudioBuffer<float> rendered;
+
+        if (! ParseScript(scriptFile, script, error) || ! Render(script, rendered, error))
+        {
+            std::cout << std::setw(28) << scriptFile.getFileName() << "ERROR: " << error << "\n";
+            ++numFailed;
+            continue;
+        }
+
+        const auto goldenFile = scriptFile.withFileExtension("wav");
+        std::cout << std::setw(28) << script.name;
+
+        if (update)
+        {
+            const bool written = WriteWav(goldenFile, rendered);
+            std::cout << (written ? "written" : "ERROR: could not write golden") << "\n";
+            numFailed += written ? 0 : 1;
+            continue;
+        }
+
+        juce::AudioBuffer<float> golden;
+        if (! goldenFile.existsAsFile() || ! ReadWav(goldenFile, golden))
+        {
+            std::cout << "FAIL: no golden (render and commit " << goldenFile.getFileName() << ")\n";
+            ++numMissing;
+            continue;
+        }
+
+        const auto metrics = Compare(rendered, golden);
+        const bool passed = metrics.rmsErrorDb <= script.rmsErrorDb
+                         && metrics.spectralDb <= script.spectralDb;
+
+        std::cout << std::scientific << std::setprecision(2) << std::setw(14) << metrics.maxError
+                  << std::fixed << std::setprecision(1) << std::setw(16) << metrics.rmsErrorDb
+                  << std::setprecision(3) << std::setw(10) << metrics.spectralDb
+                  << (passed ? "" : "  FAIL") << "\n";
+
+        ++numChecked;
+        numFailed += passed ? 0 : 1;
+    }
+
+    if (update)
+        return (numFailed == 0) ? 0 : 1;
+
+    std::cout << "\n" << numChecked << " checked, " << numFailed << " failed, "
+              << numMissing << " without golden\n";
+
+    return (numFailed == 0 && numMissing == 0) ? 0 : 1;
+}
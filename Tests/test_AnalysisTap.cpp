@@ -0,0 +1,187 @@
+#include <juce_core/juce_core.h>
+#include "DSP/AnalysisTap.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+
+/**
+ * Analysis Tap Unit Tests
+ *
+ * Tests cover:
+ * - Decimation factor (a power of two) and output rate per sample rate
+ * - Tones above the output Nyquist are rejected, not aliased; tones
+ *   below it pass at unity gain
+ * - Output doesn't depend on how the input is split into blocks
+ * - Disabled: nothing queued; re-enabling drops the stale partial chunk
+ * - A full ring drops and counts chunks instead of blocking
+ */
+
+class AnalysisTapTest : public juce::UnitTest {
+public:
+    AnalysisTapTest() : juce::UnitTest("AnalysisTap Tests") {}
+
+    void runTest() override {
+        beginTest("Decimation");
+        testDecimation();
+
+        beginTest("Anti-Aliasing");
+        testAntiAliasing();
+
+        beginTest("Block Sizes");
+        testBlockSizes();
+
+        beginTest("Enable And Disable");
+        testEnable();
+
+        beginTest("Full Ring");
+        testFullRing();
+    }
+
+private:
+    void testDecimation() {
+        AnalysisTap tap;
+
+        tap.Init(48000.0f);
+        expectEquals(static_cast<int>(tap.GetDecimation()), 2);
+        expectEquals(tap.GetOutputRate(), 24000.0f);
+
+        tap.Init(44100.0f);
+        expectEquals(static_cast<int>(tap.GetDecimation()), 2);
+        expectEquals(tap.GetOutputRate(), 22050.0f);
+
+        tap.Init(192000.0f);
+        expectEquals(static_cast<int>(tap.GetDecimation()), 8);
+
+        tap.Init(176400.0f);
+        expectEquals(static_cast<int>(tap.GetDecimation()), 8, "Half-band stages only halve");
+
+        tap.Init(22050.0f);
+        expectEquals(static_cast<int>(tap.GetDecimation()), 1, "Low rates pass through");
+    }
+
+    // RMS of everything the tap queues for a sine, after the filters settle
+    static float measureTone(float sampleRate, float frequency) {
+        AnalysisTap tap;
+        tap.Init(sampleRate);
+        tap.SetEnabled(true);
+
+        std::vector<float> input(static_cast<size_t>(sampleRate / 4.0f));
+        for (size_t i = 0; i < input.size(); ++i) {
+            input[i] = std::sin(kTwoPi * frequency * static_cast<float>(i) / sampleRate);
+        }
+        tap.Process(input.data(), input.size());
+
+        double energy = 0.0;
+        size_t numSamples = 0;
+        AnalysisTap::Chunk chunk;
+        for (size_t n = 0; tap.Pop(chunk); ++n) {
+            if (n < 4) {
+                continue;
+            }
+            for (float sample : chunk.samples) {
+                energy += static_cast<double>(sample) * sample;
+                ++numSamples;
+            }
+        }
+        return static_cast<float>(std::sqrt(energy / static_cast<double>(std::max<size_t>(numSamples, 1))));
+    }
+
+    void testAntiAliasing() {
+        // 4:1 to 24 kHz. Averaging runs of four left 20 kHz at -14 dB,
+        // folded down to 4 kHz.
+        expectLessThan(measureTone(96000.0f, 20000.0f), 1.0e-3f, "20 kHz should not alias at 96 kHz");
+        expectLessThan(measureTone(48000.0f, 15000.0f), 1.0e-3f, "15 kHz should not alias at 48 kHz");
+        expectWithinAbsoluteError(measureTone(96000.0f, 1000.0f), 0.7071f, 0.01f, "1 kHz should pass");
+        expectWithinAbsoluteError(measureTone(192000.0f, 5000.0f), 0.7071f, 0.01f, "5 kHz should pass");
+    }
+
+    void testBlockSizes() {
+        AnalysisTap whole, split;
+        whole.Init(96000.0f);
+        split.Init(96000.0f);
+        whole.SetEnabled(true);
+        split.SetEnabled(true);
+
+        // Odd-sized blocks, so runs straddle block boundaries
+        const size_t numInput = 4 * AnalysisTap::kChunkSize * 3;
+        std::vector<float> input(numInput);
+        for (size_t i = 0; i < numInput; ++i) {
+            input[i] = std::sin(0.01f * static_cast<float>(i * i % 997));
+        }
+        whole.Process(input.data(), numInput);
+        for (size_t position = 0; position < numInput; position += 37) {
+            split.Process(input.data() + position, std::min<size_t>(37, numInput - position));
+        }
+
+        bool identical = true;
+        size_t numChunks = 0;
+        AnalysisTap::Chunk a, b;
+        while (whole.Pop(a)) {
+            identical = identical && split.Pop(b) && a.samples == b.samples;
+            ++numChunks;
+        }
+        expectEquals(static_cast<int>(numChunks), 3);
+        expect(identical, "Splitting the input into blocks should not change the output");
+        expect(! split.Pop(b));
+    }
+
+    void testEnable() {
+        AnalysisTap tap;
+        tap.Init(48000.0f);
+
+        std::vector<float> ones(1024, 1.0f);
+        tap.Process(ones.data(), ones.size());
+        AnalysisTap::Chunk chunk;
+        expect(! tap.Pop(chunk), "Disabled tap queues nothing");
+
+        // Half a chunk, then a gap while disabled
+        tap.SetEnabled(true);
+        tap.Process(ones.data(), AnalysisTap::kChunkSize);
+        tap.SetEnabled(false);
+        tap.Process(ones.data(), ones.size());
+
+        // Re-enabled: the next chunk is what a fresh tap makes of the new
+        // samples, no stale samples or filter state
+        std::vector<float> twos(2 * AnalysisTap::kChunkSize, 2.0f);
+        tap.SetEnabled(true);
+        tap.Process(twos.data(), twos.size());
+
+        AnalysisTap fresh;
+        fresh.Init(48000.0f);
+        fresh.SetEnabled(true);
+        fresh.Process(twos.data(), twos.size());
+
+        AnalysisTap::Chunk expected;
+        expect(tap.Pop(chunk));
+        expect(fresh.Pop(expected));
+        expect(chunk.samples == expected.samples, "Stale partial chunk should be discarded");
+        expect(! tap.Pop(chunk));
+    }
+
+    void testFullRing() {
+        AnalysisTap tap;
+        tap.Init(24000.0f);     // 1:1
+        tap.SetEnabled(true);
+
+        const size_t capacity = AnalysisTap::kRingSize - 1;
+        std::vector<float> input((capacity + 5) * AnalysisTap::kChunkSize, 0.5f);
+        tap.Process(input.data(), input.size());
+        expectEquals(static_cast<int>(tap.GetNumDropped()), 5);
+
+        size_t numChunks = 0;
+        AnalysisTap::Chunk chunk;
+        while (tap.Pop(chunk)) {
+            ++numChunks;
+        }
+        expectEquals(static_cast<int>(numChunks), static_cast<int>(capacity));
+
+        // Draining makes room again
+        tap.Process(input.data(), AnalysisTap::kChunkSize);
+        expect(tap.Pop(chunk));
+        expectEquals(static_cast<int>(tap.GetNumDropped()), 5);
+    }
+};
+
+static AnalysisTapTest analysisTapTest;
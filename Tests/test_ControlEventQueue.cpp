@@ -0,0 +1,148 @@
+#include <juce_core/juce_core.h>
+#include "Control/ControlEventQueue.h"
+#include <cstring>
+#include <thread>
+
+using SimpleSynth::Control::ControlEvent;
+using SimpleSynth::Control::ControlEventQueue;
+using SimpleSynth::Control::ParamIndex;
+
+/**
+ * Control Event Queue Unit Tests
+ *
+ * Tests cover:
+ * - Events arrive intact and in order
+ * - Overflow drops and counts instead of blocking
+ * - Statistics (pushed, dropped, high-water mark) and reset
+ * - Parameter table matches its index enum
+ * - Message thread / audio thread handoff
+ */
+
+class ControlEventQueueTest : public juce::UnitTest {
+public:
+    ControlEventQueueTest() : juce::UnitTest("Control Event Queue Tests") {}
+
+    void runTest() override {
+        beginTest("Events Arrive In Order");
+        testOrder();
+
+        beginTest("Overflow Is Counted");
+        testOverflow();
+
+        beginTest("Statistics Reset");
+        testReset();
+
+        beginTest("Parameter Table");
+        testParameterTable();
+
+        beginTest("Two Thread Handoff");
+        testTwoThreads();
+    }
+
+private:
+    static ControlEvent makeEvent(ControlEvent::Type type, float value) {
+        ControlEvent event;
+        event.type = type;
+        event.value = value;
+        return event;
+    }
+
+    void testOrder() {
+        ControlEventQueue queue;
+
+        ControlEvent dive = makeEvent(ControlEvent::Type::PitchDive, -2.0f);
+        dive.duration = 1.5f;
+        ControlEvent parameter = makeEvent(ControlEvent::Type::SetParameter, 0.9f);
+        parameter.parameter = ParamIndex::DelayFeedback;
+
+        expect(queue.Push(makeEvent(ControlEvent::Type::TriggerOn, 0.8f)));
+        expect(queue.Push(dive));
+        expect(queue.Push(parameter));
+
+        ControlEvent event;
+        expect(queue.Pop(event) && event.type == ControlEvent::Type::TriggerOn);
+        expectEquals(event.value, 0.8f);
+
+        expect(queue.Pop(event) && event.type == ControlEvent::Type::PitchDive);
+        expectEquals(event.duration, 1.5f, "Event payload should survive the queue");
+
+        expect(queue.Pop(event) && event.type == ControlEvent::Type::SetParameter);
+        expect(event.parameter == ParamIndex::DelayFeedback);
+
+        expect(! queue.Pop(event), "Queue should be empty after draining");
+    }
+
+    void testOverflow() {
+        ControlEventQueue queue;
+        const auto trigger = makeEvent(ControlEvent::Type::TriggerOn, 1.0f);
+
+        for (size_t i = 0; i < ControlEventQueue::kCapacity; ++i) {
+            queue.Push(trigger);
+        }
+        expect(! queue.Push(trigger), "Push into a full queue should fail, not block");
+        expect(! queue.Push(trigger));
+
+        expectEquals(static_cast<int>(queue.GetNumPushed()), static_cast<int>(ControlEventQueue::kCapacity));
+        expectEquals(static_cast<int>(queue.GetNumDropped()), 2, "Every dropped event should be counted");
+        expectEquals(static_cast<int>(queue.GetHighWaterMark()), static_cast<int>(ControlEventQueue::kCapacity));
+
+        ControlEvent event;
+        queue.Pop(event);
+        expect(queue.Push(trigger), "Draining should make room again");
+    }
+
+    void testReset() {
+        ControlEventQueue queue;
+        const auto trigger = makeEvent(ControlEvent::Type::TriggerOn, 1.0f);
+
+        for (int i = 0; i < 10; ++i) {
+            queue.Push(trigger);
+        }
+        queue.ResetStatistics();
+
+        expectEquals(static_cast<int>(queue.GetNumPushed()), 0);
+        expectEquals(static_cast<int>(queue.GetNumDropped()), 0);
+        expectEquals(static_cast<int>(queue.GetHighWaterMark()), 0);
+        expectEquals(static_cast<int>(queue.GetNumReady()), 10, "Reset should leave queued events alone");
+    }
+
+    void testParameterTable() {
+        using SimpleSynth::Control::GetParameterInfo;
+
+        expect(std::strcmp(GetParameterInfo(ParamIndex::VcoRate).id, "vcoRate") == 0);
+        expect(std::strcmp(GetParameterInfo(ParamIndex::DelayWetDry).id, "delayWetDry") == 0);
+        expect(std::strcmp(GetParameterInfo(ParamIndex::Quality).id, "quality") == 0);
+
+        expect(GetParameterInfo(ParamIndex::DelayFeedback).continuous);
+        expect(! GetParameterInfo(ParamIndex::Lfo1Target).continuous, "Choice parameters can't take gestures");
+    }
+
+    void testTwoThreads() {
+        constexpr int kCount = 50000;
+        ControlEventQueue queue;
+
+        std::thread producer([&queue] {
+            for (int i = 0; i < kCount;) {
+                if (queue.Push(makeEvent(ControlEvent::Type::SetParameter, static_cast<float>(i)))) {
+                    ++i;
+                }
+            }
+        });
+
+        int expected = 0;
+        bool ordered = true;
+        ControlEvent event;
+        while (expected < kCount) {
+            if (queue.Pop(event)) {
+                ordered = ordered && (event.value == static_cast<float>(expected));
+                ++expected;
+            }
+        }
+        producer.join();
+
+        expect(ordered, "Audio thread should see every event once, in order");
+        expectEquals(static_cast<int>(queue.GetNumPushed()), kCount);
+    }
+};
+
+static ControlEventQueueTest controlEventQueueTest;
@@ -0,0 +1,122 @@
+#include <juce_core/juce_core.h>
+#include "Perf/CpuGovernor.h"
+
+using SimpleSynth::Perf::CpuGovernor;
+
+/**
+ * CPU Governor Unit Tests
+ *
+ * Tests cover:
+ * - Steady tier under a comfortable load
+ * - Step down on sustained load and on a single overloaded block
+ * - Step up only after a long run of headroom
+ * - Ceiling limits
+ */
+
+class CpuGovernorTest : public juce::UnitTest {
+public:
+    CpuGovernorTest() : juce::UnitTest("CpuGovernor Tests") {}
+
+    void runTest() override {
+        beginTest("Steady Load Keeps Tier");
+        testSteadyLoad();
+
+        beginTest("Sustained Load Steps Down");
+        testSustainedLoad();
+
+        beginTest("Overloaded Block Steps Down");
+        testPanicStepDown();
+
+        beginTest("Headroom Steps Up");
+        testStepUp();
+
+        beginTest("Ceiling");
+        testCeiling();
+    }
+
+private:
+    // Eco, Live, Studio relative costs
+    static constexpr float kCosts[] = { 0.8f, 1.0f, 5.0f };
+
+    static void Prepare(CpuGovernor& governor, size_t ceiling) {
+        governor.SetTierCosts(kCosts, 3);
+        governor.SetCeiling(ceiling);
+    }
+
+    // Simulated host: a block's load is the work scaled by the cost of
+    // whichever tier the governor has selected
+    static void Feed(CpuGovernor& governor, float work, size_t numBlocks) {
+        for (size_t b = 0; b < numBlocks; ++b) {
+            governor.Update(work * kCosts[governor.GetTier()]);
+        }
+    }
+
+    void testSteadyLoad() {
+        CpuGovernor governor;
+        Prepare(governor, 2);
+
+        Feed(governor, 0.1f, 1000);
+        expectEquals(static_cast<int>(governor.GetTier()), 2,
+            "A comfortable load should keep the ceiling tier");
+        expectWithinAbsoluteError(governor.GetAverageLoad(), 0.5f, 0.01f,
+            "Average load should track the measured load");
+    }
+
+    void testSustainedLoad() {
+        CpuGovernor governor;
+        Prepare(governor, 2);
+
+        // Studio runs at 0.8 of the deadline, Live at 0.16
+        Feed(governor, 0.16f, 1000);
+        expectEquals(static_cast<int>(governor.GetTier()), 1,
+            "Sustained load above the threshold should step down one tier");
+    }
+
+    void testPanicStepDown() {
+        CpuGovernor governor;
+        Prepare(governor, 2);
+
+        // Let the settle period after SetCeiling pass
+        Feed(governor, 0.05f, CpuGovernor::kSettleBlocks);
+        governor.Update(1.2f);
+        expectEquals(static_cast<int>(governor.GetTier()), 1,
+            "A block over its deadline should step down immediately");
+    }
+
+    void testStepUp() {
+        CpuGovernor governor;
+        Prepare(governor, 2);
+        // Live at 0.18 predicts Studio at 0.9, so stay down
+        Feed(governor, 0.18f, 1000);
+        expectEquals(static_cast<int>(governor.GetTier()), 1,
+            "Should not step up into a tier the budget can't hold");
+
+        // Live at 0.05 predicts 0.25: step up, but not before the headroom run
+        Feed(governor, 0.05f, 50);
+        expectEquals(static_cast<int>(governor.GetTier()), 1,
+            "Should wait for sustained headroom before stepping up");
+
+        Feed(governor, 0.05f, 1000);
+        expectEquals(static_cast<int>(governor.GetTier()), 2,
+            "Should return to the ceiling once there is headroom");
+    }
+
+    void testCeiling() {
+        CpuGovernor governor;
+        Prepare(governor, 1);
+
+        Feed(governor, 0.01f, 2000);
+        expectEquals(static_cast<int>(governor.GetTier()), 1,
+            "Should never step above the ceiling");
+
+        governor.SetCeiling(0);
+        expectEquals(static_cast<int>(governor.GetTier()), 0,
+            "Lowering the ceiling should apply immediately");
+
+        Feed(governor, 2.0f, 100);
+        expectEquals(static_cast<int>(governor.GetTier()), 0,
+            "Cheapest tier is the floor");
+    }
+};
+
+static CpuGovernorTest cpuGovernorTest;
@@ -0,0 +1,285 @@
+#include <juce_core/juce_core.h>
+#include "DSP/DubDelay.h"
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+
+/**
+ * Dub Delay Unit Tests
+ *
+ * Tests cover:
+ * - Single-head echo timing
+ * - Multi-tap heads reading the shared delay line
+ * - Tap count clamping and buffer size independent of head count
+ * - Bounded output with maximum feedback on all heads
+ * - Feedback scaling counts active heads only (4 -> 2 heads matches a
+ *   fresh 2-head delay)
+ * - Tape feedback chain: block/sample path agreement, DC removal,
+ *   bounded saturation
+ * - Linear and cubic read-head interpolation of fractional delays
+ */
+
+class DubDelayTest : public juce::UnitTest {
+public:
+    DubDelayTest() : juce::UnitTest("Dub Delay Tests") {}
+
+    void runTest() override {
+        beginTest("Single Head Echo");
+        testSingleHeadEcho();
+
+        beginTest("Multi-Tap Heads");
+        testMultiTapHeads();
+
+        beginTest("Tap Count And Buffer Size");
+        testTapCountAndBufferSize();
+
+        beginTest("Multi-Tap Stability");
+        testMultiTapStability();
+
+        beginTest("Fewer Heads Forget Inactive Feedback");
+        testFewerHeadsFeedback();
+
+        beginTest("Tape Chain Block Matches Sample Path");
+        testTapeBlockMatchesSamplePath();
+
+        beginTest("Tape Chain Removes DC");
+        testTapeRemovesDC();
+
+        beginTest("Tape Loop Stays Bounded");
+        testTapeLoopBounded();
+
+        beginTest("Fractional Delay Interpolation");
+        testFractionalDelayInterpolation();
+    }
+
+private:
+    static constexpr float kSampleRate = 44100.0f;
+
+    // Renders an impulse through the delay, returns the wet response
+    static std::vector<float> RenderImpulse(DubDelay& delay, size_t numSamples) {
+        std::vector<float> buffer(numSamples, 0.0f);
+        buffer[0] = 1.0f;
+        delay.Process(buffer.data(), numSamples);
+        return buffer;
+    }
+
+    // Largest absolute value within +/- window samples of position
+    static float PeakAround(const std::vector<float>& buffer, size_t position, size_t window) {
+        float peak = 0.0f;
+        for (size_t i = position - window; i <= position + window && i < buffer.size(); ++i) {
+            peak = std::max(peak, std::abs(buffer[i]));
+        }
+        return peak;
+    }
+
+    void testSingleHeadEcho() {
+        DubDelay delay;
+        delay.Init(kSampleRate);
+        delay.SetDelayTime(0.1f);
+        delay.SetFeedback(0.0f);
+        delay.SetWetDry(1.0f);
+
+        auto response = RenderImpulse(delay, 8192);
+        size_t echoPosition = static_cast<size_t>(0.1f * kSampleRate);
+
+        expectWithinAbsoluteError(PeakAround(response, echoPosition, 8), 1.0f, 0.001f,
+            "Echo should appear at the delay time");
+        expectWithinAbsoluteError(PeakAround(response, echoPosition / 2, 8), 0.0f, 0.001f,
+            "No echo should appear before the delay time");
+    }
+
+    void testMultiTapHeads() {
+        DubDelay delay;
+        delay.Init(kSampleRate);
+        delay.SetWetDry(1.0f);
+        delay.SetNumTaps(3);
+        delay.SetTap(0, 0.05f, 1.0f, 0.0f);
+        delay.SetTap(1, 0.10f, 0.5f, 0.0f);
+        delay.SetTap(2, 0.15f, 0.25f, 0.0f);
+
+        auto response = RenderImpulse(delay, 8192);
+
+        expectWithinAbsoluteError(PeakAround(response, 2205, 8), 1.0f, 0.001f,
+            "First head should echo at full gain");
+        expectWithinAbsoluteError(PeakAround(response, 4410, 8), 0.5f, 0.001f,
+            "Second head should echo at its own gain");
+        expectWithinAbsoluteError(PeakAround(response, 6615, 8), 0.25f, 0.001f,
+            "Third head should echo at its own gain");
+    }
+
+    void testTapCountAndBufferSize() {
+        DubDelay delay;
+        delay.Init(kSampleRate);
+        size_t singleHeadSize = delay.GetBufferSize();
+
+        expect(singleHeadSize >= static_cast<size_t>(2.0f * kSampleRate),
+            "Buffer should hold the maximum delay time");
+
+        delay.SetNumTaps(0);
+        expect(delay.GetNumTaps() == 1, "Tap count should clamp to at least one head");
+
+        delay.SetNumTaps(16);
+        expect(delay.GetNumTaps() == DubDelay::kMaxTaps, "Tap count should clamp to kMaxTaps");
+        expect(delay.GetBufferSize() == singleHeadSize,
+            "Extra heads should share the existing delay line");
+    }
+
+    void testMultiTapStability() {
+        DubDelay delay;
+        delay.Init(kSampleRate);
+        delay.SetWetDry(0.5f);
+        delay.SetNumTaps(DubDelay::kMaxTaps);
+
+        for (size_t t = 0; t < DubDelay::kMaxTaps; ++t) {
+            delay.SetTap(t, 0.01f * static_cast<float>(t + 1), 1.0f, 0.95f);
+        }
+
+        std::vector<float> buffer(static_cast<size_t>(kSampleRate) * 2, 0.0f);
+        buffer[0] = 1.0f;
+        delay.Process(buffer.data(), buffer.size());
+
+        bool bounded = true;
+        for (float sample : buffer) {
+            if (std::isnan(sample) || std::isinf(sample) || std::abs(sample) > 4.0f) {
+                bounded = false;
+                break;
+            }
+        }
+        expect(bounded, "Summed head feedback should stay below runaway");
+    }
+
+    void testFewerHeadsFeedback() {
+        auto setHeads = [](DubDelay& delay, size_t numHeads) {
+            delay.SetNumTaps(numHeads);
+            for (size_t t = 0; t < numHeads; ++t) {
+                delay.SetTap(t, 0.05f * static_cast<float>(t + 1), 1.0f, 0.95f / static_cast<float>(numHeads));
+            }
+        };
+
+        DubDelay fresh;
+        fresh.Init(kSampleRate);
+        fresh.SetWetDry(1.0f);
+        setHeads(fresh, 2);
+
+        // Four heads first, then down to two: heads 2-3 keep their old
+        // settings but must drop out of the feedback sum
+        DubDelay switched;
+        switched.Init(kSampleRate);
+        switched.SetWetDry(1.0f);
+        setHeads(switched, 4);
+        RenderImpulse(switched, 4096);
+        switched.Reset();
+        setHeads(switched, 2);
+
+        const auto expected = RenderImpulse(fresh, static_cast<size_t>(kSampleRate));
+        const auto response = RenderImpulse(switched, static_cast<size_t>(kSampleRate));
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < expected.size(); ++i) {
+            maxError = std::max(maxError, std::abs(response[i] - expected[i]));
+        }
+        expectLessThan(maxError, 1.0e-6f, "Two heads should sound the same whatever ran before");
+    }
+
+    void testTapeBlockMatchesSamplePath() {
+        TapeFeedback blockTape;
+        TapeFeedback sampleTape;
+        blockTape.Init(kSampleRate);
+        sampleTape.Init(kSampleRate);
+
+        std::vector<float> block(256);
+        for (size_t i = 0; i < block.size(); ++i) {
+            block[i] = std::sin(static_cast<float>(i) * 0.05f) * 1.5f;
+        }
+        std::vector<float> reference = block;
+
+        blockTape.Process(block.data(), block.size());
+        for (auto& sample : reference) {
+            sample = sampleTape.ProcessSample(sample);
+        }
+
+        for (size_t i = 0; i < block.size(); ++i) {
+            expectWithinAbsoluteError(block[i], reference[i], 1e-5f,
+                "Block path should match per-sample path");
+        }
+    }
+
+    void testTapeRemovesDC() {
+        TapeFeedback tape;
+        tape.Init(kSampleRate);
+
+        std::vector<float> buffer(static_cast<size_t>(kSampleRate), 0.5f);
+        tape.Process(buffer.data(), buffer.size());
+
+        expectWithinAbsoluteError(buffer.back(), 0.0f, 0.001f,
+            "Low cut should remove DC from the feedback path");
+    }
+
+    void testTapeLoopBounded() {
+        DubDelay delay;
+        delay.Init(kSampleRate);
+        delay.SetDelayTime(0.01f);
+        delay.SetFeedback(0.95f);
+        delay.SetWetDry(1.0f);
+        delay.SetTapeEnabled(true);
+        delay.SetTapeDrive(8.0f);
+
+        std::vector<float> buffer(static_cast<size_t>(kSampleRate), 0.9f);
+        delay.Process(buffer.data(), buffer.size());
+
+        bool bounded = true;
+        for (float sample : buffer) {
+            if (std::isnan(sample) || std::isinf(sample) || std::abs(sample) > 2.0f) {
+                bounded = false;
+                break;
+            }
+        }
+        expect(bounded, "Saturated feedback loop should stay bounded");
+    }
+
+    void testFractionalDelayInterpolation() {
+        // 100.5 samples: an impulse should land half on each neighbour
+        const float delayTime = 100.5f / kSampleRate;
+
+        DubDelay truncating;
+        truncating.Init(kSampleRate);
+        truncating.SetDelayTime(delayTime);
+        truncating.SetFeedback(0.0f);
+        truncating.SetWetDry(1.0f);
+
+        auto truncated = RenderImpulse(truncating, 256);
+        expectWithinAbsoluteError(truncated[100], 1.0f, 0.001f,
+            "No interpolation should truncate to the whole sample");
+
+        DubDelay linear;
+        linear.Init(kSampleRate);
+        linear.SetDelayTime(delayTime);
+        linear.SetFeedback(0.0f);
+        linear.SetWetDry(1.0f);
+        linear.SetInterpolation(DubDelay::Interpolation::Linear);
+
+        auto linearResponse = RenderImpulse(linear, 256);
+        expectWithinAbsoluteError(linearResponse[100], 0.5f, 0.05f,
+            "Linear read should split the impulse");
+        expectWithinAbsoluteError(linearResponse[101], 0.5f, 0.05f,
+            "Linear read should split the impulse");
+
+        DubDelay cubic;
+        cubic.Init(kSampleRate);
+        cubic.SetDelayTime(delayTime);
+        cubic.SetFeedback(0.0f);
+        cubic.SetWetDry(1.0f);
+        cubic.SetInterpolation(DubDelay::Interpolation::Cubic);
+
+        auto cubicResponse = RenderImpulse(cubic, 256);
+        float sum = 0.0f;
+        for (float sample : cubicResponse) {
+            sum += sample;
+        }
+        expectWithinAbsoluteError(sum, 1.0f, 0.01f, "Cubic read should preserve DC gain");
+        expectWithinAbsoluteError(cubicResponse[100], cubicResponse[101], 0.05f,
+            "Cubic read should be symmetric at half a sample");
+    }
+};
+
+static DubDelayTest dubDelayTest;
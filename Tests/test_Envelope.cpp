@@ -13,6 +13,7 @@ using namespace SimpleSynth::DSP;
  * - Release decays to zero
  * - Retrigger behavior
  * - Denormal prevention
+ * - Sample rate change keeps stage timing
  */
 
 class EnvelopeTest : public juce::UnitTest {
@@ -43,6 +44,9 @@ public:
 
         beginTest("No Denormals");
         testNoDenormals();
+
+        beginTest("Sample Rate Change Keeps Timing");
+        testSampleRateChangeKeepsTiming();
     }
 
 private:
@@ -249,6 +253,32 @@ private:
 
         expect(env.GetLevel() == 0.0f, "Should reach exactly zero");
     }
+
+    void testSampleRateChangeKeepsTiming() {
+        Envelope env;
+        env.Init(44100.0f);
+        env.SetParameters(20.0f, 10.0f, 0.5f, 100.0f);  // 20ms attack
+
+        env.NoteOn();
+
+        // Half the attack at 44.1 kHz (10ms = 441 samples)
+        for (int i = 0; i < 441; ++i) {
+            env.ProcessSample();
+        }
+        float levelAtSwitch = env.GetLevel();
+
+        // Switch to 4x rate mid-attack: stage and level must carry over
+        env.SetSampleRate(176400.0f);
+        expect(env.GetStage() == Envelope::Stage::Attack, "Should stay in Attack after rate change");
+        expectWithinAbsoluteError(env.GetLevel(), levelAtSwitch, 0.0001f,
+            "Level should not jump on rate change");
+
+        // Remaining 10ms at 176.4 kHz = 1764 samples
+        for (int i = 0; i < 1764; ++i) {
+            env.ProcessSample();
+        }
+        expect(env.GetLevel() >= 0.99f, "Attack should complete after its time in ms");
+    }
 };
 
 static EnvelopeTest envelopeTest;
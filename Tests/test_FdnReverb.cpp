@@ -0,0 +1,173 @@
+#include <juce_core/juce_core.h>
+#include "DSP/FdnReverb.h"
+#include <cmath>
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+
+/**
+ * FDN Reverb Unit Tests
+ *
+ * Tests cover:
+ * - Power-of-two ring holding eight distinct line lengths; size scaling
+ * - Mix 0 bypasses the network and leaves the buffer untouched
+ * - Impulse tail decays at the set RT60
+ * - Damping darkens the tail
+ * - Bounded output at the longest decay with full-scale noise
+ */
+
+class FdnReverbTest : public juce::UnitTest {
+public:
+    FdnReverbTest() : juce::UnitTest("FDN Reverb Tests") {}
+
+    void runTest() override {
+        beginTest("Ring And Line Lengths");
+        testRingAndLineLengths();
+
+        beginTest("Mix Zero Bypasses");
+        testMixZeroBypasses();
+
+        beginTest("Decay Time");
+        testDecayTime();
+
+        beginTest("Damping Darkens Tail");
+        testDampingDarkensTail();
+
+        beginTest("Bounded Output");
+        testBoundedOutput();
+    }
+
+private:
+    static constexpr float kSampleRate = 48000.0f;
+
+    // Wet-only impulse response
+    static std::vector<float> RenderImpulse(FdnReverb& reverb, size_t numSamples) {
+        std::vector<float> buffer(numSamples, 0.0f);
+        buffer[0] = 1.0f;
+        reverb.Process(buffer.data(), numSamples);
+        return buffer;
+    }
+
+    // Mean energy in dB over [start, start + length)
+    static float EnergyDb(const std::vector<float>& buffer, size_t start, size_t length) {
+        double sum = 0.0;
+        for (size_t i = start; i < start + length; ++i) {
+            sum += static_cast<double>(buffer[i]) * buffer[i];
+        }
+        return static_cast<float>(10.0 * std::log10(sum / static_cast<double>(length) + 1.0e-30));
+    }
+
+    void testRingAndLineLengths() {
+        FdnReverb reverb;
+        reverb.Init(kSampleRate);
+
+        const size_t ringSize = reverb.GetRingSize();
+        expect(ringSize > 0 && (ringSize & (ringSize - 1)) == 0, "Ring should be a power of two");
+        expect(ringSize >= static_cast<size_t>(FdnReverb::kMaxLineSeconds * kSampleRate),
+            "Ring should hold the longest line");
+
+        reverb.SetSize(1.0f);
+        for (size_t i = 0; i < FdnReverb::kNumLines; ++i) {
+            expect(reverb.GetLineLength(i) < ringSize, "Line should fit the ring");
+            if (i > 0) {
+                expect(reverb.GetLineLength(i) > reverb.GetLineLength(i - 1), "Lines should be distinct");
+            }
+        }
+        const uint32_t longest = reverb.GetLineLength(FdnReverb::kNumLines - 1);
+
+        reverb.SetSize(0.0f);
+        expect(reverb.GetLineLength(FdnReverb::kNumLines - 1) < longest / 2,
+            "Small size should shorten the lines");
+
+        // Same decay time whatever the length: longer lines lose more per pass
+        expect(reverb.GetLineGain(0) > reverb.GetLineGain(FdnReverb::kNumLines - 1),
+            "Longer lines should have lower gain");
+    }
+
+    void testMixZeroBypasses() {
+        FdnReverb reverb;
+        reverb.Init(kSampleRate);
+        reverb.SetMix(0.0f);
+
+        std::vector<float> buffer(512);
+        for (size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = std::sin(0.05f * static_cast<float>(i));
+        }
+        const auto original = buffer;
+
+        reverb.Process(buffer.data(), buffer.size());
+        expect(buffer == original, "Mix 0 should leave the buffer untouched");
+        expect(! reverb.IsActive(), "Mix 0 should bypass the network");
+
+        reverb.SetMix(0.5f);
+        reverb.Process(buffer.data(), buffer.size());
+        expect(reverb.IsActive(), "A mix above 0 should run the network");
+    }
+
+    void testDecayTime() {
+        FdnReverb reverb;
+        reverb.Init(kSampleRate);
+        reverb.SetSize(1.0f);
+        reverb.SetDecay(1.0f);
+        reverb.SetDamping(0.0f);
+        reverb.SetMix(1.0f);
+
+        auto response = RenderImpulse(reverb, static_cast<size_t>(1.5f * kSampleRate));
+
+        // Once the tail is dense, energy falls ~60 dB per decay time
+        const auto window = static_cast<size_t>(0.05f * kSampleRate);
+        const float early = EnergyDb(response, static_cast<size_t>(0.2f * kSampleRate), window);
+        const float late = EnergyDb(response, static_cast<size_t>(0.7f * kSampleRate), window);
+        expectWithinAbsoluteError(early - late, 30.0f, 6.0f, "Tail should fall 60 dB per second");
+    }
+
+    void testDampingDarkensTail() {
+        // High-frequency share of the tail: first difference vs signal
+        auto brightness = [](float damping) {
+            FdnReverb reverb;
+            reverb.Init(kSampleRate);
+            reverb.SetDecay(2.0f);
+            reverb.SetDamping(damping);
+            reverb.SetMix(1.0f);
+
+            auto response = RenderImpulse(reverb, static_cast<size_t>(0.5f * kSampleRate));
+            double energy = 0.0, difference = 0.0;
+            for (size_t i = response.size() / 2; i < response.size(); ++i) {
+                energy += static_cast<double>(response[i]) * response[i];
+                const double step = response[i] - response[i - 1];
+                difference += step * step;
+            }
+            return difference / energy;
+        };
+
+        expect(brightness(1.0f) < 0.5 * brightness(0.0f), "Damping should darken the tail");
+    }
+
+    void testBoundedOutput() {
+        FdnReverb reverb;
+        reverb.Init(kSampleRate);
+        reverb.SetSize(0.0f);
+        reverb.SetDecay(20.0f);
+        reverb.SetDamping(0.0f);
+        reverb.SetMix(1.0f);
+
+        XorShift32 noise(42);
+        std::vector<float> buffer(512);
+        float peak = 0.0f;
+        bool finite = true;
+        for (int block = 0; block < 400; ++block) {
+            for (auto& sample : buffer) {
+                sample = noise.NextBipolar();
+            }
+            reverb.Process(buffer.data(), buffer.size());
+            for (float sample : buffer) {
+                finite = finite && std::isfinite(sample);
+                peak = std::max(peak, std::abs(sample));
+            }
+        }
+        expect(finite, "Output should stay finite");
+        expect(peak < 8.0f, "Output should stay bounded");
+    }
+};
+
+static FdnReverbTest fdnReverbTest;
@@ -12,6 +12,28 @@
  * Tests are defined in separate files:
  * - test_Oscillator.cpp
  * - test_Envelope.cpp
+ * - test_DubDelay.cpp
+ * - test_Oversampler.cpp
+ * - test_CpuGovernor.cpp
+ * - test_SpscRing.cpp
+ * - test_SnapshotPublisher.cpp
+ * - test_SampleRing.cpp
+ * - test_TraceRecorder.cpp
+ * - test_ControlEventQueue.cpp
+ * - test_ParameterSmoother.cpp
+ * - test_MidiMapping.cpp
+ * - test_Tuning.cpp
+ * - test_PitchGlide.cpp
+ * - test_ModMatrix.cpp
+ * - test_SnapshotMorph.cpp
+ * - test_StateFormat.cpp
+ * - test_PresetBank.cpp
+ * - test_AnalysisTap.cpp
+ * - test_FdnReverb.cpp
+ * - test_PartitionedConvolver.cpp
+ * - test_ResonantFilter.cpp
+ *
+ * DubSiren_RealtimeTests reuses this runner for test_RealtimeSafety.cpp.
  */
 
 int main(int argc, char* argv[])
@@ -0,0 +1,108 @@
+#include <juce_core/juce_core.h>
+#include "Control/MidiMapping.h"
+#include <vector>
+
+using SimpleSynth::Control::MidiMapping;
+using SimpleSynth::Control::ParamIndex;
+
+/**
+ * MIDI Mapping Unit Tests
+ *
+ * Tests cover:
+ * - Routing from one source to several parameters
+ * - MIDI learn binds the first learnable controller, once
+ * - Channel mode CCs are never learned
+ * - Learn replaces the parameter's previous mappings
+ */
+
+class MidiMappingTest : public juce::UnitTest {
+public:
+    MidiMappingTest() : juce::UnitTest("MidiMapping Tests") {}
+
+    void runTest() override {
+        beginTest("Routing");
+        testRouting();
+
+        beginTest("Learn");
+        testLearn();
+
+        beginTest("Mode Controllers Not Learnable");
+        testModeControllers();
+
+        beginTest("Learn Replaces Mapping");
+        testLearnReplaces();
+    }
+
+private:
+    static std::vector<ParamIndex> destinations(const MidiMapping& mapping, size_t source) {
+        std::vector<ParamIndex> result;
+        mapping.ForEachDestination(source, [&result](ParamIndex index) { result.push_back(index); });
+        return result;
+    }
+
+    void testRouting() {
+        MidiMapping mapping;
+        expect(destinations(mapping, 1).empty(), "New mapping should route nothing");
+
+        mapping.Map(1, ParamIndex::VcoRate);
+        mapping.Map(1, ParamIndex::DelayFeedback);
+        mapping.Map(MidiMapping::kPitchBendSource, ParamIndex::VcoRate);
+
+        const auto modWheel = destinations(mapping, 1);
+        expectEquals(static_cast<int>(modWheel.size()), 2);
+        expect(modWheel[0] == ParamIndex::VcoRate && modWheel[1] == ParamIndex::DelayFeedback);
+        expectEquals(static_cast<int>(destinations(mapping, MidiMapping::kPitchBendSource).size()), 1);
+        expect(mapping.HasMapping(ParamIndex::VcoRate));
+
+        mapping.Unmap(1, ParamIndex::VcoRate);
+        expectEquals(static_cast<int>(destinations(mapping, 1).size()), 1);
+
+        mapping.ClearAll();
+        expect(! mapping.HasMapping(ParamIndex::DelayFeedback));
+    }
+
+    void testLearn() {
+        MidiMapping mapping;
+        expect(! mapping.Learn(7), "Nothing to learn without StartLearn");
+
+        mapping.StartLearn(ParamIndex::DelayWetDry);
+        expectEquals(mapping.GetLearnTarget(), static_cast<int>(ParamIndex::DelayWetDry));
+
+        expect(mapping.Learn(MidiMapping::kChannelPressureSource));
+        expect(mapping.IsMapped(MidiMapping::kChannelPressureSource, ParamIndex::DelayWetDry));
+        expectEquals(mapping.GetLearnTarget(), MidiMapping::kNotLearning, "Learn should finish after one bind");
+
+        expect(! mapping.Learn(7), "A second controller shouldn't be bound");
+        expect(! mapping.IsMapped(7, ParamIndex::DelayWetDry));
+
+        mapping.StartLearn(ParamIndex::VcoLevel);
+        mapping.CancelLearn();
+        expect(! mapping.Learn(7), "Cancelled learn should bind nothing");
+    }
+
+    void testModeControllers() {
+        MidiMapping mapping;
+        mapping.StartLearn(ParamIndex::VcoRate);
+
+        expect(! mapping.Learn(123), "All Notes Off must not be learned");
+        expectEquals(mapping.GetLearnTarget(), static_cast<int>(ParamIndex::VcoRate), "Learn should keep waiting");
+
+        expect(mapping.Learn(119));
+        expect(mapping.IsMapped(119, ParamIndex::VcoRate));
+    }
+
+    void testLearnReplaces() {
+        MidiMapping mapping;
+        mapping.Map(1, ParamIndex::Lfo1Rate);
+        mapping.Map(1, ParamIndex::VcoRate);
+
+        mapping.StartLearn(ParamIndex::Lfo1Rate);
+        mapping.Learn(74);
+
+        expect(mapping.IsMapped(74, ParamIndex::Lfo1Rate));
+        expect(! mapping.IsMapped(1, ParamIndex::Lfo1Rate), "Learn should replace the old source");
+        expect(mapping.IsMapped(1, ParamIndex::VcoRate), "Other parameters keep their mappings");
+    }
+};
+
+static MidiMappingTest midiMappingTest;
@@ -0,0 +1,151 @@
+#include <juce_core/juce_core.h>
+#include "DSP/ModMatrix.h"
+
+using SimpleSynth::DSP::ModMatrix;
+
+/**
+ * Modulation Matrix Unit Tests
+ *
+ * Tests cover:
+ * - An empty matrix has no routes and writes zero outputs
+ * - Outputs are depth-weighted sums; slots sharing a route add up
+ * - Active source/destination lists follow the slots (cancelling routes drop out)
+ * - Unused sources are never read
+ * - Apply() scaling and clamping per destination
+ */
+
+class ModMatrixTest : public juce::UnitTest {
+public:
+    ModMatrixTest() : juce::UnitTest("ModMatrix Tests") {}
+
+    void runTest() override {
+        beginTest("Empty Matrix");
+        testEmpty();
+
+        beginTest("Weighted Sums");
+        testWeightedSums();
+
+        beginTest("Active Lists");
+        testActiveLists();
+
+        beginTest("Unused Sources Ignored");
+        testUnusedSources();
+
+        beginTest("Apply");
+        testApply();
+    }
+
+private:
+    using Source = ModMatrix::Source;
+    using Destination = ModMatrix::Destination;
+    using Outputs = std::array<float, ModMatrix::kDestinationStride>;
+
+    static float Output(const Outputs& outputs, Destination destination) {
+        return outputs[ModMatrix::DestinationIndex(destination)];
+    }
+
+    void testEmpty() {
+        ModMatrix matrix;
+        expect(! matrix.HasRoutes());
+        expectEquals(static_cast<int>(matrix.GetNumActiveDestinations()), 0);
+
+        const float sources[ModMatrix::kNumSources] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        Outputs outputs;
+        outputs.fill(7.0f);
+        matrix.Process(sources, outputs.data());
+        for (float value : outputs) {
+            expectEquals(value, 0.0f);
+        }
+
+        // Inactive slots don't count as routes
+        matrix.SetSlot(0, { Source::Lfo1, Destination::None, 1.0f });
+        matrix.SetSlot(1, { Source::None, Destination::VcoRate, 1.0f });
+        matrix.SetSlot(2, { Source::Lfo1, Destination::VcoRate, 0.0f });
+        expect(! matrix.HasRoutes());
+    }
+
+    void testWeightedSums() {
+        ModMatrix matrix;
+        matrix.SetSlot(0, { Source::Lfo1, Destination::VcoRate, 0.5f });
+        matrix.SetSlot(3, { Source::Envelope, Destination::VcoRate, -0.25f });
+        matrix.SetSlot(4, { Source::Velocity, Destination::DelayWetDry, 1.0f });
+        matrix.SetSlot(7, { Source::Velocity, Destination::DelayWetDry, 0.5f });
+
+        float sources[ModMatrix::kNumSources] = {};
+        sources[ModMatrix::SourceIndex(Source::Lfo1)] = 0.8f;
+        sources[ModMatrix::SourceIndex(Source::Envelope)] = 1.0f;
+        sources[ModMatrix::SourceIndex(Source::Velocity)] = 0.4f;
+
+        Outputs outputs;
+        matrix.Process(sources, outputs.data());
+        expectWithinAbsoluteError(Output(outputs, Destination::VcoRate), 0.5f * 0.8f - 0.25f, 1.0e-6f);
+        expectWithinAbsoluteError(Output(outputs, Destination::DelayWetDry), 1.5f * 0.4f, 1.0e-6f,
+            "Slots sharing a route should add their depths");
+        expectEquals(Output(outputs, Destination::DelayTime), 0.0f, "Unrouted destinations read zero");
+
+        // Clearing one slot leaves the others
+        matrix.SetSlot(3, {});
+        matrix.Process(sources, outputs.data());
+        expectWithinAbsoluteError(Output(outputs, Destination::VcoRate), 0.4f, 1.0e-6f);
+        expectEquals(matrix.GetSlot(0).depth, 0.5f);
+    }
+
+    void testActiveLists() {
+        ModMatrix matrix;
+        matrix.SetSlot(0, { Source::Lfo2, Destination::Lfo1Amount, 1.0f });
+        matrix.SetSlot(1, { Source::ModWheel, Destination::DelayTime, 0.3f });
+
+        expect(matrix.HasRoutes());
+        expect(matrix.UsesSource(Source::Lfo2) && matrix.UsesSource(Source::ModWheel));
+        expect(! matrix.UsesSource(Source::Lfo1) && ! matrix.UsesSource(Source::Noise));
+
+        expectEquals(static_cast<int>(matrix.GetNumActiveDestinations()), 2);
+        expect(matrix.GetActiveDestination(0) == Destination::DelayTime, "Destinations in enum order");
+        expect(matrix.GetActiveDestination(1) == Destination::Lfo1Amount);
+
+        // Two slots cancelling out cost nothing
+        matrix.SetSlot(2, { Source::ModWheel, Destination::DelayTime, -0.3f });
+        expect(! matrix.UsesSource(Source::ModWheel));
+        expectEquals(static_cast<int>(matrix.GetNumActiveDestinations()), 1);
+
+        matrix.Clear();
+        expect(! matrix.HasRoutes());
+        expect(matrix.GetSlot(0) == ModMatrix::Slot{});
+    }
+
+    void testUnusedSources() {
+        ModMatrix matrix;
+        matrix.SetSlot(0, { Source::Velocity, Destination::VcoLevel, 1.0f });
+
+        // Garbage in every unrouted source: the output only sees velocity
+        float sources[ModMatrix::kNumSources];
+        std::fill(std::begin(sources), std::end(sources), std::numeric_limits<float>::quiet_NaN());
+        sources[ModMatrix::SourceIndex(Source::Velocity)] = 0.7f;
+
+        Outputs outputs;
+        matrix.Process(sources, outputs.data());
+        expectEquals(Output(outputs, Destination::VcoLevel), 0.7f);
+        for (float value : outputs) {
+            expect(! std::isnan(value), "Unused sources should never be read");
+        }
+    }
+
+    void testApply() {
+        // Multiplicative: the original LFO 1 -> VCO Rate scaling
+        expectWithinAbsoluteError(ModMatrix::Apply(Destination::VcoRate, 440.0f, 0.1f), 440.0f * 1.4f, 1.0e-3f);
+        expectEquals(ModMatrix::Apply(Destination::VcoRate, 440.0f, 1.0f), 2000.0f, "Clamped to the VCO range");
+        expectEquals(ModMatrix::Apply(Destination::VcoRate, 440.0f, -1.0f), 20.0f);
+
+        // Additive
+        expectWithinAbsoluteError(ModMatrix::Apply(Destination::DelayWetDry, 0.4f, 0.5f), 0.55f, 1.0e-6f);
+        expectEquals(ModMatrix::Apply(Destination::DelayFeedback, 0.9f, 1.0f), 0.95f, "Clamped below runaway feedback");
+        expectEquals(ModMatrix::Apply(Destination::Lfo1Amount, 0.5f, 0.0f), 0.5f, "Zero modulation leaves the base");
+
+        for (int d = 1; d < static_cast<int>(Destination::Count); ++d) {
+            const auto& info = ModMatrix::GetDestinationInfo(static_cast<Destination>(d));
+            expect(info.minimum < info.maximum && info.scale > 0.0f, info.id);
+        }
+    }
+};
+
+static ModMatrixTest modMatrixTest;
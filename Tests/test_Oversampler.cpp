@@ -0,0 +1,159 @@
+#include <juce_core/juce_core.h>
+#include "DSP/Oversampler.h"
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+
+/**
+ * Oversampler Unit Tests
+ *
+ * Tests cover:
+ * - Bypass at factor 1
+ * - Passband gain at 2x and 4x
+ * - Image rejection above the host Nyquist
+ * - Reported latency per factor
+ * - The same measured delay at every factor
+ */
+
+class OversamplerTest : public juce::UnitTest {
+public:
+    OversamplerTest() : juce::UnitTest("Oversampler Tests") {}
+
+    void runTest() override {
+        beginTest("Bypass");
+        testBypass();
+
+        beginTest("Passband Gain");
+        testPassbandGain();
+
+        beginTest("Image Rejection");
+        testImageRejection();
+
+        beginTest("Latency");
+        testLatency();
+
+        beginTest("Matched Delay");
+        testMatchedDelay();
+    }
+
+private:
+    static constexpr size_t kBlockSize = 256;
+
+    // RMS gain (dB) of a sine at frequency (cycles per host-rate sample)
+    static float MeasureGainDb(size_t factor, float frequency) {
+        Oversampler oversampler;
+        oversampler.Init(kBlockSize);
+        oversampler.SetFactor(factor);
+
+        std::vector<float> output(kBlockSize);
+        double outputEnergy = 0.0;
+        double inputEnergy = 0.0;
+        size_t sampleIndex = 0;
+
+        for (int block = 0; block < 32; ++block) {
+            float* oversampled = oversampler.GetBuffer();
+            for (size_t i = 0; i < kBlockSize * factor; ++i, ++sampleIndex) {
+                double phase = static_cast<double>(frequency) * static_cast<double>(sampleIndex)
+                             / static_cast<double>(factor);
+                oversampled[i] = static_cast<float>(std::sin(2.0 * 3.141592653589793 * phase));
+            }
+            oversampler.Downsample(output.data(), kBlockSize);
+
+            // Skip the filter's settling time
+            if (block < 4) continue;
+            for (float sample : output) {
+                outputEnergy += sample * sample;
+                inputEnergy += 0.5;
+            }
+        }
+
+        return static_cast<float>(10.0 * std::log10(outputEnergy / inputEnergy + 1e-20));
+    }
+
+    void testBypass() {
+        Oversampler oversampler;
+        oversampler.Init(kBlockSize);
+        oversampler.SetFactor(1);
+
+        float* buffer = oversampler.GetBuffer();
+        for (size_t i = 0; i < kBlockSize; ++i) {
+            buffer[i] = static_cast<float>(i + 1);
+        }
+
+        std::vector<float> output(kBlockSize);
+        oversampler.Downsample(output.data(), kBlockSize);
+
+        const size_t latency = oversampler.GetLatencySamples();
+        expect(output[latency - 1] == 0.0f && output[latency] == 1.0f
+               && output[kBlockSize - 1] == static_cast<float>(kBlockSize - latency),
+            "Factor 1 should copy the buffer, delayed by the latency");
+    }
+
+    void testPassbandGain() {
+        for (size_t factor : { size_t(2), size_t(4) }) {
+            expectWithinAbsoluteError(MeasureGainDb(factor, 0.01f), 0.0f, 0.1f,
+                "Low frequencies should pass at unity");
+            expectWithinAbsoluteError(MeasureGainDb(factor, 0.45f), 0.0f, 0.1f,
+                "Passband should extend close to the host Nyquist");
+        }
+    }
+
+    void testImageRejection() {
+        for (size_t factor : { size_t(2), size_t(4) }) {
+            expectLessThan(MeasureGainDb(factor, 0.6f), -90.0f,
+                "Content above the host Nyquist should be rejected");
+        }
+    }
+
+    void testLatency() {
+        Oversampler oversampler;
+        oversampler.Init(kBlockSize);
+
+        expectEquals(static_cast<int>(oversampler.GetLatencySamples()), 3,
+            "Latency should be the 4x filters' delay (2.66), rounded");
+
+        for (size_t factor : { size_t(1), size_t(2), size_t(4) }) {
+            oversampler.SetFactor(factor);
+            expectEquals(static_cast<int>(oversampler.GetLatencySamples()), 3,
+                "Latency should be the same at every factor");
+            expectWithinAbsoluteError(oversampler.GetGroupDelay(), 3.0f, 0.5f,
+                "Padding should bring each factor within half a sample of the latency");
+        }
+
+        oversampler.SetFactor(2);
+        expectWithinAbsoluteError(oversampler.GetGroupDelay(), 2.99f, 0.1f,
+            "2x: filters (1.99) plus one sample");
+
+        oversampler.SetFactor(4);
+        expectWithinAbsoluteError(oversampler.GetGroupDelay(), 2.66f, 0.1f,
+            "4x: filters only");
+    }
+
+    void testMatchedDelay() {
+        // A slow ramp (value = host-rate time) comes out as time - delay
+        for (size_t factor : { size_t(1), size_t(2), size_t(4) }) {
+            Oversampler oversampler;
+            oversampler.Init(kBlockSize);
+            oversampler.SetFactor(factor);
+
+            std::vector<float> output(kBlockSize);
+            size_t sampleIndex = 0;
+            for (int block = 0; block < 8; ++block) {
+                float* oversampled = oversampler.GetBuffer();
+                for (size_t i = 0; i < kBlockSize * factor; ++i, ++sampleIndex) {
+                    oversampled[i] = static_cast<float>(sampleIndex) / static_cast<float>(factor);
+                }
+                oversampler.Downsample(output.data(), kBlockSize);
+            }
+
+            const float time = static_cast<float>(7 * kBlockSize + kBlockSize / 2);
+            const float delay = time - output[kBlockSize / 2];
+            expectWithinAbsoluteError(delay, static_cast<float>(oversampler.GetLatencySamples()), 0.5f,
+                "Every factor should delay the core by the reported latency");
+            expectWithinAbsoluteError(delay, oversampler.GetGroupDelay(), 0.05f,
+                "Measured delay should match the group delay");
+        }
+    }
+};
+
+static OversamplerTest oversamplerTest;
@@ -0,0 +1,115 @@
+#include <juce_core/juce_core.h>
+#include "DSP/ParameterSmoother.h"
+
+using SimpleSynth::DSP::ParameterSmoother;
+
+/**
+ * Parameter Smoother Unit Tests
+ *
+ * Tests cover:
+ * - Linear glide reaches the target in exactly the smoothing time
+ * - One-pole glide follows the time constant and settles
+ * - Control-rate steps match per-sample steps
+ * - Retargeting mid-glide and Reset()
+ */
+
+class ParameterSmootherTest : public juce::UnitTest {
+public:
+    ParameterSmootherTest() : juce::UnitTest("ParameterSmoother Tests") {}
+
+    void runTest() override {
+        beginTest("Linear Glide Time");
+        testLinear();
+
+        beginTest("One-Pole Time Constant");
+        testOnePole();
+
+        beginTest("Control Rate Matches Per-Sample");
+        testControlRate();
+
+        beginTest("Retarget And Reset");
+        testRetarget();
+    }
+
+private:
+    static constexpr float kSampleRate = 48000.0f;
+
+    static ParameterSmoother makeSmoother(ParameterSmoother::Mode mode, float seconds) {
+        ParameterSmoother smoother;
+        smoother.Init(kSampleRate);
+        smoother.SetMode(mode);
+        smoother.SetTime(seconds);
+        smoother.Reset(0.0f);
+        return smoother;
+    }
+
+    void testLinear() {
+        auto smoother = makeSmoother(ParameterSmoother::Mode::Linear, 0.01f); // 480 samples
+        smoother.SetTarget(1.0f);
+
+        smoother.Advance(240);
+        expectWithinAbsoluteError(smoother.GetValue(), 0.5f, 1.0e-4f, "Halfway through the time, halfway there");
+        expect(smoother.IsSmoothing());
+
+        smoother.Advance(239);
+        expect(smoother.IsSmoothing(), "Should still glide one sample before the end");
+
+        smoother.Advance(1);
+        expectEquals(smoother.GetValue(), 1.0f, "Should land exactly on the target");
+        expect(! smoother.IsSmoothing());
+    }
+
+    void testOnePole() {
+        auto smoother = makeSmoother(ParameterSmoother::Mode::OnePole, 0.01f);
+        smoother.SetTarget(1.0f);
+
+        smoother.Advance(480);
+        expectWithinAbsoluteError(smoother.GetValue(), 1.0f - std::exp(-1.0f), 1.0e-3f,
+            "One time constant should cover 63%");
+
+        for (int i = 0; i < 200 && smoother.IsSmoothing(); ++i) {
+            smoother.Advance(32);
+        }
+        expect(! smoother.IsSmoothing(), "One-pole should snap to the target once inaudibly close");
+        expectEquals(smoother.GetValue(), 1.0f);
+    }
+
+    void testControlRate() {
+        for (auto mode : { ParameterSmoother::Mode::Linear, ParameterSmoother::Mode::OnePole }) {
+            auto perSample = makeSmoother(mode, 0.02f);
+            auto perBlock = makeSmoother(mode, 0.02f);
+            perSample.SetTarget(440.0f);
+            perBlock.SetTarget(440.0f);
+
+            for (int tick = 0; tick < 20; ++tick) {
+                for (int i = 0; i < 32; ++i) {
+                    perSample.Advance(1);
+                }
+                perBlock.Advance(32);
+            }
+
+            expectWithinAbsoluteError(perBlock.GetValue(), perSample.GetValue(), 0.01f,
+                "Stepping 32 samples at once should match 32 single steps");
+        }
+    }
+
+    void testRetarget() {
+        auto smoother = makeSmoother(ParameterSmoother::Mode::Linear, 0.01f);
+        smoother.SetTarget(1.0f);
+        smoother.Advance(240);
+
+        // New target: a fresh full-length ramp from the current value
+        smoother.SetTarget(0.0f);
+        smoother.Advance(240);
+        expectWithinAbsoluteError(smoother.GetValue(), 0.25f, 1.0e-4f);
+        smoother.Advance(240);
+        expectEquals(smoother.GetValue(), 0.0f);
+
+        smoother.SetTarget(5.0f);
+        smoother.Reset(2.0f);
+        expectEquals(smoother.GetValue(), 2.0f);
+        expect(! smoother.IsSmoothing(), "Reset should jump without gliding");
+    }
+};
+
+static ParameterSmootherTest parameterSmootherTest;
@@ -0,0 +1,189 @@
+#include <juce_core/juce_core.h>
+#include "DSP/PartitionedConvolver.h"
+#include <cmath>
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+
+/**
+ * Partitioned Convolver Unit Tests
+ *
+ * Tests cover:
+ * - FFT against a direct DFT, and the inverse round trip
+ * - Kernel split into head taps and tail partitions
+ * - Output matches direct convolution for IRs within the head, one
+ *   partition past it and several partitions long, at block sizes that
+ *   do and don't line up with the partitions
+ * - Zero latency: an impulse returns the IR's first tap at once
+ * - Mix 0 bypasses the convolver and leaves the buffer untouched
+ */
+
+class PartitionedConvolverTest : public juce::UnitTest {
+public:
+    PartitionedConvolverTest() : juce::UnitTest("Partitioned Convolver Tests") {}
+
+    void runTest() override {
+        beginTest("FFT Matches DFT");
+        testFftMatchesDft();
+
+        beginTest("Kernel Partitions");
+        testKernelPartitions();
+
+        beginTest("Matches Direct Convolution");
+        testMatchesDirectConvolution();
+
+        beginTest("Zero Latency");
+        testZeroLatency();
+
+        beginTest("Mix Zero Bypasses");
+        testMixZeroBypasses();
+    }
+
+private:
+    static constexpr size_t kPartition = ConvolutionKernel::kPartitionSize;
+
+    // Decaying noise, like a spring or room recording
+    static std::vector<float> MakeImpulse(size_t length, uint32_t seed) {
+        XorShift32 noise(seed);
+        std::vector<float> impulse(length);
+        for (size_t i = 0; i < length; ++i) {
+            impulse[i] = noise.NextBipolar() * std::exp(-3.0f * static_cast<float>(i) / static_cast<float>(length));
+        }
+        return impulse;
+    }
+
+    static std::vector<float> MakeInput(size_t length) {
+        XorShift32 noise(7);
+        std::vector<float> input(length);
+        for (auto& sample : input) {
+            sample = noise.NextBipolar();
+        }
+        return input;
+    }
+
+    static std::vector<float> DirectConvolution(const std::vector<float>& input, const std::vector<float>& impulse) {
+        std::vector<float> output(input.size(), 0.0f);
+        for (size_t n = 0; n < input.size(); ++n) {
+            double sum = 0.0;
+            for (size_t k = 0; k < impulse.size() && k <= n; ++k) {
+                sum += static_cast<double>(impulse[k]) * input[n - k];
+            }
+            output[n] = static_cast<float>(sum);
+        }
+        return output;
+    }
+
+    void testFftMatchesDft() {
+        constexpr size_t size = 64;
+        Fft fft;
+        fft.Init(size);
+
+        const auto input = MakeInput(size);
+        std::vector<float> real(input), imag(size, 0.0f);
+        fft.Forward(real.data(), imag.data());
+
+        float maxError = 0.0f;
+        for (size_t k = 0; k < size; ++k) {
+            double dftReal = 0.0, dftImag = 0.0;
+            for (size_t n = 0; n < size; ++n) {
+                const double angle = -2.0 * 3.14159265358979323846 * static_cast<double>(k * n) / size;
+                dftReal += input[n] * std::cos(angle);
+                dftImag += input[n] * std::sin(angle);
+            }
+            maxError = std::max(maxError, std::abs(real[k] - static_cast<float>(dftReal)));
+            maxError = std::max(maxError, std::abs(imag[k] - static_cast<float>(dftImag)));
+        }
+        expect(maxError < 1.0e-4f, "Forward transform should match the DFT, error " + juce::String(maxError));
+
+        fft.Inverse(real.data(), imag.data());
+        float roundTrip = 0.0f;
+        for (size_t n = 0; n < size; ++n) {
+            roundTrip = std::max(roundTrip, std::abs(real[n] - input[n]));
+            roundTrip = std::max(roundTrip, std::abs(imag[n]));
+        }
+        expect(roundTrip < 1.0e-5f, "Inverse should undo forward, error " + juce::String(roundTrip));
+    }
+
+    void testKernelPartitions() {
+        ConvolutionKernel shortKernel(MakeImpulse(100, 1).data(), 100);
+        expectEquals(static_cast<int>(shortKernel.GetHeadSize()), 100, "A short IR is all head");
+        expectEquals(static_cast<int>(shortKernel.GetNumPartitions()), 0);
+
+        const size_t length = 3 * kPartition + 10;
+        ConvolutionKernel longKernel(MakeImpulse(length, 2).data(), length);
+        expectEquals(static_cast<int>(longKernel.GetHeadSize()), static_cast<int>(kPartition));
+        expectEquals(static_cast<int>(longKernel.GetNumPartitions()), 3);
+        expectEquals(static_cast<int>(longKernel.GetLength()), static_cast<int>(length));
+    }
+
+    void testMatchesDirectConvolution() {
+        const auto input = MakeInput(6 * kPartition + 123);
+
+        for (size_t length : { static_cast<size_t>(37), kPartition, kPartition + 1, 4 * kPartition + 77 }) {
+            const auto impulse = MakeImpulse(length, static_cast<uint32_t>(length));
+            const auto expected = DirectConvolution(input, impulse);
+            ConvolutionKernel kernel(impulse.data(), impulse.size());
+
+            for (size_t blockSize : { static_cast<size_t>(1), static_cast<size_t>(100), kPartition, static_cast<size_t>(1500) }) {
+                PartitionedConvolver convolver;
+                convolver.Init(&kernel);
+                convolver.SetMix(1.0f);
+
+                auto output = input;
+                for (size_t start = 0; start < output.size(); start += blockSize) {
+                    convolver.Process(output.data() + start, std::min(blockSize, output.size() - start));
+                }
+
+                float maxError = 0.0f;
+                for (size_t i = 0; i < output.size(); ++i) {
+                    maxError = std::max(maxError, std::abs(output[i] - expected[i]));
+                }
+                expect(maxError < 1.0e-4f, "IR " + juce::String(static_cast<int>(length)) + ", block "
+                                               + juce::String(static_cast<int>(blockSize)) + ": error "
+                                               + juce::String(maxError));
+            }
+        }
+    }
+
+    void testZeroLatency() {
+        std::vector<float> impulse(3 * kPartition, 0.0f);
+        impulse[0] = 0.5f;
+        impulse[2 * kPartition + 5] = 0.25f;
+        ConvolutionKernel kernel(impulse.data(), impulse.size());
+
+        PartitionedConvolver convolver;
+        convolver.Init(&kernel);
+        convolver.SetMix(1.0f);
+
+        std::vector<float> buffer(4 * kPartition, 0.0f);
+        buffer[0] = 1.0f;
+        convolver.Process(buffer.data(), buffer.size());
+
+        expectWithinAbsoluteError(buffer[0], 0.5f, 1.0e-6f, "First tap should come out at once");
+        expectWithinAbsoluteError(buffer[2 * kPartition + 5], 0.25f, 1.0e-5f, "Tail tap should land in place");
+        expectWithinAbsoluteError(buffer[2 * kPartition + 4], 0.0f, 1.0e-5f);
+    }
+
+    void testMixZeroBypasses() {
+        const auto impulse = MakeImpulse(2 * kPartition, 3);
+        ConvolutionKernel kernel(impulse.data(), impulse.size());
+
+        PartitionedConvolver convolver;
+        convolver.Init(&kernel);
+        convolver.SetMix(0.0f);
+
+        auto buffer = MakeInput(512);
+        const auto original = buffer;
+        convolver.Process(buffer.data(), buffer.size());
+        expect(buffer == original, "Mix 0 should leave the buffer untouched");
+        expect(! convolver.IsActive(), "Mix 0 should bypass the convolver");
+
+        PartitionedConvolver empty;
+        empty.Init(nullptr);
+        empty.SetMix(1.0f);
+        empty.Process(buffer.data(), buffer.size());
+        expect(buffer == original, "Without a kernel the convolver should be off");
+    }
+};
+
+static PartitionedConvolverTest partitionedConvolverTest;
@@ -0,0 +1,118 @@
+#include <juce_core/juce_core.h>
+#include "DSP/PitchGlide.h"
+
+using SimpleSynth::DSP::PitchGlide;
+
+/**
+ * Pitch Glide Unit Tests
+ *
+ * Tests cover:
+ * - Glides are linear in pitch (log frequency) and take the set time
+ * - Targets are reached exactly despite accumulated multiplies
+ * - Control-rate steps match per-sample steps
+ * - Zero time and Reset() jump
+ */
+
+class PitchGlideTest : public juce::UnitTest {
+public:
+    PitchGlideTest() : juce::UnitTest("PitchGlide Tests") {}
+
+    void runTest() override {
+        beginTest("Even In Pitch");
+        testEvenInPitch();
+
+        beginTest("Lands On Target");
+        testLandsOnTarget();
+
+        beginTest("Control Rate Matches Per-Sample");
+        testControlRate();
+
+        beginTest("Jumps");
+        testJumps();
+    }
+
+private:
+    static constexpr float kSampleRate = 48000.0f;
+
+    static PitchGlide makeGlide(float seconds, float start) {
+        PitchGlide glide;
+        glide.Init(kSampleRate);
+        glide.SetTime(seconds);
+        glide.Reset(start);
+        return glide;
+    }
+
+    void testEvenInPitch() {
+        // Two octaves up in 0.1 s: one octave at the halfway point
+        auto glide = makeGlide(0.1f, 100.0f);
+        glide.SetTarget(400.0f);
+
+        for (int i = 0; i < 2400; ++i) {
+            glide.Process();
+        }
+        expectWithinAbsoluteError(glide.GetValue(), 200.0f, 0.01f, "Halfway in time should be halfway in pitch");
+
+        for (int i = 0; i < 1200; ++i) {
+            glide.Process();
+        }
+        expectWithinAbsoluteError(glide.GetValue(), 200.0f * std::sqrt(2.0f), 0.01f);
+        expect(glide.IsGliding());
+    }
+
+    void testLandsOnTarget() {
+        auto glide = makeGlide(1.5f, 1.0f);
+        glide.SetTarget(0.25f);
+
+        for (int i = 0; i < 71999; ++i) {
+            glide.Process();
+        }
+        expect(glide.IsGliding(), "Should glide for exactly the set time");
+
+        glide.Process();
+        expectEquals(glide.GetValue(), 0.25f, "Should land exactly on the target");
+        expect(! glide.IsGliding());
+    }
+
+    void testControlRate() {
+        auto perSample = makeGlide(0.05f, 440.0f);
+        auto perBlock = makeGlide(0.05f, 440.0f);
+        perSample.SetTarget(110.0f);
+        perBlock.SetTarget(110.0f);
+
+        for (int tick = 0; tick < 50; ++tick) {
+            for (int i = 0; i < 32; ++i) {
+                perSample.Process();
+            }
+            perBlock.Advance(32);
+        }
+        expectWithinAbsoluteError(perBlock.GetValue(), perSample.GetValue(), 1.0e-3f,
+            "Stepping 32 samples at once should match 32 single steps");
+
+        // Final partial interval snaps to the target
+        perBlock.Advance(2400);
+        expectEquals(perBlock.GetValue(), 110.0f);
+        expect(! perBlock.IsGliding());
+
+        // Retarget mid-glide: a fresh full-length glide from where we are
+        perBlock.SetTarget(220.0f);
+        perBlock.Advance(1200);
+        expectWithinAbsoluteError(perBlock.GetValue(), 110.0f * std::sqrt(2.0f), 1.0e-2f);
+    }
+
+    void testJumps() {
+        auto glide = makeGlide(0.0f, 1.0f);
+        glide.SetTarget(2.0f);
+        expectEquals(glide.GetValue(), 2.0f, "Zero time should jump");
+        expect(! glide.IsGliding());
+
+        glide.SetTime(0.1f);
+        glide.SetTarget(4.0f);
+        glide.Advance(100);
+        glide.Reset(3.0f);
+        expectEquals(glide.GetValue(), 3.0f);
+        expectEquals(glide.GetTarget(), 3.0f);
+        expect(! glide.IsGliding(), "Reset should cancel the glide");
+    }
+};
+
+static PitchGlideTest pitchGlideTest;
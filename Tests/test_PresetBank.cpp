@@ -0,0 +1,145 @@
+#include <juce_core/juce_core.h>
+#include "Control/PresetBank.h"
+
+using namespace SimpleSynth::Control;
+
+/**
+ * Preset Bank Unit Tests
+ *
+ * Tests cover:
+ * - Records come back by program number with their names
+ * - Name lookup through the hash index, across a large bank
+ * - Long names are found by their full name, cut as they were stored
+ * - Columns are matched by id hash; unknown ones fall back to defaults
+ * - Truncated banks and index entries off the record grid are rejected
+ */
+
+class PresetBankTest : public juce::UnitTest {
+public:
+    PresetBankTest() : juce::UnitTest("PresetBank Tests") {}
+
+    void runTest() override {
+        beginTest("Records");
+        testRecords();
+
+        beginTest("Name Lookup");
+        testNameLookup();
+
+        beginTest("Columns");
+        testColumns();
+
+        beginTest("Damaged Banks");
+        testDamaged();
+    }
+
+private:
+    static std::vector<PresetBank::Preset> makePresets(int count) {
+        std::vector<PresetBank::Preset> presets(static_cast<size_t>(count));
+        for (int n = 0; n < count; ++n) {
+            auto& preset = presets[static_cast<size_t>(n)];
+            preset.name = "Preset " + std::to_string(n);
+            for (size_t i = 0; i < kNumParameters; ++i) {
+                preset.values[i] = static_cast<float>(n) + 0.01f * static_cast<float>(i);
+            }
+        }
+        return presets;
+    }
+
+    static std::vector<uint8_t> makeBank(const std::vector<PresetBank::Preset>& presets) {
+        std::vector<uint8_t> data;
+        PresetBank::Write(data, presets);
+        return data;
+    }
+
+    void testRecords() {
+        auto presets = makePresets(3);
+        presets[2].name = "A name well over thirty-two bytes long";
+        const auto data = makeBank(presets);
+
+        PresetBank bank;
+        expect(bank.Open(data.data(), data.size()));
+        expectEquals(static_cast<int>(bank.GetNumPresets()), 3);
+        expect(bank.GetName(0) == "Preset 0");
+        expect(bank.GetName(2) == std::string_view(presets[2].name).substr(0, PresetBank::kNameSize),
+               "Long names are cut to the record");
+
+        float defaults[kNumParameters] = {};
+        float values[kNumParameters] = {};
+        bank.GetValues(1, values, defaults);
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            expectEquals(values[i], presets[1].values[i]);
+        }
+    }
+
+    void testNameLookup() {
+        const auto presets = makePresets(5000);
+        const auto data = makeBank(presets);
+
+        PresetBank bank;
+        expect(bank.Open(data.data(), data.size()));
+
+        bool allFound = true;
+        for (int n = 0; n < 5000; n += 7) {
+            allFound = allFound && bank.FindPreset("Preset " + std::to_string(n)) == n;
+        }
+        expect(allFound, "Every name should map to its program number");
+        expectEquals(bank.FindPreset("Missing"), -1);
+        expectEquals(bank.FindPreset(""), -1);
+
+        // Stored cut to kNameSize; the full name still finds it
+        auto longNames = makePresets(2);
+        longNames[1].name = "A name well over thirty-two bytes long";
+        const auto longData = makeBank(longNames);
+        expect(bank.Open(longData.data(), longData.size()));
+        expectEquals(bank.FindPreset(longNames[1].name), 1);
+        expectEquals(bank.FindPreset(std::string_view(longNames[1].name).substr(0, PresetBank::kNameSize)), 1);
+    }
+
+    void testColumns() {
+        const auto presets = makePresets(2);
+        auto data = makeBank(presets);
+
+        // A column from a newer build in place of VCO Rate's
+        const size_t column = PresetBank::kHeaderSize + 4 * static_cast<size_t>(ParamIndex::VcoRate);
+        const uint32_t unknown = StateFormat::HashId("futureParam");
+        for (size_t i = 0; i < 4; ++i) {
+            data[column + i] = static_cast<uint8_t>(unknown >> (8 * i));
+        }
+
+        PresetBank bank;
+        expect(bank.Open(data.data(), data.size()));
+
+        float defaults[kNumParameters];
+        float values[kNumParameters] = {};
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            defaults[i] = -1.0f;
+        }
+        bank.GetValues(1, values, defaults);
+        expectEquals(values[static_cast<size_t>(ParamIndex::VcoRate)], -1.0f, "Missing parameters take defaults");
+        expectEquals(values[static_cast<size_t>(ParamIndex::DelayTime)],
+                     presets[1].values[static_cast<size_t>(ParamIndex::DelayTime)]);
+    }
+
+    void testDamaged() {
+        const auto data = makeBank(makePresets(4));
+        PresetBank bank;
+
+        for (size_t size : { size_t(0), size_t(15), size_t(16), data.size() - 1 }) {
+            expect(! bank.Open(data.data(), size), "Truncated to " + juce::String(static_cast<int>(size)));
+            expectEquals(static_cast<int>(bank.GetNumPresets()), 0);
+        }
+
+        // First index entry's offset nudged off the record grid
+        auto offGrid = data;
+        offGrid[PresetBank::kHeaderSize + 4 * kNumParameters + 4] += 1;
+        expect(! bank.Open(offGrid.data(), offGrid.size()));
+
+        auto future = data;
+        future[4] = static_cast<uint8_t>(PresetBank::kVersion + 1);
+        expect(! bank.Open(future.data(), future.size()));
+
+        expect(bank.Open(data.data(), data.size()), "The intact bank still opens");
+    }
+};
+
+static PresetBankTest presetBankTest;
@@ -0,0 +1,599 @@
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "PluginProcessor.h"
+#include "Perf/RealtimeChecker.h"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <thread>
+
+using SimpleSynth::Perf::RealtimeChecker;
+using SimpleSynth::Perf::ScopedRealtimeSection;
+
+/**
+ * Realtime-Safety Tests
+ *
+ * Built into DubSiren_RealtimeTests with RealtimeInterpose.cpp linked in,
+ * so any allocation or mutex lock inside processBlock counts as a
+ * violation (and prints its call stack).
+ *
+ * Tests cover:
+ * - The checker catches allocations and locks
+ * - processBlock across every LFO routing, quality/oversampling setting,
+ *   head count and tape setting, realtime and offline
+ * - Control events (triggers, hold, dive, parameter gestures) merged into processBlock
+ * - Dense MIDI CC, pitch bend and pressure streams through learned mappings
+ * - Key-tracked notes with glide, and tunings handed over mid-stream
+ * - A full modulation matrix, with slots changed between blocks
+ * - Scene morphs swept and switched during playback
+ * - Whole states loaded between blocks and from another thread mid-block
+ * - The analyzer feed, with and without a consumer draining it
+ * - Recording to WAV and FLAC while the writer thread drains the ring
+ * - The reverb switched in and out, resized and retuned between blocks
+ * - The spring convolution switched in and out, with an IR at another
+ *   sample rate than the host's
+ * - The resonant filter in each mode, its cutoff and resonance swept by
+ *   the matrix across the quality tiers
+ */
+
+class RealtimeSafetyTest : public juce::UnitTest {
+public:
+    RealtimeSafetyTest() : juce::UnitTest("Realtime Safety Tests") {}
+
+    void runTest() override {
+        beginTest("Checker Is Active");
+        testCheckerDetects();
+
+        beginTest("processBlock Is Allocation And Lock Free");
+        testProcessBlock();
+
+        beginTest("Control Events Are Allocation And Lock Free");
+        testControlEvents();
+
+        beginTest("MIDI Controllers Are Allocation And Lock Free");
+        testMidiControllers();
+
+        beginTest("Key Tracking Is Allocation And Lock Free");
+        testKeyTracking();
+
+        beginTest("Modulation Matrix Is Allocation And Lock Free");
+        testModulationMatrix();
+
+        beginTest("Scene Morphs Are Allocation And Lock Free");
+        testSceneMorph();
+
+        beginTest("State Loads Are Allocation And Lock Free");
+        testStateLoads();
+
+        beginTest("Analysis Tap Is Allocation And Lock Free");
+        testAnalysisTap();
+
+        beginTest("Recording Is Allocation And Lock Free");
+        testRecording();
+
+        beginTest("Reverb Is Allocation And Lock Free");
+        testReverb();
+
+        beginTest("Spring Convolution Is Allocation And Lock Free");
+        testSpring();
+
+        beginTest("Resonant Filter Is Allocation And Lock Free");
+        testFilter();
+    }
+
+private:
+    static constexpr double kSampleRate = 48000.0;
+    static constexpr int kBlockSize = 256;
+
+    void testCheckerDetects() {
+        expect(RealtimeChecker::IsAvailable(), "Interposer should be linked into this executable");
+
+        RealtimeChecker::SetReportStacks(false);
+        RealtimeChecker::ResetViolations();
+        {
+            ScopedRealtimeSection section;
+            std::unique_ptr<int> allocation(new int(1));
+        }
+        expectGreaterThan(static_cast<int>(RealtimeChecker::GetNumViolations()), 0,
+            "Allocation inside a section should be flagged");
+
+        RealtimeChecker::ResetViolations();
+        {
+            std::mutex mutex;
+            ScopedRealtimeSection section;
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        expectGreaterThan(static_cast<int>(RealtimeChecker::GetNumViolations()), 0,
+            "Mutex lock inside a section should be flagged");
+
+        RealtimeChecker::ResetViolations();
+        {
+            std::unique_ptr<int> allocation(new int(1));
+        }
+        expectEquals(static_cast<int>(RealtimeChecker::GetNumViolations()), 0,
+            "Allocation outside a section should be ignored");
+
+        RealtimeChecker::SetReportStacks(true);
+    }
+
+    // Set a parameter by its real (unnormalised) value
+    static void setParameter(SimpleSynthProcessor& processor, const char* id, float value) {
+        auto* parameter = processor.getParameters().getParameter(id);
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    // A prepared processor with a note to play; buffers and MIDI are
+    // built here, outside the realtime sections
+    struct Fixture {
+        SimpleSynthProcessor processor;
+        juce::AudioBuffer<float> buffer { 1, kBlockSize };
+        juce::MidiBuffer noteOn, noteOff, empty;
+
+        Fixture() {
+            processor.prepareToPlay(kSampleRate, kBlockSize);
+            setNote(17, 101);
+        }
+
+        void setNote(int onSample, int offSample) {
+            noteOn.clear();
+            noteOff.clear();
+            noteOn.addEvent(juce::MidiMessage::noteOn(1, 60, 0.9f), onSample);
+            noteOff.addEvent(juce::MidiMessage::noteOff(1, 60), offSample);
+        }
+
+        void set(const char* id, float value) { setParameter(processor, id, value); }
+
+        // Note on, held, note off, released
+        void renderBlocks() {
+            processor.processBlock(buffer, noteOn);
+            processor.processBlock(buffer, empty);
+            processor.processBlock(buffer, noteOff);
+            processor.processBlock(buffer, empty);
+        }
+    };
+
+    using Step = std::function<void(Fixture&)>;
+
+    // Runs setup, then render with the checker counting: any allocation
+    // or lock in processBlock during render fails the case
+    void expectRealtimeSafe(const juce::String& what, const Step& setup, const Step& render) {
+        juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+        Fixture fixture;
+        if (setup)
+            setup(fixture);
+
+        RealtimeChecker::ResetViolations();
+        render(fixture);
+        expectEquals(static_cast<int>(RealtimeChecker::GetNumViolations()), 0,
+            what + " should never allocate or lock (see stacks above)");
+
+        fixture.processor.releaseResources();
+    }
+
+    void testProcessBlock() {
+        // Quality presets, then Custom with every oversampling mode
+        const std::pair<int, int> qualityModes[] = {
+            { 0, 0 }, { 1, 0 }, { 2, 0 }, { 3, 0 },
+            { 4, 0 }, { 4, 1 }, { 4, 2 }, { 4, 3 }, { 4, 4 }
+        };
+
+        expectRealtimeSafe("processBlock", {}, [&](Fixture& fixture) {
+            int numCombinations = 0;
+
+            for (bool offline : { false, true }) {
+                fixture.processor.setNonRealtime(offline);
+
+                for (const auto& [quality, oversampling] : qualityModes)
+                for (int lfo1Target = 0; lfo1Target < 4; ++lfo1Target)
+                for (int lfo2Target = 0; lfo2Target < 4; ++lfo2Target)
+                for (int heads : { 1, 4 })
+                for (bool tape : { false, true }) {
+                    fixture.set("quality", static_cast<float>(quality));
+                    fixture.set("oversampling", static_cast<float>(oversampling));
+                    fixture.set("lfo1Target", static_cast<float>(lfo1Target));
+                    fixture.set("lfo2Target", static_cast<float>(lfo2Target));
+                    fixture.set("delayHeads", static_cast<float>(heads));
+                    fixture.set("delayTape", tape ? 1.0f : 0.0f);
+
+                    fixture.renderBlocks();
+                    ++numCombinations;
+                }
+            }
+
+            logMessage("Rendered " + juce::String(numCombinations) + " routing combinations");
+        });
+    }
+
+    void testControlEvents() {
+        using SimpleSynth::Control::ControlEvent;
+        using SimpleSynth::Control::ParamIndex;
+
+        expectRealtimeSafe("Control events", {}, [&](Fixture& fixture) {
+            auto push = [&fixture](ControlEvent::Type type, float value, float duration, ParamIndex parameter) {
+                ControlEvent event;
+                event.type = type;
+                event.value = value;
+                event.duration = duration;
+                event.parameter = parameter;
+                fixture.processor.pushControlEvent(event);
+            };
+
+            for (int lfo1Target = 0; lfo1Target < 4; ++lfo1Target) {
+                fixture.set("lfo1Target", static_cast<float>(lfo1Target));
+
+                push(ControlEvent::Type::TriggerOn, 1.0f, 0.0f, ParamIndex::VcoRate);
+                push(ControlEvent::Type::HoldOn, 0.0f, 0.0f, ParamIndex::VcoRate);
+                push(ControlEvent::Type::PitchDive, -2.0f, 0.01f, ParamIndex::VcoRate);
+                push(ControlEvent::Type::SetParameter, 1.0f, 0.0f, ParamIndex::DelayWetDry);
+                push(ControlEvent::Type::SetParameter, 0.9f, 0.0f, ParamIndex::DelayFeedback);
+                fixture.renderBlocks();
+
+                push(ControlEvent::Type::TriggerOff, 0.0f, 0.0f, ParamIndex::VcoRate);
+                push(ControlEvent::Type::PitchDive, 0.0f, 0.01f, ParamIndex::VcoRate);
+                push(ControlEvent::Type::ReleaseParameter, 0.0f, 0.0f, ParamIndex::DelayWetDry);
+                push(ControlEvent::Type::ReleaseParameter, 0.0f, 0.0f, ParamIndex::DelayFeedback);
+                push(ControlEvent::Type::HoldOff, 0.0f, 0.0f, ParamIndex::VcoRate);
+                fixture.renderBlocks();
+            }
+
+            expectEquals(static_cast<int>(fixture.processor.getControlEvents().GetNumDropped()), 0);
+        });
+    }
+
+    void testMidiControllers() {
+        using SimpleSynth::Control::MidiMapping;
+        using SimpleSynth::Control::ParamIndex;
+
+        auto setup = [](Fixture& fixture) {
+            auto& mapping = fixture.processor.getMidiMapping();
+            mapping.Map(1, ParamIndex::VcoRate);
+            mapping.Map(1, ParamIndex::DelayFeedback);
+            mapping.Map(MidiMapping::kPitchBendSource, ParamIndex::DelayTime);
+            mapping.Map(MidiMapping::kChannelPressureSource, ParamIndex::DelayWetDry);
+            mapping.StartLearn(ParamIndex::Lfo1Rate); // CC 74 below completes it
+
+            // A controller stream far denser than any hardware sends
+            fixture.setNote(0, 101);
+            for (int i = 0; i < kBlockSize; i += 4) {
+                fixture.noteOn.addEvent(juce::MidiMessage::controllerEvent(1, 1, (i / 2) % 128), i);
+                fixture.noteOn.addEvent(juce::MidiMessage::controllerEvent(1, 74, (i / 4) % 128), i);
+                fixture.noteOn.addEvent(juce::MidiMessage::pitchWheel(1, (i * 64) % 16384), i + 1);
+                fixture.noteOn.addEvent(juce::MidiMessage::channelPressureChange(1, (i / 2) % 128), i + 2);
+            }
+        };
+
+        expectRealtimeSafe("MIDI controllers", setup, [&](Fixture& fixture) {
+            for (int quality = 0; quality < 5; ++quality)
+            for (int lfo1Target = 0; lfo1Target < 4; ++lfo1Target) {
+                fixture.set("quality", static_cast<float>(quality));
+                fixture.set("lfo1Target", static_cast<float>(lfo1Target));
+                fixture.renderBlocks();
+            }
+
+            expect(fixture.processor.getMidiMapping().IsMapped(74, ParamIndex::Lfo1Rate),
+                "Learn should bind CC 74");
+        });
+    }
+
+    void testKeyTracking() {
+        auto setup = [](Fixture& fixture) {
+            fixture.set("keyTrack", 1.0f);
+
+            // Legato run across the keyboard, including keys the mapping leaves out
+            fixture.noteOn.clear();
+            fixture.noteOff.clear();
+            for (int i = 0; i < 16; ++i)
+                fixture.noteOn.addEvent(juce::MidiMessage::noteOn(1, 48 + i * 3, 0.8f), i * 16);
+            fixture.noteOff.addEvent(juce::MidiMessage::noteOff(1, 93), 10);
+        };
+
+        const char* const scale = "Pentatonic\n5\n9/8\n5/4\n3/2\n5/3\n2/1\n";
+        const char* const mapping = "12\n0\n127\n60\n69\n440.0\n5\n0\nx\n1\nx\n2\n3\nx\n4\nx\nx\nx\nx\n";
+
+        expectRealtimeSafe("Key tracking and tuning handover", setup, [&](Fixture& fixture) {
+            for (int quality = 0; quality < 5; ++quality)
+            for (float glide : { 0.0f, 0.05f, 1.0f }) {
+                fixture.set("quality", static_cast<float>(quality));
+                fixture.set("glide", glide);
+
+                // Tuning changes arrive between blocks, as from the editor
+                if (quality == 2)
+                    expect(fixture.processor.loadTuningScale(scale, "Pentatonic"));
+                if (quality == 3)
+                    expect(fixture.processor.loadTuningMapping(mapping, "Pentatonic keys"));
+
+                fixture.renderBlocks();
+            }
+
+            expectEquals(fixture.processor.getTuningName(), juce::String("Pentatonic / Pentatonic keys"));
+        });
+    }
+
+    void testModulationMatrix() {
+        using SimpleSynth::DSP::ModMatrix;
+
+        auto setup = [](Fixture& fixture) {
+            fixture.set("lfo1Target", 1.0f);
+            fixture.set("lfo2Target", 2.0f);
+            fixture.setNote(0, 128);
+            fixture.noteOn.addEvent(juce::MidiMessage::controllerEvent(1, 1, 100), 64);
+        };
+
+        // Every source and destination in use, rerouted between blocks as
+        // the editor would, across the quality tiers
+        const int numSources = static_cast<int>(ModMatrix::Source::Count) - 1;
+        const int numDestinations = static_cast<int>(ModMatrix::Destination::Count) - 1;
+
+        expectRealtimeSafe("Modulation matrix evaluation and slot handover", setup, [&](Fixture& fixture) {
+            for (int quality = 0; quality < 5; ++quality)
+            for (int offset = 0; offset < numDestinations; ++offset) {
+                fixture.set("quality", static_cast<float>(quality));
+
+                for (size_t i = 0; i < SimpleSynthProcessor::kNumUserModSlots; ++i) {
+                    const int source = static_cast<int>(i) % numSources + 1;
+                    const int destination = (static_cast<int>(i) + offset) % numDestinations + 1;
+                    fixture.processor.setModulationSlot(i, { static_cast<ModMatrix::Source>(source),
+                                                             static_cast<ModMatrix::Destination>(destination),
+                                                             (i % 2 == 0) ? 0.8f : -0.6f });
+                }
+
+                fixture.renderBlocks();
+            }
+        });
+    }
+
+    void testSceneMorph() {
+        auto setup = [this](Fixture& fixture) {
+            // Two scenes far apart
+            fixture.set("vcoRate", 220.0f);
+            fixture.set("delayTime", 0.2f);
+            fixture.processor.captureSnapshot(0);
+            fixture.set("vcoRate", 1200.0f);
+            fixture.set("delayTime", 1.5f);
+            fixture.set("delayWetDry", 0.9f);
+            fixture.processor.captureSnapshot(1);
+            expect(fixture.processor.hasSnapshot(0) && fixture.processor.hasSnapshot(1)
+                   && ! fixture.processor.hasSnapshot(2));
+
+            fixture.set("morphA", 1.0f);
+            fixture.set("morphB", 2.0f);
+            fixture.setNote(0, 200);
+        };
+
+        // Morph swept and scenes switched between blocks, as automation would
+        expectRealtimeSafe("Scene recall and morphing", setup, [](Fixture& fixture) {
+            for (int quality = 0; quality < 5; ++quality)
+            for (float morph : { 0.0f, 0.5f, 1.0f, 0.2f }) {
+                fixture.set("quality", static_cast<float>(quality));
+                fixture.set("morph", morph);
+                fixture.set("morphB", (quality % 2 == 0) ? 2.0f : 1.0f);
+
+                // Bank updates arrive mid-performance too
+                if (quality == 3)
+                    fixture.processor.captureSnapshot(2);
+
+                fixture.renderBlocks();
+            }
+        });
+    }
+
+    void testStateLoads() {
+        // Two presets far apart, with scenes and routes
+        juce::MemoryBlock presets[2];
+
+        auto setup = [&presets](Fixture& fixture) {
+            SimpleSynthProcessor source;
+            setParameter(source, "vcoRate", 220.0f);
+            setParameter(source, "delayHeads", 1.0f);
+            source.captureSnapshot(0);
+            source.getStateInformation(presets[0]);
+
+            setParameter(source, "vcoRate", 1500.0f);
+            setParameter(source, "delayHeads", 4.0f);
+            setParameter(source, "quality", 2.0f);
+            source.setModulationSlot(0, { SimpleSynth::DSP::ModMatrix::Source::Lfo2,
+                                          SimpleSynth::DSP::ModMatrix::Destination::DelayTime, 0.5f });
+            source.captureSnapshot(1);
+            source.getStateInformation(presets[1]);
+
+            fixture.setNote(0, 200);
+        };
+
+        expectRealtimeSafe("Picking up a loaded state", setup, [&presets](Fixture& fixture) {
+            auto& processor = fixture.processor;
+
+            // Between blocks, as a host recalling presets
+            for (int i = 0; i < 8; ++i) {
+                const auto& preset = presets[i % 2];
+                processor.setStateInformation(preset.getData(), static_cast<int>(preset.getSize()));
+                fixture.renderBlocks();
+            }
+
+            // While blocks render, as a host loading state off the audio thread
+            std::atomic<bool> loading { true };
+            std::thread loader([&] {
+                for (int i = 0; i < 200; ++i) {
+                    const auto& preset = presets[i % 2];
+                    processor.setStateInformation(preset.getData(), static_cast<int>(preset.getSize()));
+                }
+                loading.store(false);
+            });
+
+            while (loading.load())
+                fixture.renderBlocks();
+            loader.join();
+        });
+    }
+
+    void testAnalysisTap() {
+        auto setup = [](Fixture& fixture) {
+            fixture.setNote(0, 200);
+            fixture.processor.getAnalysisTap().SetEnabled(true);
+        };
+
+        expectRealtimeSafe("Feeding the analyzer", setup, [this](Fixture& fixture) {
+            auto& tap = fixture.processor.getAnalysisTap();
+
+            // Nobody draining: the ring fills and chunks are dropped
+            for (int i = 0; i < 40; ++i)
+                fixture.renderBlocks();
+            expectGreaterThan(static_cast<int>(tap.GetNumDropped()), 0);
+
+            // Drained from another thread, as the editor's timer would
+            std::atomic<bool> rendering { true };
+            int numChunks = 0;
+            std::thread reader([&] {
+                SimpleSynth::DSP::AnalysisTap::Chunk chunk;
+                while (rendering.load())
+                    while (tap.Pop(chunk))
+                        ++numChunks;
+            });
+
+            for (int i = 0; i < 40; ++i)
+                fixture.renderBlocks();
+            rendering.store(false);
+            reader.join();
+            expectGreaterThan(numChunks, 0);
+
+            // Switched off mid-stream, as when the editor closes
+            tap.SetEnabled(false);
+            fixture.renderBlocks();
+        });
+    }
+
+    void testRecording() {
+        constexpr int kNumRenders = 25;
+
+        for (const char* extension : { ".wav", ".flac" }) {
+            const auto file = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                  .getNonexistentChildFile("DubSirenRecording", extension, false);
+
+            auto setup = [this, &file](Fixture& fixture) {
+                fixture.setNote(0, 200);
+                expect(fixture.processor.startRecording(file));
+            };
+
+            expectRealtimeSafe("Recording to " + juce::String(extension), setup, [this](Fixture& fixture) {
+                // Rendered in real time, so the writer thread keeps up
+                for (int i = 0; i < kNumRenders; ++i) {
+                    fixture.renderBlocks();
+                    juce::Thread::sleep(20);
+                }
+
+                fixture.processor.stopRecording();
+                const auto& recorder = fixture.processor.getRecorder();
+                expect(! recorder.isRecording());
+                expectEquals(static_cast<int>(recorder.getNumDroppedSamples()), 0);
+                expectEquals(static_cast<int>(recorder.getNumSamplesWritten()), kNumRenders * 4 * kBlockSize,
+                    "Every rendered sample should reach the file");
+            });
+
+            juce::AudioFormatManager formats;
+            formats.registerBasicFormats();
+            std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+            expect(reader != nullptr, file.getFileName() + " should be readable");
+            if (reader != nullptr)
+                expectEquals(static_cast<int>(reader->lengthInSamples), kNumRenders * 4 * kBlockSize);
+
+            reader.reset();
+            file.deleteFile();
+        }
+    }
+
+    void testReverb() {
+        // From bypassed (mix 0) into the network
+        expectRealtimeSafe("The reverb", {}, [](Fixture& fixture) {
+            for (float mix : { 0.0f, 0.5f, 1.0f })
+            for (float size : { 0.0f, 0.5f, 1.0f })
+            for (float decay : { 0.1f, 10.0f }) {
+                fixture.set("reverbMix", mix);
+                fixture.set("reverbSize", size);
+                fixture.set("reverbDecay", decay);
+                fixture.set("reverbDamping", size);
+                fixture.renderBlocks();
+            }
+        });
+    }
+
+    static void setSpringImpulseVariable(const juce::String& path) {
+       #if JUCE_WINDOWS
+        _putenv_s("DUBSIREN_SPRING_IR", path.toRawUTF8());
+       #else
+        if (path.isEmpty())
+            unsetenv("DUBSIREN_SPRING_IR");
+        else
+            setenv("DUBSIREN_SPRING_IR", path.toRawUTF8(), 1);
+       #endif
+    }
+
+    void testSpring() {
+        // A 2.5 s decaying-noise IR at 44.1 kHz, resampled for the 48 kHz host
+        constexpr double kImpulseRate = 44100.0;
+        constexpr int kImpulseLength = static_cast<int>(2.5 * kImpulseRate);
+        const auto file = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                              .getNonexistentChildFile("DubSirenSpring", ".wav", false);
+        {
+            juce::AudioBuffer<float> impulse(1, kImpulseLength);
+            SimpleSynth::DSP::XorShift32 noise(5);
+            for (int i = 0; i < kImpulseLength; ++i)
+                impulse.setSample(0, i, noise.NextBipolar() * std::exp(-6.0f * static_cast<float>(i) / kImpulseLength));
+
+            juce::WavAudioFormat wav;
+            std::unique_ptr<juce::AudioFormatWriter> writer(
+                wav.createWriterFor(new juce::FileOutputStream(file), kImpulseRate, 1, 24, {}, 0));
+            expect(writer != nullptr);
+            if (writer != nullptr)
+                writer->writeFromAudioSampleBuffer(impulse, 0, kImpulseLength);
+        }
+        setSpringImpulseVariable(file.getFullPathName());
+
+        auto setup = [this](Fixture& fixture) {
+            fixture.set("springMix", 0.5f);
+            expectWithinAbsoluteError(fixture.processor.getTailLengthSeconds(), 2.5, 0.01,
+                "The IR should be loaded and set the tail");
+        };
+
+        // From bypassed (mix 0) into the convolver, with enough blocks for
+        // every partition boundary to come round
+        expectRealtimeSafe("The spring convolution", setup, [](Fixture& fixture) {
+            for (float mix : { 0.0f, 0.5f, 1.0f, 0.0f, 0.3f }) {
+                fixture.set("springMix", mix);
+                for (int i = 0; i < 8; ++i)
+                    fixture.renderBlocks();
+            }
+        });
+
+        setSpringImpulseVariable({});
+        file.deleteFile();
+    }
+
+    void testFilter() {
+        using SimpleSynth::DSP::ModMatrix;
+
+        auto setup = [](Fixture& fixture) {
+            fixture.set("lfo1Rate", 20.0f);
+            fixture.set("lfo1Amount", 1.0f);
+            fixture.processor.setModulationSlot(0, { ModMatrix::Source::Lfo1, ModMatrix::Destination::FilterCutoff, 1.0f });
+            fixture.processor.setModulationSlot(1, { ModMatrix::Source::Envelope, ModMatrix::Destination::FilterResonance, 1.0f });
+        };
+
+        // Off to each mode and back, at every tier's control interval and
+        // oversampling decimation
+        expectRealtimeSafe("The filter", setup, [](Fixture& fixture) {
+            for (int quality = 0; quality < 5; ++quality)
+            for (int mode : { 0, 1, 2, 0, 2 })
+            for (float cutoff : { 20.0f, 2000.0f, 20000.0f }) {
+                fixture.set("quality", static_cast<float>(quality));
+                fixture.set("filterMode", static_cast<float>(mode));
+                fixture.set("filterCutoff", cutoff);
+                fixture.set("filterResonance", cutoff / 20000.0f);
+                fixture.renderBlocks();
+            }
+        });
+    }
+};
+
+static RealtimeSafetyTest realtimeSafetyTest;
@@ -0,0 +1,256 @@
+#include <juce_core/juce_core.h>
+#include "DSP/ResonantFilter.h"
+#include <cmath>
+#include <vector>
+
+using namespace SimpleSynth::DSP;
+
+/**
+ * Resonant Filter Unit Tests
+ *
+ * Tests cover:
+ * - FastTan against tan() over the cutoff range
+ * - Low-pass and band-pass responses, and resonance raising the peak
+ * - A swept cutoff (targets every few samples) tracks a filter with
+ *   exact coefficients every sample
+ * - Targets past the end of a block carry over: split blocks match one
+ * - Unchanged targets don't recompute coefficients
+ * - Mode Off bypasses the filter and leaves the buffer untouched
+ * - Full-range sweeps at full resonance stay bounded
+ */
+
+class ResonantFilterTest : public juce::UnitTest {
+public:
+    ResonantFilterTest() : juce::UnitTest("Resonant Filter Tests") {}
+
+    void runTest() override {
+        beginTest("FastTan Accuracy");
+        testFastTan();
+
+        beginTest("Low-Pass Response");
+        testLowPass();
+
+        beginTest("Band-Pass Response");
+        testBandPass();
+
+        beginTest("Resonance Raises The Peak");
+        testResonance();
+
+        beginTest("Swept Cutoff Tracks Exact Coefficients");
+        testSweptCutoff();
+
+        beginTest("Targets Carry Across Blocks");
+        testTargetsCarryOver();
+
+        beginTest("Static Cutoff Computes Once");
+        testStaticCutoff();
+
+        beginTest("Off Bypasses");
+        testOffBypasses();
+
+        beginTest("Sweeps Stay Bounded");
+        testSweepsBounded();
+    }
+
+private:
+    static constexpr float kSampleRate = 48000.0f;
+
+    // Steady-state gain for a sine at frequency, after a second to settle
+    static float MeasureGain(ResonantFilter::Mode mode, float cutoff, float resonance, float frequency) {
+        ResonantFilter filter;
+        filter.Init(kSampleRate);
+        filter.SetMode(mode);
+        filter.SetTarget(cutoff, resonance, 0);
+
+        const size_t length = static_cast<size_t>(kSampleRate);
+        std::vector<float> buffer(length);
+        for (size_t i = 0; i < length; ++i) {
+            buffer[i] = std::sin(kTwoPi * frequency * static_cast<float>(i) / kSampleRate);
+        }
+        filter.Process(buffer.data(), buffer.size());
+
+        float peak = 0.0f;
+        for (size_t i = length / 2; i < length; ++i) {
+            peak = std::max(peak, std::abs(buffer[i]));
+        }
+        return peak;
+    }
+
+    void testFastTan() {
+        float maxError = 0.0f;
+        for (int i = 1; i <= 1000; ++i) {
+            const float x = 0.45f * kPi * static_cast<float>(i) / 1000.0f;
+            maxError = std::max(maxError, std::abs(FastTan(x) / std::tan(x) - 1.0f));
+        }
+        expect(maxError < 1.0e-4f, "FastTan relative error " + juce::String(maxError));
+    }
+
+    void testLowPass() {
+        expectWithinAbsoluteError(MeasureGain(ResonantFilter::Mode::LowPass, 1000.0f, 0.0f, 50.0f), 1.0f, 0.01f,
+                                  "Well below cutoff should pass");
+        expectLessThan(MeasureGain(ResonantFilter::Mode::LowPass, 1000.0f, 0.0f, 10000.0f), 0.02f,
+                       "A decade above should be 40 dB down");
+    }
+
+    void testBandPass() {
+        expectWithinAbsoluteError(MeasureGain(ResonantFilter::Mode::BandPass, 1000.0f, 0.5f, 1000.0f), 1.0f, 0.01f,
+                                  "Unity gain at the peak");
+        expectLessThan(MeasureGain(ResonantFilter::Mode::BandPass, 1000.0f, 0.5f, 100.0f), 0.2f);
+        expectLessThan(MeasureGain(ResonantFilter::Mode::BandPass, 1000.0f, 0.5f, 10000.0f), 0.2f);
+    }
+
+    void testResonance() {
+        // Low-pass gain at cutoff is Q: 0.5 flat, 10 at full resonance
+        expectWithinAbsoluteError(MeasureGain(ResonantFilter::Mode::LowPass, 1000.0f, 0.0f, 1000.0f), 0.5f, 0.01f);
+        expectWithinAbsoluteError(MeasureGain(ResonantFilter::Mode::LowPass, 1000.0f, 1.0f, 1000.0f), 10.0f, 0.2f);
+    }
+
+    void testSweptCutoff() {
+        constexpr size_t kLength = 48000;
+        constexpr size_t kInterval = 8;
+        constexpr float kResonance = 0.6f;
+
+        auto cutoffAt = [](size_t i) {
+            return 1000.0f * std::exp2(2.0f * std::sin(kTwoPi * 2.0f * static_cast<float>(i) / kSampleRate));
+        };
+
+        XorShift32 noise(3);
+        std::vector<float> input(kLength);
+        for (auto& sample : input) {
+            sample = noise.NextBipolar();
+        }
+
+        // Targets once per control interval, processed in 64-sample blocks
+        ResonantFilter filter;
+        filter.Init(kSampleRate);
+        filter.SetMode(ResonantFilter::Mode::LowPass);
+        filter.SetTarget(cutoffAt(0), kResonance, 0);
+
+        auto output = input;
+        for (size_t start = 0; start < kLength; start += 64) {
+            for (size_t offset = kInterval; offset <= 64; offset += kInterval) {
+                filter.SetTarget(cutoffAt(start + offset), kResonance, offset);
+            }
+            filter.Process(output.data() + start, 64);
+        }
+
+        // Same filter with tan() every sample, in double
+        const double k = 2.0 - 1.9 * kResonance;
+        double ic1 = 0.0, ic2 = 0.0, errorEnergy = 0.0, energy = 0.0;
+        for (size_t i = 0; i < kLength; ++i) {
+            const double g = std::tan(3.14159265358979323846 * cutoffAt(i + 1) / kSampleRate);
+            const double a1 = 1.0 / (1.0 + g * (g + k));
+            const double a2 = g * a1;
+            const double a3 = g * a2;
+
+            const double v3 = input[i] - ic2;
+            const double v1 = a1 * ic1 + a2 * v3;
+            const double v2 = ic2 + a2 * ic1 + a3 * v3;
+            ic1 = 2.0 * v1 - ic1;
+            ic2 = 2.0 * v2 - ic2;
+
+            errorEnergy += (output[i] - v2) * (output[i] - v2);
+            energy += v2 * v2;
+        }
+
+        const double errorDb = 10.0 * std::log10(errorEnergy / energy);
+        expectLessThan(errorDb, -60.0, "Swept output should be within -60 dB of exact coefficients");
+    }
+
+    void testTargetsCarryOver() {
+        XorShift32 noise(5);
+        std::vector<float> input(128);
+        for (auto& sample : input) {
+            sample = noise.NextBipolar();
+        }
+
+        ResonantFilter whole, split;
+        for (auto* filter : { &whole, &split }) {
+            filter->Init(kSampleRate);
+            filter->SetMode(ResonantFilter::Mode::BandPass);
+            filter->SetTarget(300.0f, 0.5f, 0);
+            filter->SetTarget(4000.0f, 0.9f, 40);
+            filter->SetTarget(800.0f, 0.2f, 100);
+        }
+
+        auto expected = input;
+        whole.Process(expected.data(), expected.size());
+
+        auto output = input;
+        split.Process(output.data(), 64);
+        expectEquals(static_cast<int>(split.GetNumPendingTargets()), 1, "The target at 100 carries over");
+        split.Process(output.data() + 64, 64);
+        expectEquals(static_cast<int>(split.GetNumPendingTargets()), 0);
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < input.size(); ++i) {
+            maxError = std::max(maxError, std::abs(output[i] - expected[i]));
+        }
+        expectLessThan(maxError, 1.0e-5f, "Split blocks should ramp as one");
+    }
+
+    void testStaticCutoff() {
+        ResonantFilter filter;
+        filter.Init(kSampleRate);
+        filter.SetMode(ResonantFilter::Mode::LowPass);
+
+        std::vector<float> buffer(256, 0.25f);
+        for (int block = 0; block < 100; ++block) {
+            for (size_t offset = 0; offset < buffer.size(); offset += 8) {
+                filter.SetTarget(2000.0f, 0.3f, offset);
+            }
+            filter.Process(buffer.data(), buffer.size());
+        }
+
+        expectEquals(static_cast<int>(filter.GetNumCoefficientUpdates()), 1, "Only the first target is new");
+        expectEquals(static_cast<int>(filter.GetNumPendingTargets()), 0);
+    }
+
+    void testOffBypasses() {
+        ResonantFilter filter;
+        filter.Init(kSampleRate);
+        filter.SetTarget(500.0f, 0.8f, 0);
+
+        XorShift32 noise(9);
+        std::vector<float> buffer(512);
+        for (auto& sample : buffer) {
+            sample = noise.NextBipolar();
+        }
+        const auto original = buffer;
+
+        filter.Process(buffer.data(), buffer.size());
+        expect(buffer == original, "Mode Off should leave the buffer untouched");
+        expect(! filter.IsActive());
+
+        filter.SetMode(ResonantFilter::Mode::BandPass);
+        filter.Process(buffer.data(), buffer.size());
+        expect(filter.IsActive());
+        expect(buffer != original, "Switched on, the filter should process");
+    }
+
+    void testSweepsBounded() {
+        ResonantFilter filter;
+        filter.Init(kSampleRate);
+        filter.SetMode(ResonantFilter::Mode::LowPass);
+
+        // Square-wave sweeps between the extremes every control interval
+        XorShift32 noise(11);
+        std::vector<float> buffer(64);
+        bool bounded = true;
+        for (int block = 0; block < 2000; ++block) {
+            for (auto& sample : buffer) {
+                sample = noise.NextBipolar();
+            }
+            for (size_t offset = 8; offset <= buffer.size(); offset += 8) {
+                filter.SetTarget((offset / 8) % 2 == 0 ? 20.0f : 20000.0f, 1.0f, offset);
+            }
+            filter.Process(buffer.data(), buffer.size());
+            for (float sample : buffer) {
+                bounded = bounded && std::isfinite(sample) && std::abs(sample) < 100.0f;
+            }
+        }
+        expect(bounded, "Output should stay finite and bounded");
+    }
+};
+
+static ResonantFilterTest resonantFilterTest;
@@ -0,0 +1,138 @@
+#include <juce_core/juce_core.h>
+#include "Util/SampleRing.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using SimpleSynth::Util::SampleRing;
+
+/**
+ * Sample Ring Unit Tests
+ *
+ * Tests cover:
+ * - Blocks come out in order, across the wraparound as two regions
+ * - A block that doesn't fit is refused whole; the ring can fill exactly
+ * - Consume() frees space for the producer
+ * - One producer / one consumer thread stream, sample for sample
+ */
+
+class SampleRingTest : public juce::UnitTest {
+public:
+    SampleRingTest() : juce::UnitTest("SampleRing Tests") {}
+
+    void runTest() override {
+        beginTest("Order And Wraparound");
+        testWraparound();
+
+        beginTest("Full Ring Refuses Blocks");
+        testFullRing();
+
+        beginTest("Two Thread Stream");
+        testTwoThreads();
+    }
+
+private:
+    static std::vector<float> ramp(size_t numSamples, float start) {
+        std::vector<float> samples(numSamples);
+        for (size_t i = 0; i < numSamples; ++i) {
+            samples[i] = start + static_cast<float>(i);
+        }
+        return samples;
+    }
+
+    void testWraparound() {
+        SampleRing<16> ring;
+        expectEquals(static_cast<int>(ring.GetReadRegions().GetSize()), 0);
+
+        // Move the indices near the end, then write across it
+        const auto first = ramp(12, 0.0f);
+        expect(ring.Write(first.data(), first.size()));
+        ring.Consume(12);
+
+        const auto second = ramp(10, 100.0f);
+        expect(ring.Write(second.data(), second.size()));
+
+        const auto regions = ring.GetReadRegions();
+        expectEquals(static_cast<int>(regions.firstSize), 4);
+        expectEquals(static_cast<int>(regions.secondSize), 6);
+
+        bool ordered = true;
+        for (size_t i = 0; i < regions.firstSize; ++i) {
+            ordered = ordered && regions.first[i] == second[i];
+        }
+        for (size_t i = 0; i < regions.secondSize; ++i) {
+            ordered = ordered && regions.second[i] == second[regions.firstSize + i];
+        }
+        expect(ordered, "Regions should hold the block in order");
+
+        ring.Consume(regions.GetSize());
+        expectEquals(static_cast<int>(ring.GetNumReady()), 0);
+    }
+
+    void testFullRing() {
+        SampleRing<16> ring;
+        const auto block = ramp(6, 0.0f);
+
+        expect(ring.Write(block.data(), 6));
+        expect(ring.Write(block.data(), 6));
+        expect(! ring.Write(block.data(), 6), "A block that doesn't fit is refused");
+        expectEquals(static_cast<int>(ring.GetNumReady()), 12, "Nothing of it is queued");
+        expect(ring.Write(block.data(), 4), "Every slot is usable");
+
+        ring.Consume(6);
+        expect(ring.Write(block.data(), 6), "Consumed space is reusable");
+        expectEquals(static_cast<int>(ring.GetNumReady()), 16);
+    }
+
+    void testTwoThreads() {
+        constexpr size_t kBlockSize = 37;
+        constexpr size_t kNumBlocks = 20000;
+        SampleRing<1024> ring;
+        std::atomic<bool> done { false };
+
+        std::thread producer([&ring, &done] {
+            std::vector<float> block(kBlockSize);
+            float next = 0.0f;
+            for (size_t n = 0; n < kNumBlocks; ++n) {
+                for (auto& sample : block) {
+                    sample = next;
+                    next += 1.0f;
+                    if (next >= 1.0e6f) {
+                        next = 0.0f;
+                    }
+                }
+                while (! ring.Write(block.data(), block.size())) {
+                    std::this_thread::yield();
+                }
+            }
+            done.store(true, std::memory_order_release);
+        });
+
+        bool continuous = true;
+        float expected = 0.0f;
+        size_t numRead = 0;
+        auto check = [&](const float* samples, size_t numSamples) {
+            for (size_t i = 0; i < numSamples; ++i) {
+                continuous = continuous && samples[i] == expected;
+                expected += 1.0f;
+                if (expected >= 1.0e6f) {
+                    expected = 0.0f;
+                }
+            }
+            numRead += numSamples;
+        };
+
+        while (numRead < kBlockSize * kNumBlocks) {
+            const auto regions = ring.GetReadRegions();
+            check(regions.first, regions.firstSize);
+            check(regions.second, regions.secondSize);
+            ring.Consume(regions.GetSize());
+        }
+        producer.join();
+
+        expect(done.load());
+        expect(continuous, "Every sample should arrive once, in order");
+    }
+};
+
+static SampleRingTest sampleRingTest;
@@ -0,0 +1,112 @@
+#include <juce_core/juce_core.h>
+#include "Control/SnapshotMorph.h"
+
+using namespace SimpleSynth::Control;
+
+/**
+ * Snapshot Morph Unit Tests
+ *
+ * Tests cover:
+ * - Blends hit each snapshot at the ends and interpolate linearly between
+ * - Only continuous parameters are morphed, never Morph itself
+ * - The moving list holds just the parameters the snapshots disagree on
+ * - Clear() deactivates
+ */
+
+class SnapshotMorphTest : public juce::UnitTest {
+public:
+    SnapshotMorphTest() : juce::UnitTest("SnapshotMorph Tests") {}
+
+    void runTest() override {
+        beginTest("Blend");
+        testBlend();
+
+        beginTest("Morphable Parameters");
+        testMorphable();
+
+        beginTest("Moving Parameters");
+        testMoving();
+
+        beginTest("Clear");
+        testClear();
+    }
+
+private:
+    static Snapshot makeSnapshot(float vcoRate, float delayWetDry) {
+        Snapshot snapshot;
+        snapshot.Set(ParamIndex::VcoRate, vcoRate);
+        snapshot.Set(ParamIndex::VcoLevel, 0.8f);
+        snapshot.Set(ParamIndex::DelayWetDry, delayWetDry);
+        snapshot.Set(ParamIndex::DelayHeads, 2.0f);
+        snapshot.Set(ParamIndex::Morph, 0.3f);
+        snapshot.captured = true;
+        return snapshot;
+    }
+
+    static float Value(const SnapshotMorph& morph, ParamIndex index) {
+        return morph.GetValue(static_cast<size_t>(index));
+    }
+
+    void testBlend() {
+        SnapshotMorph morph;
+        morph.SetEndpoints(makeSnapshot(200.0f, 0.2f), makeSnapshot(600.0f, 1.0f));
+        expect(morph.IsActive());
+
+        morph.Blend(0.0f);
+        expectEquals(Value(morph, ParamIndex::VcoRate), 200.0f);
+        expectEquals(Value(morph, ParamIndex::DelayWetDry), 0.2f);
+
+        morph.Blend(1.0f);
+        expectEquals(Value(morph, ParamIndex::VcoRate), 600.0f);
+        expectWithinAbsoluteError(Value(morph, ParamIndex::DelayWetDry), 1.0f, 1.0e-6f);
+
+        morph.Blend(0.25f);
+        expectWithinAbsoluteError(Value(morph, ParamIndex::VcoRate), 300.0f, 1.0e-4f);
+        expectWithinAbsoluteError(Value(morph, ParamIndex::DelayWetDry), 0.4f, 1.0e-6f);
+        expectEquals(Value(morph, ParamIndex::VcoLevel), 0.8f, "Equal values stay put");
+    }
+
+    void testMorphable() {
+        expect(SnapshotMorph::IsMorphable(ParamIndex::VcoRate));
+        expect(SnapshotMorph::IsMorphable(ParamIndex::Glide));
+        expect(! SnapshotMorph::IsMorphable(ParamIndex::DelayHeads), "Discrete parameters don't blend");
+        expect(! SnapshotMorph::IsMorphable(ParamIndex::Quality));
+        expect(! SnapshotMorph::IsMorphable(ParamIndex::Morph), "Morph can't morph itself");
+
+        SnapshotMorph morph;
+        morph.SetEndpoints(makeSnapshot(200.0f, 0.2f), makeSnapshot(600.0f, 1.0f));
+        for (size_t i = 0; i < morph.GetNumMorphable(); ++i) {
+            expect(SnapshotMorph::IsMorphable(morph.GetMorphable(i)));
+        }
+
+        size_t expected = 0;
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            expected += SnapshotMorph::IsMorphable(ToParamIndex(i)) ? 1 : 0;
+        }
+        expectEquals(static_cast<int>(morph.GetNumMorphable()), static_cast<int>(expected));
+    }
+
+    void testMoving() {
+        SnapshotMorph morph;
+        morph.SetEndpoints(makeSnapshot(200.0f, 0.5f), makeSnapshot(600.0f, 0.5f));
+        expectEquals(static_cast<int>(morph.GetNumMoving()), 1, "Only VCO Rate differs");
+        expect(morph.GetMoving(0) == ParamIndex::VcoRate);
+
+        morph.SetEndpoints(makeSnapshot(200.0f, 0.5f), makeSnapshot(200.0f, 0.5f));
+        expectEquals(static_cast<int>(morph.GetNumMoving()), 0, "Identical scenes have nothing to move");
+        expect(morph.IsActive(), "Recalling one scene is still a morph");
+    }
+
+    void testClear() {
+        SnapshotMorph morph;
+        expect(! morph.IsActive());
+
+        morph.SetEndpoints(makeSnapshot(200.0f, 0.2f), makeSnapshot(600.0f, 1.0f));
+        morph.Clear();
+        expect(! morph.IsActive());
+        expectEquals(static_cast<int>(morph.GetNumMorphable()), 0);
+        expectEquals(static_cast<int>(morph.GetNumMoving()), 0);
+    }
+};
+
+static SnapshotMorphTest snapshotMorphTest;
@@ -0,0 +1,153 @@
+#include <juce_core/juce_core.h>
+#include "Util/SnapshotPublisher.h"
+#include <array>
+#include <atomic>
+#include <thread>
+
+using SimpleSynth::Util::SnapshotPublisher;
+
+/**
+ * Snapshot Publisher Unit Tests
+ *
+ * Tests cover:
+ * - Publish / Acquire handoff and Release
+ * - Only the latest unread publish is seen
+ * - Slots are reclaimed over many cycles without running out
+ * - Reader thread never sees a half-written snapshot
+ */
+
+class SnapshotPublisherTest : public juce::UnitTest {
+public:
+    SnapshotPublisherTest() : juce::UnitTest("SnapshotPublisher Tests") {}
+
+    void runTest() override {
+        beginTest("Publish And Acquire");
+        testPublishAcquire();
+
+        beginTest("Latest Wins");
+        testLatestWins();
+
+        beginTest("Reclaim");
+        testReclaim();
+
+        beginTest("Two Thread Handoff");
+        testTwoThreads();
+    }
+
+private:
+    struct Payload {
+        std::array<int, 64> values {};
+    };
+
+    static void fill(Payload& payload, int value) {
+        payload.values.fill(value);
+    }
+
+    void testPublishAcquire() {
+        SnapshotPublisher<Payload> publisher;
+        expect(publisher.Acquire() == nullptr, "Nothing published yet");
+        expect(publisher.GetCurrent() == nullptr);
+
+        auto* slot = publisher.BeginWrite();
+        expect(slot != nullptr);
+        fill(*slot, 7);
+        publisher.Publish(slot);
+
+        const auto* acquired = publisher.Acquire();
+        expect(acquired != nullptr);
+        expectEquals(acquired->values[63], 7);
+        expect(publisher.GetCurrent() == acquired);
+        expect(publisher.Acquire() == nullptr, "Nothing new since");
+        expect(publisher.GetCurrent() == acquired, "Current stays until released");
+
+        publisher.Release();
+        expect(publisher.GetCurrent() == nullptr);
+    }
+
+    void testLatestWins() {
+        SnapshotPublisher<Payload> publisher;
+
+        for (int i = 1; i <= 10; ++i) {
+            auto* slot = publisher.BeginWrite();
+            expect(slot != nullptr, "Unread publishes go back to the pool");
+            fill(*slot, i);
+            publisher.Publish(slot);
+        }
+
+        const auto* acquired = publisher.Acquire();
+        expect(acquired != nullptr);
+        expectEquals(acquired->values[0], 10);
+    }
+
+    void testReclaim() {
+        SnapshotPublisher<Payload> publisher;
+        bool allWritable = true;
+        bool allSeen = true;
+
+        // Reader holds each snapshot while the next is written
+        for (int i = 0; i < 1000; ++i) {
+            auto* slot = publisher.BeginWrite();
+            allWritable = allWritable && slot != nullptr;
+            if (slot == nullptr) {
+                break;
+            }
+            fill(*slot, i);
+            publisher.Publish(slot);
+
+            const auto* acquired = publisher.Acquire();
+            allSeen = allSeen && acquired != nullptr && acquired->values[0] == i;
+            if (i % 3 == 0) {
+                publisher.Release();
+            }
+        }
+
+        expect(allWritable, "Retired slots should be reclaimed by the writer");
+        expect(allSeen);
+    }
+
+    void testTwoThreads() {
+        constexpr int kCount = 50000;
+        SnapshotPublisher<Payload> publisher;
+        std::atomic<bool> done { false };
+
+        std::thread writer([&publisher, &done] {
+            for (int i = 1; i <= kCount; ++i) {
+                auto* slot = publisher.BeginWrite();
+                if (slot == nullptr) {
+                    break;
+                }
+                fill(*slot, i);
+                publisher.Publish(slot);
+            }
+            done.store(true, std::memory_order_release);
+        });
+
+        bool consistent = true;
+        bool ordered = true;
+        int last = 0;
+
+        auto check = [&](const Payload* payload) {
+            if (payload == nullptr) {
+                return;
+            }
+            const int first = payload->values[0];
+            for (int value : payload->values) {
+                consistent = consistent && value == first;
+            }
+            ordered = ordered && first > last;
+            last = first;
+        };
+
+        while (! done.load(std::memory_order_acquire)) {
+            check(publisher.Acquire());
+        }
+        writer.join();
+        check(publisher.Acquire());
+
+        expect(consistent, "Every snapshot should be seen whole");
+        expect(ordered, "Snapshots should arrive in publish order");
+        expectEquals(last, kCount, "The last publish should be seen");
+    }
+};
+
+static SnapshotPublisherTest snapshotPublisherTest;
@@ -0,0 +1,109 @@
+#include <juce_core/juce_core.h>
+#include "Util/SpscRing.h"
+#include <thread>
+
+using SimpleSynth::Util::SpscRing;
+
+/**
+ * SPSC Ring Unit Tests
+ *
+ * Tests cover:
+ * - FIFO order and empty behavior
+ * - Dropping pushes when full
+ * - Index wraparound
+ * - One producer / one consumer thread handoff
+ */
+
+class SpscRingTest : public juce::UnitTest {
+public:
+    SpscRingTest() : juce::UnitTest("SpscRing Tests") {}
+
+    void runTest() override {
+        beginTest("FIFO Order");
+        testFifoOrder();
+
+        beginTest("Full Ring Drops");
+        testFullRing();
+
+        beginTest("Wraparound");
+        testWraparound();
+
+        beginTest("Two Thread Handoff");
+        testTwoThreads();
+    }
+
+private:
+    void testFifoOrder() {
+        SpscRing<int, 8> ring;
+        int value = -1;
+
+        expect(! ring.Pop(value), "Empty ring should have nothing to pop");
+
+        for (int i = 0; i < 5; ++i) {
+            ring.Push(i);
+        }
+        expectEquals(static_cast<int>(ring.GetNumReady()), 5);
+
+        for (int i = 0; i < 5; ++i) {
+            expect(ring.Pop(value));
+            expectEquals(value, i, "Values should come out in push order");
+        }
+        expect(! ring.Pop(value), "Ring should be empty after draining");
+    }
+
+    void testFullRing() {
+        SpscRing<int, 8> ring;
+
+        for (int i = 0; i < 7; ++i) {
+            expect(ring.Push(i), "Pushes up to capacity should succeed");
+        }
+        expect(! ring.Push(99), "Push into a full ring should fail");
+
+        int value = -1;
+        ring.Pop(value);
+        expectEquals(value, 0, "Full ring should keep the oldest values");
+        expect(ring.Push(7), "Popping should free a slot");
+    }
+
+    void testWraparound() {
+        SpscRing<int, 4> ring;
+        int value = -1;
+        bool ordered = true;
+
+        for (int i = 0; i < 100; ++i) {
+            ring.Push(i);
+            ring.Push(i + 1000);
+            ordered = ordered && ring.Pop(value) && value == i;
+            ordered = ordered && ring.Pop(value) && value == i + 1000;
+        }
+        expect(ordered, "Order should survive many trips around the ring");
+    }
+
+    void testTwoThreads() {
+        constexpr int kCount = 100000;
+        SpscRing<int, 64> ring;
+
+        std::thread producer([&ring] {
+            for (int i = 0; i < kCount;) {
+                if (ring.Push(i)) {
+                    ++i;
+                }
+            }
+        });
+
+        int expected = 0;
+        bool ordered = true;
+        int value = 0;
+        while (expected < kCount) {
+            if (ring.Pop(value)) {
+                ordered = ordered && (value == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+
+        expect(ordered, "Consumer should see every value once, in order");
+    }
+};
+
+static SpscRingTest spscRingTest;
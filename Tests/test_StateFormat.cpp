@@ -0,0 +1,162 @@
+#include <juce_core/juce_core.h>
+#include "Control/StateFormat.h"
+
+using namespace SimpleSynth::Control;
+namespace Format = SimpleSynth::Control::StateFormat;
+
+/**
+ * Binary State Format Unit Tests
+ *
+ * Tests cover:
+ * - Header and sections round-trip; legacy blobs aren't mistaken for binary
+ * - Parameter tables map hashes back to indices and skip unknown ids
+ * - Unknown sections are skipped
+ * - Truncated, oversized and future-version blobs are rejected
+ */
+
+class StateFormatTest : public juce::UnitTest {
+public:
+    StateFormatTest() : juce::UnitTest("StateFormat Tests") {}
+
+    void runTest() override {
+        beginTest("Round Trip");
+        testRoundTrip();
+
+        beginTest("Unknown Parameters And Sections");
+        testUnknown();
+
+        beginTest("Damaged Blobs");
+        testDamaged();
+    }
+
+private:
+    static std::vector<uint8_t> makeBlob(const float* values) {
+        std::vector<uint8_t> blob;
+        Format::Writer writer(blob);
+        writer.WriteHeader(2);
+
+        auto section = writer.BeginSection(Format::Section::Parameters);
+        writer.WriteParameterTable(values);
+        writer.EndSection(section);
+
+        section = writer.BeginSection(Format::Section::Tuning);
+        writer.WriteBytes("scale", 5);
+        writer.EndSection(section);
+        return blob;
+    }
+
+    void testRoundTrip() {
+        float values[kNumParameters];
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            values[i] = 0.5f + static_cast<float>(i) * 1.25f;
+        }
+
+        const auto blob = makeBlob(values);
+        expect(Format::IsBinaryState(blob.data(), blob.size()));
+        expectEquals(static_cast<int>(blob.size()),
+                     12 + 8 + 4 + 8 * static_cast<int>(kNumParameters) + 8 + 5,
+                     "Header, section headers, count, (hash, value) pairs, payload");
+
+        Format::Reader reader(blob.data(), blob.size());
+        expectEquals(reader.ReadHeader(), 2);
+
+        Format::Section tag = Format::Section::Parameters;
+        Format::Reader payload(nullptr, 0);
+        expect(reader.NextSection(tag, payload));
+        expect(tag == Format::Section::Parameters);
+
+        float read[kNumParameters] = {};
+        bool found[kNumParameters] = {};
+        expect(payload.ReadParameterTable(read, found));
+        for (size_t i = 0; i < kNumParameters; ++i) {
+            expect(found[i]);
+            expectEquals(read[i], values[i], "Raw floats come back bit for bit");
+        }
+
+        expect(reader.NextSection(tag, payload));
+        expect(tag == Format::Section::Tuning);
+        expectEquals(static_cast<int>(payload.Remaining()), 5);
+        expect(std::memcmp(payload.GetData(), "scale", 5) == 0);
+
+        // copyXmlToBinary blobs start with JUCE's own magic
+        const uint8_t legacy[] = { 0x56, 0x43, 0x32, 0x21, 0x10, 0, 0, 0, '<', '?', 'x', 'm', 'l' };
+        expect(! Format::IsBinaryState(legacy, sizeof(legacy)));
+        expect(! Format::IsBinaryState(nullptr, 0));
+    }
+
+    void testUnknown() {
+        // A newer build's blob: an extra parameter and an extra section
+        std::vector<uint8_t> blob;
+        Format::Writer writer(blob);
+        writer.WriteHeader(2);
+
+        auto section = writer.BeginSection(static_cast<Format::Section>(99));
+        writer.WriteU32(0xdeadbeefu);
+        writer.EndSection(section);
+
+        section = writer.BeginSection(Format::Section::Parameters);
+        writer.WriteU32(2);
+        writer.WriteU32(Format::HashId("futureParam"));
+        writer.WriteFloat(3.0f);
+        writer.WriteU32(Format::HashId("delayTime"));
+        writer.WriteFloat(1.5f);
+        writer.EndSection(section);
+
+        Format::Reader reader(blob.data(), blob.size());
+        expectEquals(reader.ReadHeader(), 2);
+
+        Format::Section tag = Format::Section::Parameters;
+        Format::Reader payload(nullptr, 0);
+        expect(reader.NextSection(tag, payload), "Unknown sections are still framed");
+        expect(reader.NextSection(tag, payload));
+
+        float values[kNumParameters] = {};
+        bool found[kNumParameters] = {};
+        expect(payload.ReadParameterTable(values, found));
+        expect(found[static_cast<size_t>(ParamIndex::DelayTime)]);
+        expectEquals(values[static_cast<size_t>(ParamIndex::DelayTime)], 1.5f);
+        expect(! found[static_cast<size_t>(ParamIndex::VcoRate)], "Missing parameters are reported");
+        expectEquals(static_cast<int>(Format::FindParameter(Format::HashId("futureParam"))), static_cast<int>(kNumParameters));
+    }
+
+    void testDamaged() {
+        float values[kNumParameters] = {};
+        const auto blob = makeBlob(values);
+
+        // Cut anywhere inside the parameter section
+        for (size_t size : { size_t(0), size_t(11), size_t(12), size_t(19), size_t(40) }) {
+            Format::Reader reader(blob.data(), size);
+            const int numSections = reader.ReadHeader();
+            bool ok = numSections > 0;
+
+            Format::Section tag = Format::Section::Parameters;
+            Format::Reader payload(nullptr, 0);
+            if (ok) {
+                ok = reader.NextSection(tag, payload);
+            }
+            if (ok) {
+                float read[kNumParameters];
+                bool found[kNumParameters] = {};
+                ok = payload.ReadParameterTable(read, found);
+            }
+            expect(! ok, "Truncated at " + juce::String(static_cast<int>(size)));
+        }
+
+        // A section claiming more bytes than the blob holds
+        auto oversized = blob;
+        oversized[16] = 0xff;
+        Format::Reader reader(oversized.data(), oversized.size());
+        expectEquals(reader.ReadHeader(), 2);
+        Format::Section tag = Format::Section::Parameters;
+        Format::Reader payload(nullptr, 0);
+        expect(! reader.NextSection(tag, payload));
+
+        // A future format version this build can't read
+        auto future = blob;
+        future[4] = static_cast<uint8_t>(Format::kVersion + 1);
+        Format::Reader futureReader(future.data(), future.size());
+        expectEquals(futureReader.ReadHeader(), -1);
+    }
+};
+
+static StateFormatTest stateFormatTest;
@@ -0,0 +1,116 @@
+#include <juce_core/juce_core.h>
+#include "Perf/TraceRecorder.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace SimpleSynth::Perf;
+
+/**
+ * Trace Recorder Unit Tests
+ *
+ * Tests cover:
+ * - Nothing recorded while stopped
+ * - Spans from several threads end up in one well-formed trace file
+ * - Start/Stop reference counting across instances
+ */
+
+class TraceRecorderTest : public juce::UnitTest {
+public:
+    TraceRecorderTest() : juce::UnitTest("TraceRecorder Tests") {}
+
+    void runTest() override {
+        beginTest("Stopped Recorder Ignores Spans");
+        testStopped();
+
+        beginTest("Spans From Several Threads");
+        testMultipleThreads();
+
+        beginTest("Reference Counting");
+        testReferenceCounting();
+    }
+
+private:
+    static constexpr const char* kTracePath = "DubSiren_test_trace.json";
+
+    static std::string ReadFile(const char* path) {
+        std::ifstream file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    static int CountOccurrences(const std::string& text, const std::string& pattern) {
+        int count = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+    void testStopped() {
+        auto& recorder = TraceRecorder::GetInstance();
+        expect(! recorder.IsRunning(), "Recorder should start stopped");
+
+        {
+            ScopedTrace trace("Ignored");
+        }
+        expectEquals(static_cast<int>(recorder.GetNumDropped()), 0,
+            "Spans while stopped should be neither recorded nor counted");
+    }
+
+    void testMultipleThreads() {
+        auto& recorder = TraceRecorder::GetInstance();
+        expect(recorder.Start(kTracePath), "Trace file should open");
+
+        auto work = [] {
+            for (int i = 0; i < 100; ++i) {
+                ScopedTrace trace("Worker");
+            }
+        };
+        std::thread first(work);
+        std::thread second(work);
+        first.join();
+        second.join();
+
+        {
+            ScopedTrace trace("Main");
+        }
+
+        recorder.Stop();
+        expect(! recorder.IsRunning());
+
+        const std::string trace = ReadFile(kTracePath);
+        expect(trace.rfind("{\"traceEvents\":[", 0) == 0, "Trace should open the event array");
+        expect(trace.find("]") != std::string::npos && trace.back() == '\n', "Trace should be closed");
+        expectEquals(CountOccurrences(trace, "\"name\":\"Worker\""), 200,
+            "Every worker span should be written");
+        expectEquals(CountOccurrences(trace, "\"name\":\"Main\""), 1);
+        expectGreaterOrEqual(CountOccurrences(trace, "\"thread_name\""), 3,
+            "Each recording thread should be named");
+
+        std::remove(kTracePath);
+    }
+
+    void testReferenceCounting() {
+        auto& recorder = TraceRecorder::GetInstance();
+        recorder.Start(kTracePath);
+        recorder.Start(kTracePath);
+
+        recorder.Stop();
+        expect(recorder.IsRunning(), "Recording should continue while another user remains");
+
+        {
+            ScopedTrace trace("Late");
+        }
+
+        recorder.Stop();
+        expect(! recorder.IsRunning(), "Last Stop() should end recording");
+        expectEquals(CountOccurrences(ReadFile(kTracePath), "\"name\":\"Late\""), 1);
+
+        std::remove(kTracePath);
+    }
+};
+
+static TraceRecorderTest traceRecorderTest;
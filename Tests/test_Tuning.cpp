@@ -0,0 +1,174 @@
+#include <juce_core/juce_core.h>
+#include "DSP/Tuning.h"
+
+using SimpleSynth::DSP::Tuning;
+
+/**
+ * Tuning Unit Tests
+ *
+ * Tests cover:
+ * - Default table matches 12-TET and MidiNoteToFrequency()
+ * - Phase increments follow the sample rate
+ * - Fractional notes interpolate between table entries
+ * - Scala scales (cents and ratios) and keyboard mappings
+ * - Malformed files are rejected without touching the tuning
+ */
+
+class TuningTest : public juce::UnitTest {
+public:
+    TuningTest() : juce::UnitTest("Tuning Tests") {}
+
+    void runTest() override {
+        beginTest("Equal Temperament Default");
+        testEqualTemperament();
+
+        beginTest("Phase Increments");
+        testPhaseIncrements();
+
+        beginTest("Fractional Notes");
+        testFractionalNotes();
+
+        beginTest("Scala Scale");
+        testScala();
+
+        beginTest("Keyboard Mapping");
+        testKeyboardMapping();
+
+        beginTest("Malformed Files");
+        testMalformed();
+    }
+
+private:
+    static float CentsBetween(float a, float b) {
+        return 1200.0f * std::log2(b / a);
+    }
+
+    void testEqualTemperament() {
+        Tuning tuning;
+
+        expectWithinAbsoluteError(tuning.GetFrequency(69), 440.0f, 1.0e-3f);
+        expectWithinAbsoluteError(tuning.GetFrequency(81), 880.0f, 1.0e-3f);
+        expectWithinAbsoluteError(tuning.GetFrequency(60), 261.6256f, 1.0e-3f);
+
+        for (int note = 0; note < Tuning::kNumNotes; ++note) {
+            const float expected = 440.0f * std::pow(2.0f, (note - 69) / 12.0f);
+            expectWithinAbsoluteError(CentsBetween(expected, tuning.GetFrequency(note)), 0.0f, 0.01f);
+            expectWithinAbsoluteError(CentsBetween(expected, SimpleSynth::DSP::MidiNoteToFrequency(note)), 0.0f, 0.01f,
+                "MidiNoteToFrequency should match pow() without calling it");
+            expect(tuning.IsMapped(note));
+        }
+
+        // Out-of-range notes clamp to the table
+        expectEquals(tuning.GetFrequency(-5), tuning.GetFrequency(0));
+        expectEquals(tuning.GetFrequency(200), tuning.GetFrequency(127));
+    }
+
+    void testPhaseIncrements() {
+        Tuning tuning;
+        tuning.SetSampleRate(48000.0f);
+        expectWithinAbsoluteError(tuning.GetPhaseIncrement(69), 440.0f / 48000.0f, 1.0e-7f);
+
+        tuning.SetSampleRate(96000.0f);
+        expectWithinAbsoluteError(tuning.GetPhaseIncrement(69), 440.0f / 96000.0f, 1.0e-7f,
+            "Increments should be rebuilt for the new rate");
+        expectWithinAbsoluteError(tuning.GetFrequency(69), 440.0f, 1.0e-3f, "Frequencies don't depend on the rate");
+    }
+
+    void testFractionalNotes() {
+        Tuning tuning;
+
+        expectEquals(tuning.GetFrequency(69.0f), tuning.GetFrequency(69));
+
+        // Linear between semitones: within a cent of the exponential curve
+        for (float note = 40.25f; note < 90.0f; note += 0.5f) {
+            const float expected = 440.0f * std::pow(2.0f, (note - 69.0f) / 12.0f);
+            expectWithinAbsoluteError(CentsBetween(expected, tuning.GetFrequency(note)), 0.0f, 1.0f);
+        }
+
+        const float low = tuning.GetFrequency(60);
+        const float high = tuning.GetFrequency(61);
+        const float mid = tuning.GetFrequency(60.5f);
+        expect(mid > low && mid < high);
+    }
+
+    void testScala() {
+        // Pentatonic just intonation: ratios, one cents value, trailing comments
+        Tuning tuning;
+        const bool loaded = tuning.LoadScala(
+            "! pentatonic.scl\n"
+            "!\n"
+            "Just pentatonic\n"
+            " 5\n"
+            "!\n"
+            " 9/8\n"
+            " 5/4   major third\n"
+            " 701.955\n"
+            " 5/3\n"
+            " 2\n");
+        expect(loaded);
+        expectEquals(static_cast<int>(tuning.GetNumScaleDegrees()), 5);
+
+        // Default mapping: middle note 60 is degree 0, A4 (degree 9) pinned to 440 Hz
+        // Degree 9 = one period + 4 steps (5/3), so note 60 = 440 / (2 * 5/3)
+        const float middle = tuning.GetFrequency(60);
+        expectWithinAbsoluteError(tuning.GetFrequency(69), 440.0f, 1.0e-3f);
+        expectWithinAbsoluteError(middle, 440.0f / (2.0f * 5.0f / 3.0f), 1.0e-2f);
+        expectWithinAbsoluteError(tuning.GetFrequency(61) / middle, 9.0f / 8.0f, 1.0e-5f);
+        expectWithinAbsoluteError(tuning.GetFrequency(63) / middle, 1.5f, 1.0e-4f);
+        expectWithinAbsoluteError(tuning.GetFrequency(65) / middle, 2.0f, 1.0e-5f, "Five keys per period");
+        expectWithinAbsoluteError(tuning.GetFrequency(55) / middle, 0.5f, 1.0e-5f, "Periods repeat downwards");
+
+        tuning.ResetScale();
+        expectWithinAbsoluteError(tuning.GetFrequency(72), 523.2511f, 1.0e-2f);
+    }
+
+    void testKeyboardMapping() {
+        // White keys only, C4 = 256 Hz, on 12-TET
+        Tuning tuning;
+        const bool loaded = tuning.LoadKeyboardMapping(
+            "! white.kbm\n"
+            "12\n"       // map size
+            "0\n"        // first note
+            "127\n"      // last note
+            "60\n"       // middle note
+            "60\n"       // reference note
+            "256.0\n"    // reference frequency
+            "12\n"       // octave degree
+            "0\nx\n2\nx\n4\n5\nx\n7\nx\n9\nx\n11\n");
+        expect(loaded);
+
+        expectWithinAbsoluteError(tuning.GetFrequency(60), 256.0f, 1.0e-3f);
+        expectWithinAbsoluteError(tuning.GetFrequency(72), 512.0f, 1.0e-3f);
+        expectWithinAbsoluteError(CentsBetween(256.0f, tuning.GetFrequency(67)), 700.0f, 0.01f);
+        expect(tuning.IsMapped(60) && tuning.IsMapped(62) && tuning.IsMapped(71));
+        expect(! tuning.IsMapped(61) && ! tuning.IsMapped(66), "Black keys should be unmapped");
+        expect(! tuning.IsMapped(49), "Unmapped keys repeat every map");
+
+        // Restricted range
+        expect(tuning.LoadKeyboardMapping("0\n48\n72\n60\n69\n440\n0\n"));
+        expect(! tuning.IsMapped(47) && tuning.IsMapped(48) && tuning.IsMapped(72) && ! tuning.IsMapped(73));
+        expectWithinAbsoluteError(tuning.GetFrequency(69), 440.0f, 1.0e-3f);
+
+        tuning.ResetKeyboardMapping();
+        expect(tuning.IsMapped(0) && tuning.IsMapped(127));
+        expectEquals(tuning.GetReferenceNote(), 69);
+    }
+
+    void testMalformed() {
+        Tuning tuning;
+        const float before = tuning.GetFrequency(64);
+
+        expect(! tuning.LoadScala(""), "Empty text");
+        expect(! tuning.LoadScala("Name\n3\n100.0\n200.0\n"), "Fewer pitches than the count");
+        expect(! tuning.LoadScala("Name\nthree\n100.0\n"), "Count isn't a number");
+        expect(! tuning.LoadScala("Name\n2\n100.0\n-3/2\n"), "Negative ratio");
+        expect(! tuning.LoadScala("Name\n1\n0.0\n"), "Zero-cent period");
+        expect(! tuning.LoadKeyboardMapping("12\n0\n127\n60\n"), "Truncated header");
+        expect(! tuning.LoadKeyboardMapping("0\n0\n127\n60\n69\n-440\n12\n"), "Negative reference frequency");
+        expect(! tuning.LoadKeyboardMapping("2\n0\n127\n60\n69\n440\n12\n0\nq\n"), "Bad map entry");
+
+        expectEquals(tuning.GetFrequency(64), before, "Rejected files should leave the tuning alone");
+    }
+};
+
+static TuningTest tuningTest;